@@ -40,5 +40,171 @@ final class AlembicTests: TemporaryDirectoryHelper {
          XCTAssertEqual(expected, actual)
 
     }
+    
+    // MARK: TimeWindowedSampleCache
+    
+    // Writes an .abc with one animated points prim, with a sample at every integer time code
+    private func makeAlembic(named name: String, pointCount: Int, sampleCount: Int) -> URL {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: name), .LoadAll))
+        stage.SetStartTimeCode(0)
+        stage.SetEndTimeCode(Double(sampleCount - 1))
+        pxr.UsdGeomXform.Define(Overlay.TfWeakPtr(stage), "/Root")
+        let pointsAttr = pxr.UsdGeomPoints.Define(Overlay.TfWeakPtr(stage), "/Root/Points").GetPointsAttr()
+        for sample in 0..<sampleCount {
+            let t = Float(sample)
+            let points = pxr.VtVec3fArray(count: pointCount) {
+                for i in $0.indices { $0[i] = pxr.GfVec3f(Float(i), sin(t * 0.1 + Float(i)), t) }
+            }
+            pointsAttr.Set(points, pxr.UsdTimeCode(Double(sample)))
+        }
+        stage.Save()
+        return urlForStage(named: name)
+    }
+    
+    func test_TimeWindowedSampleCache_matchesDirectReads() throws {
+        let url = makeAlembic(named: "Windowed.abc", pointCount: 100, sampleCount: 50)
+        let pointsPath: pxr.SdfPath = "/Root/Points.points"
+        let opened = try XCTUnwrap(TimeWindowedSampleCache.open(url, windowLength: 8, maximumResidentBytes: .max))
+        XCTAssertTrue(opened.attributes.contains { $0.GetPath() == pointsPath })
+        XCTAssertEqual(opened.residentWindows, [])
+        
+        // Alembic also writes time-sampled bounds, so only track the points for exact byte counts
+        let stage = try XCTUnwrap(Overlay.DereferenceOrNil(pxr.UsdStage.Open(pathForStage(named: "Windowed.abc"), .LoadAll)))
+        let pointsAttr = stage.GetAttributeAtPath(pointsPath)
+        let cache = TimeWindowedSampleCache(stage: stage, attributes: [pointsAttr], windowLength: 8, maximumResidentBytes: .max)
+        
+        // Sample times, times between samples, and both ends
+        for time in [0, 0.5, 7, 7.99, 8, 23.25, 48.5, 49] {
+            var expected = pxr.VtValue()
+            pointsAttr.Get(&expected, pxr.UsdTimeCode(time.rounded(.down)))
+            XCTAssertEqual(cache.value(pointsPath, at: time), expected, "\(time)")
+        }
+        XCTAssertEqual(cache.residentWindows, [0, 1, 2, 6])
+        XCTAssertNil(cache.value("/Root/Points.velocities", at: 0))
+        
+        let statistics = cache.statistics
+        XCTAssertEqual(statistics.windowLoads, 4)
+        XCTAssertEqual(statistics.misses, 4)
+        XCTAssertEqual(statistics.hits, 4)
+        XCTAssertEqual(statistics.evictions, 0)
+        // Three full windows, and the two samples at 48 and 49
+        XCTAssertEqual(statistics.residentBytes, 26 * 100 * MemoryLayout<pxr.GfVec3f>.stride)
+    }
+    
+    func test_TimeWindowedSampleCache_holdsAcrossWindowStartsBetweenSamples() throws {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        stage.SetStartTimeCode(0)
+        stage.SetEndTimeCode(24)
+        // Linear is the default, so reading at a window start between samples interpolates
+        XCTAssertEqual(stage.GetInterpolationType(), Overlay.UsdInterpolationTypeLinear)
+        let attr = stage.DefinePrim("/Root", "").CreateAttribute("x", .Double, true, Overlay.SdfVariabilityVarying)
+        for time in [2.0, 3, 10, 17] {
+            attr.Set(time * 10, pxr.UsdTimeCode(time))
+        }
+        
+        // Windows start at 0, 4, 8, 12, 16 and 20. Only 0 comes before the first sample,
+        // and none of the others land on a sample
+        let cache = TimeWindowedSampleCache(stage: stage, attributes: [attr], windowLength: 4, maximumResidentBytes: .max)
+        for (time, held) in [(0, 2.0), (1.5, 2), (2, 2), (3.5, 3), (4, 3), (7.9, 3), (8, 3), (10, 10),
+                             (12, 10), (16, 10), (16.5, 10), (17, 17), (20, 17), (24, 17)] {
+            XCTAssertEqual(cache.value(attr.GetPath(), at: time), pxr.VtValue(held * 10), "\(time)")
+        }
+    }
+    
+    func test_TimeWindowedSampleCache_prefetchesAndEvicts() throws {
+        _ = makeAlembic(named: "Windowed.abc", pointCount: 100, sampleCount: 64)
+        let stage = try XCTUnwrap(Overlay.DereferenceOrNil(pxr.UsdStage.Open(pathForStage(named: "Windowed.abc"), .LoadAll)))
+        let pointsAttr = stage.GetAttributeAtPath("/Root/Points.points")
+        let windowBytes = 8 * 100 * MemoryLayout<pxr.GfVec3f>.stride
+        let cache = TimeWindowedSampleCache(stage: stage, attributes: [pointsAttr], windowLength: 8, maximumResidentBytes: 3 * windowBytes)
+        
+        for frame in 0..<64 {
+            var expected = pxr.VtValue()
+            pointsAttr.Get(&expected, pxr.UsdTimeCode(Double(frame)))
+            XCTAssertEqual(cache.play(at: Double(frame)), [expected])
+            XCTAssertLessThanOrEqual(cache.statistics.residentBytes, 3 * windowBytes)
+        }
+        cache.waitForPrefetches()
+        
+        // play(at:) starts prefetching the next window before reading the current one,
+        // so only the first window is read on the playback thread
+        let statistics = cache.statistics
+        XCTAssertEqual(statistics.windowLoads, 1)
+        XCTAssertEqual(statistics.prefetchedWindowLoads, 7)
+        XCTAssertEqual(statistics.misses, 1)
+        XCTAssertEqual(statistics.evictions, 5)
+        XCTAssertEqual(statistics.peakResidentBytes, 3 * windowBytes)
+        XCTAssertEqual(cache.residentWindows, [5, 6, 7])
+    }
+    
+    func test_benchmark_TimeWindowedSampleCache() throws {
+        func measure<T>(_ body: () throws -> T) rethrows -> (Duration, T) {
+            let start = ContinuousClock.now
+            let result = try body()
+            return (ContinuousClock.now - start, result)
+        }
+        
+        #if DEBUG
+        let pointCount = 1_000
+        let sampleCounts = [50, 200]
+        #else
+        let pointCount = 10_000
+        let sampleCounts = [100, 400, 1600]
+        #endif
+        let windowLength = 24.0
+        let windowBytes = Int(windowLength) * pointCount * MemoryLayout<pxr.GfVec3f>.stride
+        
+        for sampleCount in sampleCounts {
+            let name = "Benchmark_\(sampleCount).abc"
+            let (generate, url) = measure { makeAlembic(named: name, pointCount: pointCount, sampleCount: sampleCount) }
+            let fileSize = try FileManager.default.attributesOfItem(atPath: url.path(percentEncoded: false))[.size] as? Int ?? 0
+            
+            // Lazy: open, read the first window, then play back with prefetching.
+            // Runs before the eager load, so memory the eager load frees doesn't hide the lazy footprint
+            let ((lazyOpen, firstSample, playback, lazy), lazyFootprint) = try peakFootprintIncrease {
+                let (open, cache) = try measure {
+                    try XCTUnwrap(TimeWindowedSampleCache.open(url, windowLength: windowLength, maximumResidentBytes: 4 * windowBytes))
+                }
+                let (firstSample, _) = measure { cache.play(at: 0) }
+                let (playback, _) = measure {
+                    for frame in 1..<sampleCount {
+                        _ = cache.play(at: Double(frame))
+                    }
+                }
+                cache.waitForPrefetches()
+                return (open, firstSample, playback, cache.statistics)
+            }
+            
+            // Eager: open, then read every sample of every time-sampled attribute before playing anything
+            let ((eagerLoad, eagerSampleCount), eagerFootprint) = try peakFootprintIncrease {
+                try measure {
+                    let stage = try XCTUnwrap(Overlay.DereferenceOrNil(pxr.UsdStage.Open(std.string(url.path(percentEncoded: false)), .LoadAll)))
+                    var values = [pxr.VtValue]()
+                    for prim in stage.Traverse() {
+                        for attr in prim.GetAttributes() where attr.ValueMightBeTimeVarying() {
+                            var times = Overlay.Double_Vector()
+                            attr.GetTimeSamples(&times)
+                            for time in times {
+                                var value = pxr.VtValue()
+                                attr.Get(&value, pxr.UsdTimeCode(time))
+                                values.append(value)
+                            }
+                        }
+                    }
+                    return values.count
+                }
+            }
+            
+            XCTAssertLessThanOrEqual(lazy.peakResidentBytes, 4 * windowBytes)
+            print(String(format: "TimeWindowedSampleCache(samples=%d, points=%d): %.1f MB file generated in %.0f ms",
+                         sampleCount, pointCount, Double(fileSize) / 1e6, milliseconds(generate)))
+            print(String(format: "    eager: %.1f ms to read all %d samples, %.1f MB footprint increase",
+                         milliseconds(eagerLoad), eagerSampleCount, Double(eagerFootprint) / 1e6))
+            print(String(format: "    lazy:  %.1f ms open, %.1f ms to first sample, %.1f ms playback (%d of %d windows prefetched), %.1f MB footprint increase (%.1f MB of samples resident at peak)",
+                         milliseconds(lazyOpen), milliseconds(lazyOpen + firstSample), milliseconds(playback),
+                         lazy.prefetchedWindowLoads, lazy.windowLoads + lazy.prefetchedWindowLoads,
+                         Double(lazyFootprint) / 1e6, Double(lazy.peakResidentBytes) / 1e6))
+        }
+    }
     #endif // #if canImport(SwiftUsd_PXR_ENABLE_ALEMBIC_SUPPORT)
 }
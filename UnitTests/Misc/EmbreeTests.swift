@@ -31,6 +31,110 @@ fileprivate typealias BufferReadbackType = Overlay.GfHalf_Vector
 fileprivate let USE_EMBREE = true
 fileprivate let CONVERGE_LIMIT = 10000
 
+// Renders progressively until the image stops changing, instead of a fixed number of iterations.
+//
+// The color AOV is only read back at checkpoints. The first checkpoint is after `firstCheckpoint`
+// iterations, and each one after that waits `checkpointGrowth` times as long as the last, so readbacks
+// stay a small fraction of render time. At each checkpoint, rendering stops if:
+// - the engine reports it's converged, or
+// - the mean squared difference from the previous checkpoint, per iteration in between,
+//   is below `varianceThreshold`
+// The scheduler never looks at the golden image, so comparing the final render against it
+// is an independent check
+fileprivate final class ProgressiveRenderScheduler {
+    enum StopReason: String {
+        case converged, varianceThreshold, iterationLimit
+    }
+    
+    struct Checkpoint {
+        var iteration: Int
+        var seconds: Double
+        var readbackSeconds: Double
+        var variance: Double?
+    }
+    
+    var firstCheckpoint = 16
+    var checkpointGrowth = 1.5
+    var varianceThreshold = 1e-7
+    var iterationLimit = CONVERGE_LIMIT
+    
+    private(set) var iterations = 0
+    private(set) var checkpoints: [Checkpoint] = []
+    private(set) var stopReason: StopReason?
+    
+    private var previous = BufferReadbackType()
+    private var current = BufferReadbackType()
+    
+    func render(_ renderer: Renderer, _ params: pxr.UsdImagingGLRenderParams) {
+        let start = ContinuousClock.now
+        var nextCheckpoint = firstCheckpoint
+        
+        while true {
+            renderer.engine.Render(renderer.stage.GetPseudoRoot(), params)
+            iterations += 1
+            
+            if renderer.engine.IsConverged() {
+                stopReason = .converged
+                break
+            }
+            if iterations >= iterationLimit {
+                stopReason = .iterationLimit
+                break
+            }
+            if iterations < nextCheckpoint {
+                continue
+            }
+            
+            let lastCheckpoint = checkpoints.last?.iteration ?? 0
+            nextCheckpoint = max(iterations + 1, Int(Double(iterations) * checkpointGrowth))
+            if let reason = checkpoint(renderer, start: start, iterationsSinceLast: iterations - lastCheckpoint) {
+                stopReason = reason
+                break
+            }
+        }
+    }
+    
+    private func checkpoint(_ renderer: Renderer, start: ContinuousClock.Instant, iterationsSinceLast: Int) -> StopReason? {
+        let readbackStart = ContinuousClock.now
+        let colorTexture = renderer.engine.GetAovTexture(.HdAovTokens.color)
+        guard colorTexture.__convertToBool(),
+              Overlay.GetDescriptor(colorTexture).format == .HgiFormatFloat16Vec4 else {
+            return nil
+        }
+        let size = renderer.readbackTexture(hgi: renderer.hgi, textureHandle: colorTexture, buffer: &current)
+        let width = Int(size[0])
+        let height = Int(size[1])
+        let count = width * height * 4
+        
+        var result = Checkpoint(iteration: iterations, seconds: 0, readbackSeconds: 0)
+        if previous.size() == current.size() {
+            let difference = Overlay.MeanSquaredDifference(previous.__dataUnsafe(), current.__dataUnsafe(), count)
+            result.variance = difference / Double(iterationsSinceLast)
+        }
+        
+        swap(&previous, &current)
+        let now = ContinuousClock.now
+        result.seconds = milliseconds(now - start) / 1e3
+        result.readbackSeconds = milliseconds(now - readbackStart) / 1e3
+        checkpoints.append(result)
+        
+        if let variance = result.variance, variance < varianceThreshold {
+            return .varianceThreshold
+        }
+        return nil
+    }
+    
+    // One CSV row per checkpoint
+    func instrumentationCSV() -> String {
+        func format(_ x: Double?) -> String { x.map { String($0) } ?? "" }
+        var csv = "iteration,seconds,readbackSeconds,variance\n"
+        for c in checkpoints {
+            csv += "\(c.iteration),\(c.seconds),\(c.readbackSeconds),\(format(c.variance))\n"
+        }
+        return csv
+    }
+}
+
 fileprivate class Renderer {
     var worldCenter: pxr.GfVec3d = pxr.GfVec3d()
     var worldSize: Double = 0.0
@@ -40,6 +144,10 @@ fileprivate class Renderer {
     var hgi: Overlay.HgiWrapper!
     var engine: Overlay.UsdImagingGLEngineWrapper!
     var stage: pxr.UsdStage!
+    // Reused across renders, so batch renders don't reallocate the readback buffer every frame
+    var readbackBuffer = BufferReadbackType()
+    var writeBuffer: [Float] = []
+    let scheduler = ProgressiveRenderScheduler()
     
     deinit {
         // Important: UsdImagingGLEngine requires its Hgi to
@@ -158,15 +266,8 @@ fileprivate class Renderer {
         params.colorCorrectionMode = .HdxColorCorrectionTokens.sRGB
         params.frame = .init(timeCode)
 
-        let tic = Date()
-        var convergeCount = 0
-        repeat {
-            engine.Render(stage.GetPseudoRoot(), params)
-            convergeCount += 1
-        } while(convergeCount < CONVERGE_LIMIT)
-        let toc = Date()
-        print(toc.timeIntervalSince(tic))
-        print(convergeCount)
+        scheduler.render(self, params)
+        print("\(scheduler.iterations) iterations, stopped because \(scheduler.stopReason?.rawValue ?? "nil")")
         return engine.GetAovTexture(.HdAovTokens.color)
     }
 
@@ -206,12 +307,11 @@ fileprivate class Renderer {
     func renderToFile(filepath: String, viewSize: pxr.GfVec2i) {
         let colorTexture = drawWithHydra(timeCode: pxr.UsdTimeCode.Default().GetValue(), viewSize: viewSize)
         if colorTexture.__convertToBool() {
-            var buffer = BufferReadbackType()
-            let textureSize = readbackTexture(hgi: hgi, textureHandle: colorTexture, buffer: &buffer)
-            print(buffer.size())
+            let textureSize = readbackTexture(hgi: hgi, textureHandle: colorTexture, buffer: &readbackBuffer)
+            print(readbackBuffer.byteSize())
             print("After reading back texture, texture size was \(textureSize)")
             let writeSucceeded = writeTextureToFile(textureDesc: Overlay.GetDescriptor(colorTexture),
-                                                    buffer: buffer,
+                                                    buffer: readbackBuffer,
                                                     filename: .init(filepath),
                                                     flipped: true)
             print("Write succeeded? \(writeSucceeded)")
@@ -235,7 +335,7 @@ fileprivate class Renderer {
             var dataByteSize = Int(dataSize) * formatByteSize
             
             let alignedBuffer = pxr.HdStTextureUtils.HgiTextureReadback(hgi.__getUnsafe(), textureHandle, &dataByteSize)
-            buffer.resize(dataByteSize)
+            buffer.resizeBytes(dataByteSize)
             let dest = UnsafeMutableRawPointer(buffer.__dataMutatingUnsafe()!)
             let src = UnsafeRawPointer(alignedBuffer.__getUnsafe()!)
             dest.copyMemory(from: src, byteCount: dataByteSize)
@@ -249,7 +349,7 @@ fileprivate class Renderer {
         let height = textureDesc.dimensions[1]
         let dataByteSize = Int(width) * Int(height) * formatByteSize
 
-        if buffer.size() < dataByteSize {
+        if buffer.byteSize() < dataByteSize {
             return false
         }
         if textureDesc.format.rawValue < 0 || textureDesc.format.rawValue >= Overlay.HgiFormatCount.rawValue {
@@ -265,8 +365,7 @@ fileprivate class Renderer {
 
         do {
             let metadata = pxr.VtDictionary()
-            var image = Overlay.HioImageWrapper.OpenForWriting(std.string(filename))
-            let writeSuccess = Bool(image) && image.Write(storage, metadata)
+            let writeSuccess = RenderConfig.writeImage(storage, to: filename, metadata: metadata, floats: &writeBuffer)
 
             if !writeSuccess {
                 print("Failed to write image")
@@ -283,12 +382,29 @@ fileprivate class Renderer {
 final class EmbreeTests: HydraHelper {
     func testBiplane() {
         let modelUrl = urlForResource(subPath: "Embree/toy_biplane_idle.usdz")
+        let goldenUrl = urlForResource(subPath: "Embree/toy_biplane_idle.png")
         let renderer = Renderer(path: modelUrl.path(percentEncoded: false))
         
         let renderUrl = tempDirectory.appending(path: UUID().uuidString + ".png")
+        let tic = ContinuousClock.now
         renderer.renderToFile(filepath: renderUrl.path(percentEncoded: false), viewSize: pxr.GfVec2i(512, 512))
+        let elapsed = ContinuousClock.now - tic
+        
+        // tempDirectory is removed after each test, so keep the instrumentation with the other benchmark results
+        let csv = Data(renderer.scheduler.instrumentationCSV().utf8)
+        let attachment = XCTAttachment(data: csv, uniformTypeIdentifier: "public.comma-separated-values-text")
+        attachment.name = "Embree.toy_biplane_idle.checkpoints.csv"
+        attachment.lifetime = .keepAlways
+        add(attachment)
+        let directory = FileManager.default.temporaryDirectory.appending(path: "SwiftUsdTests/Benchmarks", directoryHint: .isDirectory)
+        let instrumentationUrl = directory.appending(path: "Embree.toy_biplane_idle.checkpoints.csv")
+        XCTAssertNoThrow(try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true))
+        XCTAssertNoThrow(try csv.write(to: instrumentationUrl))
+        print("Embree biplane: \(renderer.scheduler.iterations) of \(CONVERGE_LIMIT) iterations in \(elapsed), " +
+              "\(renderer.scheduler.checkpoints.count) checkpoints, instrumentation at \(instrumentationUrl.path(percentEncoded: false))")
+        XCTAssertLessThan(renderer.scheduler.iterations, CONVERGE_LIMIT)
         
-        assertImagesEqual(urlForResource(subPath: "Embree/toy_biplane_idle.png"), renderUrl, isEmbreeRender: true, file: #file, line: #line)
+        assertImagesEqual(goldenUrl, renderUrl, isEmbreeRender: true, file: #file, line: #line)
     }
 }
 #endif // #if canImport(SwiftUsd_PXR_ENABLE_EMBREE_SUPPORT)
@@ -0,0 +1,170 @@
+//===----------------------------------------------------------------------===//
+// This source file is part of github.com/apple/SwiftUsd-Tests
+//
+// Copyright © 2025 Apple Inc. and the SwiftUsd-Tests project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+//===----------------------------------------------------------------------===//
+
+#ifndef FlatTypeTraits_hpp
+#define FlatTypeTraits_hpp
+
+#include <type_traits>
+
+// A drop-in replacement for `_Overlay::replace_all_t` from swiftUsd/Util/TypeTraits.h
+// that is cheaper to instantiate on large signatures:
+// - Every sub-type is rewritten by exactly one `replace<Rules, T>` instantiation,
+//   so shared sub-types (e.g. the same parameter type across many Overlay signatures)
+//   are instantiated once per rule set and then reused by the compiler.
+// - Function parameters are rewritten with a single pack expansion instead of
+//   recursing over the parameter list.
+// - Looking up a pattern is overload resolution against a flat set of base classes,
+//   so it has constant instantiation depth no matter how many patterns there are.
+//
+// `replace_all_of_t` replaces several patterns in one pass. Replacements are not
+// rewritten again, and each pattern may only appear once in a rule set.
+//
+// Once this has soaked in the tests, it's intended to move into swiftUsd/Util/TypeTraits.h.
+// Until then, InternalUtilTests checks that both produce the same types, and
+// benchmark-replace-all.py compares their compile-time cost.
+
+namespace _FlatTypeTraits {
+    template <typename Pattern, typename Replacement>
+    struct replace_rule {};
+
+    namespace _impl {
+        template <typename T>
+        struct type_identity { using type = T; };
+
+        struct no_match {};
+
+        template <typename Pattern, typename Replacement>
+        struct rule_entry {};
+
+        template <typename... Rules>
+        struct rule_set;
+
+        template <typename... Patterns, typename... Replacements>
+        struct rule_set<replace_rule<Patterns, Replacements>...> : rule_entry<Patterns, Replacements>... {};
+
+        // Derived-to-base is a better conversion than to `const void*`,
+        // so this picks the rule whose pattern is exactly `T` if there is one
+        template <typename T, typename Replacement>
+        type_identity<Replacement> match(const rule_entry<T, Replacement>*);
+        template <typename T>
+        no_match match(const void*);
+
+        template <typename Rules, typename T>
+        using match_t = decltype(match<T>(static_cast<const Rules*>(nullptr)));
+
+        template <typename From, typename To>
+        struct copy_cv { using type = To; };
+        template <typename From, typename To>
+        struct copy_cv<const From, To> { using type = const To; };
+        template <typename From, typename To>
+        struct copy_cv<volatile From, To> { using type = volatile To; };
+        template <typename From, typename To>
+        struct copy_cv<const volatile From, To> { using type = const volatile To; };
+
+        template <typename Rules, typename T>
+        struct replace;
+        template <typename Rules, typename T>
+        using replace_t = typename replace<Rules, T>::type;
+
+        // Structural rewriting of a cv-unqualified type that isn't itself a pattern
+        template <typename Rules, typename T>
+        struct replace_unqualified { using type = T; };
+
+        template <typename Rules, typename T>
+        struct replace_unqualified<Rules, T*> { using type = replace_t<Rules, T>*; };
+        template <typename Rules, typename T>
+        struct replace_unqualified<Rules, T&> { using type = replace_t<Rules, T>&; };
+        template <typename Rules, typename T>
+        struct replace_unqualified<Rules, T&&> { using type = replace_t<Rules, T>&&; };
+        template <typename Rules, typename T, typename C>
+        struct replace_unqualified<Rules, T C::*> { using type = replace_t<Rules, T> replace_t<Rules, C>::*; };
+        template <typename Rules, typename T>
+        struct replace_unqualified<Rules, T[]> { using type = replace_t<Rules, T>[]; };
+        template <typename Rules, typename T, std::size_t N>
+        struct replace_unqualified<Rules, T[N]> { using type = replace_t<Rules, T>[N]; };
+
+        // Function types, including the cv/ref/noexcept qualified ones that
+        // only show up as the pointee of pointers to member functions
+#define _FLAT_TYPE_TRAITS_FUNCTION(QUALIFIERS) \
+        template <typename Rules, typename R, typename... Args> \
+        struct replace_unqualified<Rules, R(Args...) QUALIFIERS> { \
+            using type = replace_t<Rules, R>(replace_t<Rules, Args>...) QUALIFIERS; \
+        }; \
+        template <typename Rules, typename R, typename... Args> \
+        struct replace_unqualified<Rules, R(Args..., ...) QUALIFIERS> { \
+            using type = replace_t<Rules, R>(replace_t<Rules, Args>..., ...) QUALIFIERS; \
+        };
+
+        // Ref-qualifiers go after cv-qualifiers and before noexcept, so spell them out
+        _FLAT_TYPE_TRAITS_FUNCTION()
+        _FLAT_TYPE_TRAITS_FUNCTION(&)
+        _FLAT_TYPE_TRAITS_FUNCTION(&&)
+        _FLAT_TYPE_TRAITS_FUNCTION(const)
+        _FLAT_TYPE_TRAITS_FUNCTION(const &)
+        _FLAT_TYPE_TRAITS_FUNCTION(const &&)
+        _FLAT_TYPE_TRAITS_FUNCTION(volatile)
+        _FLAT_TYPE_TRAITS_FUNCTION(volatile &)
+        _FLAT_TYPE_TRAITS_FUNCTION(volatile &&)
+        _FLAT_TYPE_TRAITS_FUNCTION(const volatile)
+        _FLAT_TYPE_TRAITS_FUNCTION(const volatile &)
+        _FLAT_TYPE_TRAITS_FUNCTION(const volatile &&)
+        _FLAT_TYPE_TRAITS_FUNCTION(noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(& noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(&& noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(const noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(const & noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(const && noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(volatile noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(volatile & noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(volatile && noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(const volatile noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(const volatile & noexcept)
+        _FLAT_TYPE_TRAITS_FUNCTION(const volatile && noexcept)
+
+#undef _FLAT_TYPE_TRAITS_FUNCTION
+
+        template <typename Rules, typename T, bool isUnqualified = std::is_same_v<T, std::remove_cv_t<T>>>
+        struct replace_qualified { using type = typename replace_unqualified<Rules, T>::type; };
+        template <typename Rules, typename T>
+        struct replace_qualified<Rules, T, false> {
+            using type = typename copy_cv<T, replace_t<Rules, std::remove_cv_t<T>>>::type;
+        };
+
+        template <typename Rules, typename T, typename Match>
+        struct replace_matched { using type = typename Match::type; };
+        template <typename Rules, typename T>
+        struct replace_matched<Rules, T, no_match> { using type = typename replace_qualified<Rules, T>::type; };
+
+        // Tries `T` as written first, so that cv-qualified patterns work, then
+        // rewrites the cv-unqualified type and puts the qualifiers back
+        template <typename Rules, typename T>
+        struct replace {
+            using type = typename replace_matched<Rules, T, match_t<Rules, T>>::type;
+        };
+    }
+
+    template <typename T, typename Pattern, typename Replacement>
+    using replace_all_t = _impl::replace_t<_impl::rule_set<replace_rule<Pattern, Replacement>>, T>;
+
+    template <typename T, typename... Rules>
+    using replace_all_of_t = _impl::replace_t<_impl::rule_set<Rules...>, T>;
+}
+
+#endif /* FlatTypeTraits_hpp */
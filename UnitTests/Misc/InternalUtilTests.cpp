@@ -19,17 +19,36 @@
 //===----------------------------------------------------------------------===//
 
 #include "InternalUtilTests.hpp"
+#include "FlatTypeTraits.hpp"
 #include "swiftUsd/Util/TypeTraits.h"
 
 struct Unrelated {};
 struct Pattern {};
 struct Replacement {};
+struct Pattern2 {};
+struct Replacement2 {};
 
 // Pushes the given message, and whether replacing all occurrences of `Pattern` with `Replacement` in `In` yields
-// `ExpectedOut`, onto the vector argument
+// `ExpectedOut` using the flat implementation in FlatTypeTraits.hpp, onto the vector argument
+template <typename In, typename ExpectedOut>
+void testFlat(const std::string& msg, std::vector<std::pair<std::string, bool>>& vec) {
+    vec.push_back(std::make_pair(msg + " (flat)", std::is_same_v<_FlatTypeTraits::replace_all_t<In, Pattern, Replacement>, ExpectedOut>));
+}
+
+// Pushes the given message, and whether replacing all occurrences of `Pattern` with `Replacement` in `In` yields
+// `ExpectedOut`, onto the vector argument, for both the swiftUsd and flat implementations
 template <typename In, typename ExpectedOut>
 void test(const std::string& msg, std::vector<std::pair<std::string, bool>>& vec) {
     vec.push_back(std::make_pair(msg, std::is_same_v<_Overlay::replace_all_t<In, Pattern, Replacement>, ExpectedOut>));
+    testFlat<In, ExpectedOut>(msg, vec);
+}
+
+// Pushes the given message, and whether replacing `Pattern` with `Replacement` and `Pattern2` with `Replacement2`
+// in one pass in `In` yields `ExpectedOut`, onto the vector argument
+template <typename In, typename ExpectedOut>
+void testMany(const std::string& msg, std::vector<std::pair<std::string, bool>>& vec) {
+    using namespace _FlatTypeTraits;
+    vec.push_back(std::make_pair(msg, std::is_same_v<replace_all_of_t<In, replace_rule<Pattern, Replacement>, replace_rule<Pattern2, Replacement2>>, ExpectedOut>));
 }
 
 std::vector<std::pair<std::string, bool>> testReplaceAllResults() {
@@ -72,5 +91,29 @@ std::vector<std::pair<std::string, bool>> testReplaceAllResults() {
     test<Pattern[4], Replacement[4]>("replace_all does replace fixed-size arrays", result);
     test<Pattern(Pattern), Replacement(Replacement)>("replace_all does replace functions", result);
     
+    
+    testFlat<const Pattern[4], const Replacement[4]>("replace_all does replace const arrays", result);
+    testFlat<Pattern(*)(Pattern) noexcept, Replacement(*)(Replacement) noexcept>("replace_all does replace pointers to noexcept functions", result);
+    testFlat<Pattern(*)(Pattern, ...), Replacement(*)(Replacement, ...)>("replace_all does replace pointers to C variadic functions", result);
+    testFlat<Pattern (Pattern::*)(Pattern) const, Replacement (Replacement::*)(Replacement) const>("replace_all does replace pointers to const member functions", result);
+    testFlat<Pattern (Pattern::*)(Pattern) volatile &&, Replacement (Replacement::*)(Replacement) volatile &&>("replace_all does replace pointers to ref-qualified member functions", result);
+    testFlat<Pattern (Pattern::*)(Pattern, ...) const & noexcept, Replacement (Replacement::*)(Replacement, ...) const & noexcept>("replace_all does replace pointers to fully qualified member functions", result);
+    testFlat<Pattern(*(*)(Pattern*))(Pattern&), Replacement(*(*)(Replacement*))(Replacement&)>("replace_all does replace nested function pointers", result);
+    
+    
+    testMany<Unrelated(*)(Unrelated), Unrelated(*)(Unrelated)>("replace_all_of doesn't replace unrelated types", result);
+    testMany<Pattern, Replacement>("replace_all_of does replace the first pattern", result);
+    testMany<const Pattern2&, const Replacement2&>("replace_all_of does replace the second pattern", result);
+    testMany<Pattern2(*)(Pattern, Pattern2&, const Pattern*), Replacement2(*)(Replacement, Replacement2&, const Replacement*)>("replace_all_of does replace every pattern in one signature", result);
+    testMany<Pattern Pattern2::*, Replacement Replacement2::*>("replace_all_of does replace different patterns in pointers to data members", result);
+    {
+        using namespace _FlatTypeTraits;
+        using Swapped = replace_all_of_t<Pattern(Pattern2), replace_rule<Pattern, Pattern2>, replace_rule<Pattern2, Pattern>>;
+        result.push_back(std::make_pair("replace_all_of doesn't replace replacements again", std::is_same_v<Swapped, Pattern2(Pattern)>));
+        
+        using ConstPattern = replace_all_t<const Pattern, const Pattern, Replacement>;
+        result.push_back(std::make_pair("replace_all does replace cv-qualified patterns as written (flat)", std::is_same_v<ConstPattern, Replacement>));
+    }
+    
     return result;
 }
@@ -24,7 +24,13 @@ import Synchronization
 
 // Helper class that checks for parallel speedup of some serial work.
 // Tries to look for relative speedups (default 4x) rather than fixed
-// benchmarks
+// benchmarks.
+//
+// Every variant, including the serial baseline, is timed with a monotonic clock
+// over a warmup run and several trials, and compared by median, so one slow
+// sample on a loaded machine doesn't fail the test. `checkScaling` measures
+// speedup at a range of concurrency limits instead of asserting, and
+// `exportJSON` writes everything measured so far, so scaling can be tracked over time.
 final fileprivate class ParallelismChecker {
     public struct Number: ExpressibleByFloatLiteral, ExpressibleByIntegerLiteral {
         public let debug: Double
@@ -52,40 +58,99 @@ final fileprivate class ParallelismChecker {
         }
     }
     
+    public struct Statistics: Codable {
+        // Seconds, in the order they were measured
+        public let samples: [Double]
+        public let median: Double
+        public let p95: Double
+        public let mean: Double
+        public let min: Double
+        public let max: Double
+        
+        init(_ samples: [Double]) {
+            let sorted = samples.sorted()
+            self.samples = samples
+            self.median = sorted.count % 2 == 1 ? sorted[sorted.count / 2] : (sorted[sorted.count / 2 - 1] + sorted[sorted.count / 2]) / 2
+            // Nearest-rank percentile
+            self.p95 = sorted[Swift.max(0, Int((0.95 * Double(sorted.count)).rounded(.up)) - 1)]
+            self.mean = samples.reduce(0, +) / Double(samples.count)
+            self.min = sorted.first!
+            self.max = sorted.last!
+        }
+        
+        var description: String {
+            "median \(String(format: "%.4f", median))s, p95 \(String(format: "%.4f", p95))s over \(samples.count) trials"
+        }
+    }
+    
+    public struct Result: Codable {
+        public let name: String
+        // nil if the variant ran with the default concurrency limit
+        public let concurrencyLimit: Int?
+        public let statistics: Statistics
+        // Serial median divided by this variant's median
+        public let speedup: Double
+    }
+    
+    private struct Report: Codable {
+        var name: String
+        var configuration: String
+        var n: Int
+        var warmupCount: Int
+        var trialCount: Int
+        var activeProcessorCount: Int
+        var physicalConcurrencyLimit: Int
+        var serial: Statistics
+        var results: [Result]
+    }
+    
     private var name: String
     private var n: Int
-    private var scopedTimerStart: Date?
-    private var scopedTimerEnd: Date?
-    private var serialDuration: Double = 0
+    private let clock = ContinuousClock()
+    private var scopedTimerStart: ContinuousClock.Instant?
+    private var scopedTimerEnd: ContinuousClock.Instant?
+    private var warmupCount: Int
+    private var trialCount: Int
+    private var serial: Statistics!
+    private(set) var results: [Result] = []
     
-    private func measure(_ work: (Int, ParallelismChecker) -> ()) -> Double {
+    // The concurrency limit `checkScaling` is currently measuring.
+    // Work honors it through WorkSetConcurrencyLimit, but Swift Concurrency
+    // doesn't, so TaskGroup variants should limit how many children they run at once
+    public private(set) var concurrency = Int(pxr.WorkGetConcurrencyLimit())
+    
+    private func sample(_ work: (Int, ParallelismChecker) -> ()) -> Double {
         scopedTimerStart = nil
         scopedTimerEnd = nil
         
-        let start = Date()
+        let start = clock.now
         work(n, self)
-        let end = Date()
+        let end = clock.now
         
-        if let scopedTimerStart, let scopedTimerEnd {
-            return scopedTimerEnd.timeIntervalSince(scopedTimerStart)
-        } else {
-            return end.timeIntervalSince(start)
-        }
+        return milliseconds((scopedTimerEnd ?? end) - (scopedTimerStart ?? start)) / 1e3
     }
     
-    private func measure(_ work: (Int, ParallelismChecker) async -> ()) async -> Double {
+    private func sample(_ work: (Int, ParallelismChecker) async -> ()) async -> Double {
         scopedTimerStart = nil
         scopedTimerEnd = nil
         
-        let start = Date()
+        let start = clock.now
         await work(n, self)
-        let end = Date()
+        let end = clock.now
         
-        if let scopedTimerStart, let scopedTimerEnd {
-            return scopedTimerEnd.timeIntervalSince(scopedTimerStart)
-        } else {
-            return end.timeIntervalSince(start)
-        }
+        return milliseconds((scopedTimerEnd ?? end) - (scopedTimerStart ?? start)) / 1e3
+    }
+    
+    private func measure(_ work: (Int, ParallelismChecker) -> ()) -> Statistics {
+        for _ in 0..<warmupCount { _ = sample(work) }
+        return Statistics((0..<trialCount).map { _ in sample(work) })
+    }
+    
+    private func measure(_ work: (Int, ParallelismChecker) async -> ()) async -> Statistics {
+        for _ in 0..<warmupCount { _ = await sample(work) }
+        var samples = [Double]()
+        for _ in 0..<trialCount { samples.append(await sample(work)) }
+        return Statistics(samples)
     }
     
     // Tell the checker to only record the time for the code argument instead
@@ -95,9 +160,9 @@ final fileprivate class ParallelismChecker {
             fatalError("\(name): Cannot nest calls to time()")
         }
         
-        scopedTimerStart = Date()
+        scopedTimerStart = clock.now
         let result = code()
-        scopedTimerEnd = Date()
+        scopedTimerEnd = clock.now
         return result
     }
     
@@ -106,55 +171,69 @@ final fileprivate class ParallelismChecker {
             fatalError("\(name): Cannot nest calls to time()")
         }
         
-        scopedTimerStart = Date()
+        scopedTimerStart = clock.now
         let result = await code()
-        scopedTimerEnd = Date()
+        scopedTimerEnd = clock.now
         return result
     }
         
     // Creates a checker with the given serial callback
     public static func withSerial(_ name: String,
                            minimumSize: Int = 8, maximumSize: Int = 1_000_000_000,
-                           targetSerialDuration: Number = 1.0, _ code: (Int) -> ()) -> ParallelismChecker {
-        ParallelismChecker.init(name, minimumSize, maximumSize, targetSerialDuration, { n, slf in code(n) })
+                           targetSerialDuration: Number = .init(debug: 0.5, release: 0.25),
+                           warmupCount: Int = 1, trialCount: Number = .init(debug: 3, release: 7),
+                           _ code: (Int) -> ()) -> ParallelismChecker {
+        ParallelismChecker.init(name, minimumSize, maximumSize, targetSerialDuration, warmupCount, trialCount, { n, slf in code(n) })
     }
     
     // Creates a checker with the given serial callback
     public static func withSerial(_ name: String,
                            minimumSize: Int = 8, maximumSize: Int = 1_000_000_000,
-                           targetSerialDuration: Number = 1.0, _ code: (Int, ParallelismChecker) -> ()) -> ParallelismChecker {
-        ParallelismChecker.init(name, minimumSize, maximumSize, targetSerialDuration, code)
+                           targetSerialDuration: Number = .init(debug: 0.5, release: 0.25),
+                           warmupCount: Int = 1, trialCount: Number = .init(debug: 3, release: 7),
+                           _ code: (Int, ParallelismChecker) -> ()) -> ParallelismChecker {
+        ParallelismChecker.init(name, minimumSize, maximumSize, targetSerialDuration, warmupCount, trialCount, code)
     }
 
-    // Scales n by factors of 2 until the work takes at least targetSerialDuration
+    // Scales n by factors of 2 until one run of the work takes at least targetSerialDuration,
+    // then measures the serial baseline at that n
     private func growToTargetSerialDuration(minimumSize: Int, maximumSize: Int, targetSerialDuration: Number, work: (Int, ParallelismChecker) -> ()) {
         n = minimumSize
         while true {
-            let timeForN = measure(work)
+            let timeForN = sample(work)
             if timeForN > targetSerialDuration.currentValue || n * 2 > maximumSize {
-                serialDuration = timeForN
-                print("\(name).SERIAL using n=\(n), serial=\(String(format: "%.4f", serialDuration))s (target was \(targetSerialDuration.currentValue)s)")
-                return
+                break
             }
             n *= 2
         }
+        serial = measure(work)
+        print("\(name).SERIAL using n=\(n), serial \(serial.description) (target was \(targetSerialDuration.currentValue)s)")
     }
     
-    private init(_ name: String, _ minimumSize: Int, _ maximumSize: Int, _ targetSerialDuration: Number, _ code: (Int, ParallelismChecker) -> ()) {
+    private init(_ name: String, _ minimumSize: Int, _ maximumSize: Int, _ targetSerialDuration: Number,
+                 _ warmupCount: Int, _ trialCount: Number, _ code: (Int, ParallelismChecker) -> ()) {
         self.name = name
         self.n = minimumSize
+        self.warmupCount = warmupCount
+        self.trialCount = Swift.max(1, Int(trialCount.currentValue))
         growToTargetSerialDuration(minimumSize: minimumSize, maximumSize: maximumSize, targetSerialDuration: targetSerialDuration, work: code)
     }
     
-    private func report(_ name: String, _ elapsedTime: Double, _ maxFractionOfSerialTime: Number, file: StaticString, line: UInt) -> ParallelismChecker {
+    private func record(_ name: String, _ concurrencyLimit: Int?, _ statistics: Statistics) -> Result {
+        let result = Result(name: name, concurrencyLimit: concurrencyLimit, statistics: statistics, speedup: serial.median / statistics.median)
+        results.append(result)
+        return result
+    }
+    
+    private func report(_ name: String, _ statistics: Statistics, _ maxFractionOfSerialTime: Number, file: StaticString, line: UInt) -> ParallelismChecker {
         func format(_ x: Double) -> String {
             String(format: "%.4f", x)
         }
         
-        let maxAllowed = maxFractionOfSerialTime.currentValue * serialDuration
-        let fractionOfSerial = elapsedTime / serialDuration
-        XCTAssertLessThan(elapsedTime, maxAllowed, name, file: file, line: line)
-        print("\(self.name).\(name)(\(n)) executed in \(format(elapsedTime))s, \(format(fractionOfSerial))x of \(format(serialDuration))s. max allowed was \(format(maxFractionOfSerialTime.currentValue))x => \(format(maxAllowed))s")
+        let result = record(name, nil, statistics)
+        let maxAllowed = maxFractionOfSerialTime.currentValue * serial.median
+        XCTAssertLessThan(statistics.median, maxAllowed, name, file: file, line: line)
+        print("\(self.name).\(name)(\(n)) \(statistics.description), \(format(1 / result.speedup))x of serial median \(format(serial.median))s. max allowed was \(format(maxFractionOfSerialTime.currentValue))x => \(format(maxAllowed))s")
         return self
     }
     
@@ -164,8 +243,8 @@ final fileprivate class ParallelismChecker {
                                  file: StaticString = #filePath, line: UInt = #line,
                                  _ code: (Int, ParallelismChecker) -> ()) -> ParallelismChecker {
         print("Checking parallelism of \(name)")
-        let elapsedTime = measure(code)
-        return report(name, elapsedTime, maxFractionOfSerialTime, file: file, line: line)
+        let statistics = measure(code)
+        return report(name, statistics, maxFractionOfSerialTime, file: file, line: line)
     }
     
     // Tells the checker to make sure the code argument executes quickly
@@ -181,8 +260,8 @@ final fileprivate class ParallelismChecker {
                                  file: StaticString = #filePath, line: UInt = #line,
                                  _ code: (Int, ParallelismChecker) async -> ()) async -> ParallelismChecker {
         print("Checking parallelism of \(name)")
-        let elapsedTime = await measure(code)
-        return report(name, elapsedTime, maxFractionOfSerialTime, file: file, line: line)
+        let statistics = await measure(code)
+        return report(name, statistics, maxFractionOfSerialTime, file: file, line: line)
     }
     
     @discardableResult
@@ -191,6 +270,122 @@ final fileprivate class ParallelismChecker {
                                  _ code: (Int) async -> ()) async -> ParallelismChecker {
         await checkParallelism(name, maxFractionOfSerialTime: maxFractionOfSerialTime, file: file, line: line, { (n, slf) in await code(n) })
     }
+    
+    // Powers of two up to the number of physical cores, and the number of physical cores itself
+    public static var defaultConcurrencyLimits: [Int] {
+        let physical = Int(pxr.WorkGetPhysicalConcurrencyLimit())
+        var result = Array(sequence(first: 1) { $0 * 2 <= physical ? $0 * 2 : nil })
+        if result.last != physical { result.append(physical) }
+        return result
+    }
+    
+    private func withConcurrencyLimit<T>(_ limit: Int, _ body: () async -> T) async -> T {
+        let previous = pxr.WorkGetConcurrencyLimit()
+        pxr.WorkSetConcurrencyLimit(UInt32(limit))
+        concurrency = limit
+        let result = await body()
+        pxr.WorkSetConcurrencyLimit(previous)
+        concurrency = Int(previous)
+        return result
+    }
+    
+    // Measures the code argument at each concurrency limit, without asserting
+    @discardableResult
+    public func checkScaling(_ name: String, concurrencyLimits: [Int] = defaultConcurrencyLimits,
+                             _ code: (Int, ParallelismChecker) async -> ()) async -> ParallelismChecker {
+        print("Checking scaling of \(name)")
+        for limit in concurrencyLimits {
+            let statistics = await withConcurrencyLimit(limit) { await measure(code) }
+            let result = record(name, limit, statistics)
+            print("\(self.name).\(name)(\(n), concurrency=\(limit)) \(statistics.description), speedup \(String(format: "%.2f", result.speedup))x")
+        }
+        return self
+    }
+    
+    @discardableResult
+    public func checkScaling(_ name: String, concurrencyLimits: [Int] = defaultConcurrencyLimits,
+                             _ code: (Int) -> ()) async -> ParallelismChecker {
+        await checkScaling(name, concurrencyLimits: concurrencyLimits, { (n, slf) in code(n) })
+    }
+    
+    // Writes everything measured so far as JSON next to the test's temporary directories,
+    // and attaches it to the test
+    @discardableResult
+    public func exportJSON(_ testCase: XCTestCase) -> ParallelismChecker {
+        #if DEBUG
+        let configuration = "debug"
+        #else
+        let configuration = "release"
+        #endif
+        let report = Report(name: name, configuration: configuration, n: n,
+                            warmupCount: warmupCount, trialCount: trialCount,
+                            activeProcessorCount: ProcessInfo.processInfo.activeProcessorCount,
+                            physicalConcurrencyLimit: Int(pxr.WorkGetPhysicalConcurrencyLimit()),
+                            serial: serial, results: results)
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        do {
+            let data = try encoder.encode(report)
+            let directory = FileManager.default.temporaryDirectory.appending(path: "SwiftUsdTests/Benchmarks", directoryHint: .isDirectory)
+            try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+            let url = directory.appending(path: "LibWork.\(name).json")
+            try data.write(to: url)
+            print("\(name): wrote benchmark results to \(url.path(percentEncoded: false))")
+            
+            let attachment = XCTAttachment(data: data, uniformTypeIdentifier: "public.json")
+            attachment.name = "LibWork.\(name).json"
+            attachment.lifetime = .keepAlways
+            testCase.add(attachment)
+        } catch {
+            XCTFail("\(name): Failed to export benchmark results: \(error)")
+        }
+        return self
+    }
+}
+
+// Runs Swift tasks on the Work library's worker threads.
+//
+// Swift concurrency and Work each have their own pool of roughly one thread per core,
+// so Swift tasks that call into Work-parallel USD code run up to twice as many busy threads
+// as there are cores. Inside `withTaskExecutorPreference(WorkTaskExecutor.shared) { ... }`,
+// tasks and their child tasks are run as Work detached tasks instead. Any Work parallel loops
+// they call then run on the same threads, and the Work concurrency limit bounds both.
+fileprivate final class WorkTaskExecutor: TaskExecutor {
+    static let shared = WorkTaskExecutor()
+    
+    func enqueue(_ job: consuming ExecutorJob) {
+        let job = UnownedJob(job)
+        let executor = asUnownedTaskExecutor()
+        pxr.WorkRunDetachedTask {
+            job.runSynchronously(on: executor)
+        }
+    }
+}
+
+// Tracks how many loop bodies are running at once, and on how many distinct threads
+fileprivate final class Occupancy: Sendable {
+    private let running = Atomic<Int>(0)
+    private let _peak = Atomic<Int>(0)
+    private let threads = Mutex<Set<ObjectIdentifier>>([])
+    
+    var peak: Int { _peak.load(ordering: .relaxed) }
+    var threadCount: Int { threads.withLock { $0.count } }
+    
+    func enter() {
+        let now = running.wrappingAdd(1, ordering: .relaxed).newValue
+        var peak = _peak.load(ordering: .relaxed)
+        while now > peak {
+            let (exchanged, original) = _peak.compareExchange(expected: peak, desired: now, ordering: .relaxed)
+            if exchanged { break }
+            peak = original
+        }
+        let thread = ObjectIdentifier(Thread.current)
+        threads.withLock { _ = $0.insert(thread) }
+    }
+    
+    func exit() {
+        running.wrappingSubtract(1, ordering: .relaxed)
+    }
 }
 
 final class LibWorkTests: TemporaryDirectoryHelper {
@@ -300,6 +495,7 @@ final class LibWorkTests: TemporaryDirectoryHelper {
             }
             XCTAssertEqual(result, expectedSum(n))
         }
+        .exportJSON(self)
     }
     
     func test_reduce() async {
@@ -389,5 +585,148 @@ final class LibWorkTests: TemporaryDirectoryHelper {
             }
             checkOutput(minP, maxP, bbox!)
         }
+        .exportJSON(self)
+    }
+    
+    // Swift tasks that each run a Work parallel loop, first on the default cooperative pool
+    // and then on WorkTaskExecutor
+    func test_nestedParallelism() async {
+        func expectedSum(_ n: Int) -> Int { n * (n - 1) / 2 }
+        
+        func nestedSum(_ n: Int, _ occupancy: Occupancy) async -> Int {
+            let childCount = 32
+            return await withTaskGroup { taskGroup in
+                for i in 0..<childCount {
+                    taskGroup.addTask {
+                        let lowerBound = i * n / childCount
+                        let upperBound = (i + 1) * n / childCount
+                        let result = Mutex<Int>(0)
+                        pxr.WorkParallelForN(upperBound - lowerBound) { start, end in
+                            occupancy.enter()
+                            defer { occupancy.exit() }
+                            var tmp = 0
+                            for j in (lowerBound + Int(start))..<(lowerBound + Int(end)) { tmp += j }
+                            result.withLock { $0 += tmp }
+                        }
+                        return result.withLock { $0 }
+                    }
+                }
+                
+                var tmp = 0
+                for await child in taskGroup {
+                    tmp += child
+                }
+                return tmp
+            }
+        }
+        
+        let separate = Occupancy()
+        let bridged = Occupancy()
+        let checker = await ParallelismChecker.withSerial("nested", maximumSize: 4_000_000_000) {
+            var result = 0
+            for i in 0..<$0 { result += i }
+            XCTAssertEqual(result, expectedSum($0))
+        }
+        .checkParallelism("TaskGroup + WorkParallelForN, separate pools", maxFractionOfSerialTime: .init(debug: 0.85, release: 0.5)) { n in
+            let result = await nestedSum(n, separate)
+            XCTAssertEqual(result, expectedSum(n))
+        }
+        .checkParallelism("TaskGroup + WorkParallelForN, WorkTaskExecutor", maxFractionOfSerialTime: .init(debug: 0.85, release: 0.5)) { n in
+            let result = await withTaskExecutorPreference(WorkTaskExecutor.shared) {
+                await nestedSum(n, bridged)
+            }
+            XCTAssertEqual(result, expectedSum(n))
+        }
+        .exportJSON(self)
+        
+        let concurrencyLimit = Int(pxr.WorkGetConcurrencyLimit())
+        let separateMedian = checker.results[0].statistics.median
+        let bridgedMedian = checker.results[1].statistics.median
+        print("nested: concurrency limit \(concurrencyLimit). " +
+              "separate pools: peak \(separate.peak) loop bodies at once on \(separate.threadCount) threads. " +
+              "WorkTaskExecutor: peak \(bridged.peak) loop bodies at once on \(bridged.threadCount) threads, " +
+              "\(String(format: "%.2f", separateMedian / bridgedMedian))x the throughput " +
+              "(medians \(String(format: "%.4f", bridgedMedian))s vs \(String(format: "%.4f", separateMedian))s)")
+        
+        // Throughput depends on the machine and what else it's running, so it's only reported.
+        // The thread count is what WorkTaskExecutor guarantees
+        XCTAssertLessThanOrEqual(bridged.peak, concurrencyLimit)
+    }
+    
+    // Speedup-vs-concurrency curves for Work and TaskGroup. Doesn't assert any speedup,
+    // the exported JSON is meant to be compared across runs
+    func test_benchmark_scaling() async {
+        func expectedSum(_ n: Int) -> Int { n * (n - 1) / 2 }
+        
+        await ParallelismChecker.withSerial("scaling", maximumSize: 4_000_000_000) {
+            var result = 0
+            for i in 0..<$0 { result += i }
+            XCTAssertEqual(result, expectedSum($0))
+        }
+        .checkScaling("WorkParallelForN") {
+            let result = Mutex<Int>(0)
+            pxr.WorkParallelForN($0) {
+                var tmp = 0
+                for i in $0..<$1 { tmp += Int(i) }
+                result.withLock { $0 += tmp }
+            }
+            XCTAssertEqual(result.withLock { $0 }, expectedSum($0))
+        }
+        .checkScaling("WorkParallelReduceN") {
+            let result = pxr.WorkParallelReduceN(0, $0, { (start, end, identity) in
+                var tmp = identity
+                for i in start..<end { tmp += i }
+                return tmp
+            }, { $0 + $1 })
+            XCTAssertEqual(result, expectedSum($0))
+        }
+        .checkScaling("WorkParallelForEach") { n, checker in
+            let result = Mutex<Int>(0)
+            let partitionCount = 1000
+            let partitions = (0..<partitionCount).map { (($0 * n / partitionCount)..<(($0 + 1) * n / partitionCount)) }
+            checker.time {
+                pxr.WorkParallelForEach(partitions) { partition in
+                    var tmp = 0
+                    for el in partition { tmp += el }
+                    result.withLock { $0 += tmp }
+                }
+            }
+            XCTAssertEqual(result.withLock { $0 }, expectedSum(n))
+        }
+        .checkScaling("TaskGroup") { n, checker in
+            // Swift Concurrency ignores the Work concurrency limit,
+            // so only keep that many children running at once
+            let childCount = 32
+            let maxRunning = checker.concurrency
+            let result = await withTaskGroup { taskGroup in
+                func addChild(_ i: Int) {
+                    taskGroup.addTask {
+                        var tmp = 0
+                        for j in (i * n / childCount)..<(i + 1) * n / childCount {
+                            tmp += j
+                        }
+                        return tmp
+                    }
+                }
+                
+                var nextChild = 0
+                while nextChild < min(maxRunning, childCount) {
+                    addChild(nextChild)
+                    nextChild += 1
+                }
+                
+                var tmp = 0
+                for await child in taskGroup {
+                    tmp += child
+                    if nextChild < childCount {
+                        addChild(nextChild)
+                        nextChild += 1
+                    }
+                }
+                return tmp
+            }
+            XCTAssertEqual(result, expectedSum(n))
+        }
+        .exportJSON(self)
     }
 }
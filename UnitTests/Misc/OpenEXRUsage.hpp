@@ -36,6 +36,52 @@ struct ReadOpenEXRResult {
 };
 
 ReadOpenEXRResult readOpenEXR(std::string path, int rowBytes);
+
+// A rectangle of pixels in the coordinates of an EXR's data window. Bounds are inclusive
+struct OpenEXRWindow {
+    int minX;
+    int minY;
+    int maxX;
+    int maxY;
+};
+
+struct OpenEXRInfo {
+    bool success;
+    OpenEXRWindow dataWindow;
+    bool isTiled;
+    int tileWidth;
+    int tileHeight;
+};
+
+OpenEXRInfo readOpenEXRInfo(std::string path);
+
+struct ReadOpenEXRWindowResult {
+    bool success;
+    int width;
+    int height;
+    // Bytes of intermediate storage the read needed on top of the caller's buffer.
+    // Zero when pixels were decoded straight into the caller's buffer
+    size_t stagingBytes;
+};
+
+// Decodes `window` of the EXR at `path` into `buffer` as half-float RGBA pixels.
+// Row `y` of the window starts at `buffer + (y - window.minY) * rowBytes`, and `rowBytes`
+// must be a multiple of 8 and at least 8 times the window's width.
+//
+// - Scanline files covering the full width of the data window are decoded directly into `buffer`.
+//   Narrower windows are decoded through a staging buffer of `rowsPerBand` full-width rows.
+// - Tiled files only decode the tiles that intersect `window`, one row of tiles at a time,
+//   through a staging buffer one tile tall and as wide as the intersecting tiles.
+//
+// Line buffers and tiles are decompressed on `threadCount` threads (0 decodes on the calling thread).
+ReadOpenEXRWindowResult readOpenEXRWindow(std::string path, OpenEXRWindow window, void* buffer, int rowBytes, int rowsPerBand, int threadCount);
+
+// Decodes the full data window into `buffer` with `Imf::Array2D`, the way the OpenEXR docs do,
+// as a reference for readOpenEXRWindow
+ReadOpenEXRResult readOpenEXRFullFrame(std::string path, void* buffer, int rowBytes);
+
+// Rewrites the EXR at `srcPath` as a tiled EXR at `dstPath`
+bool writeOpenEXRTiled(std::string srcPath, std::string dstPath, int tileWidth, int tileHeight);
 #endif // #if defined(SwiftUsd_PXR_ENABLE_OPENIMAGEIO_SUPPORT) || defined(SwiftUsd_PXR_ENABLE_ALEMBIC_SUPPORT) || defined(SwiftUsd_PXR_ENABLE_OPENVDB_SUPPORT)
 
 
@@ -28,8 +28,15 @@
 #include <OpenEXR/openexr.h>
 #include <OpenEXR/ImfRgbaFile.h>
 #include <OpenEXR/ImfArray.h>
+#include <OpenEXR/ImfTiledRgbaFile.h>
+#include <OpenEXR/ImfTestFile.h>
+#include <OpenEXR/ImfStdIO.h>
 
-#include <iostream>
+#include "pxr/base/tf/diagnostic.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 ReadOpenEXRResult readOpenEXR(std::string path, int rowBytes) {
     ReadOpenEXRResult result;
@@ -53,4 +60,195 @@ ReadOpenEXRResult readOpenEXR(std::string path, int rowBytes) {
     return result;
 }
 
+OpenEXRInfo readOpenEXRInfo(std::string path) {
+    OpenEXRInfo result = {};
+    
+    try {
+        bool isTiled = false;
+        if (!Imf::isOpenExrFile(path.c_str(), isTiled)) {
+            return result;
+        }
+        
+        result.isTiled = isTiled;
+        if (isTiled) {
+            Imf::TiledRgbaInputFile file(path.c_str(), 0);
+            auto dw = file.dataWindow();
+            result.dataWindow = {dw.min.x, dw.min.y, dw.max.x, dw.max.y};
+            result.tileWidth = file.tileXSize();
+            result.tileHeight = file.tileYSize();
+        } else {
+            Imf::RgbaInputFile file(path.c_str(), 0);
+            auto dw = file.dataWindow();
+            result.dataWindow = {dw.min.x, dw.min.y, dw.max.x, dw.max.y};
+        }
+        result.success = true;
+    } catch (const std::exception& e) {
+        TF_RUNTIME_ERROR("readOpenEXRInfo: %s", e.what());
+    }
+    
+    return result;
+}
+
+namespace {
+    // Copies the rows of `window` that fall in [y0, y1] out of a staging buffer
+    // whose pixel (0, 0) is (stageMinX, y0)
+    void copyFromStaging(const std::vector<Imf::Rgba>& staging, int stageMinX, int stageWidth, int y0, int y1,
+                         const OpenEXRWindow& window, char* buffer, int rowBytes) {
+        int width = window.maxX - window.minX + 1;
+        for (int y = std::max(y0, window.minY); y <= std::min(y1, window.maxY); y++) {
+            const Imf::Rgba* src = staging.data() + (size_t)(y - y0) * stageWidth + (window.minX - stageMinX);
+            char* dst = buffer + (size_t)(y - window.minY) * rowBytes;
+            memcpy(dst, src, (size_t)width * sizeof(Imf::Rgba));
+        }
+    }
+    
+    bool containsWindow(const Imath::Box2i& dw, const OpenEXRWindow& window) {
+        return window.minX >= dw.min.x && window.minY >= dw.min.y && window.maxX <= dw.max.x && window.maxY <= dw.max.y;
+    }
+    
+    size_t readScanlineWindow(Imf::RgbaInputFile& file, const OpenEXRWindow& window, char* buffer, int rowBytes, int rowsPerBand) {
+        auto dw = file.dataWindow();
+        int dwWidth = dw.max.x - dw.min.x + 1;
+        size_t rowPixels = (size_t)rowBytes / sizeof(Imf::Rgba);
+        
+        if (window.minX == dw.min.x && window.maxX == dw.max.x) {
+            // Every decoded pixel is one the caller asked for, so decode straight into their buffer
+            Imf::Rgba* base = reinterpret_cast<Imf::Rgba*>(buffer) - dw.min.x - (ptrdiff_t)window.minY * (ptrdiff_t)rowPixels;
+            file.setFrameBuffer(base, 1, rowPixels);
+            file.readPixels(window.minY, window.maxY);
+            return 0;
+        }
+        
+        // readPixels always writes the full width of the data window,
+        // so decode bands of full rows and copy out the columns in the window
+        std::vector<Imf::Rgba> staging((size_t)dwWidth * rowsPerBand);
+        for (int y0 = window.minY; y0 <= window.maxY; y0 += rowsPerBand) {
+            int y1 = std::min(y0 + rowsPerBand - 1, window.maxY);
+            file.setFrameBuffer(staging.data() - dw.min.x - (ptrdiff_t)y0 * dwWidth, 1, dwWidth);
+            file.readPixels(y0, y1);
+            copyFromStaging(staging, dw.min.x, dwWidth, y0, y1, window, buffer, rowBytes);
+        }
+        return staging.size() * sizeof(Imf::Rgba);
+    }
+    
+    size_t readTiledWindow(Imf::TiledRgbaInputFile& file, const OpenEXRWindow& window, char* buffer, int rowBytes) {
+        auto dw = file.dataWindow();
+        int tileWidth = file.tileXSize();
+        int tileHeight = file.tileYSize();
+        
+        int tx0 = (window.minX - dw.min.x) / tileWidth;
+        int tx1 = (window.maxX - dw.min.x) / tileWidth;
+        int ty0 = (window.minY - dw.min.y) / tileHeight;
+        int ty1 = (window.maxY - dw.min.y) / tileHeight;
+        
+        int stageMinX = dw.min.x + tx0 * tileWidth;
+        int stageWidth = (tx1 - tx0 + 1) * tileWidth;
+        std::vector<Imf::Rgba> staging((size_t)stageWidth * tileHeight);
+        
+        // readTiles decodes every tile in the row on OpenEXR's thread pool
+        for (int ty = ty0; ty <= ty1; ty++) {
+            int y0 = dw.min.y + ty * tileHeight;
+            int y1 = std::min(y0 + tileHeight - 1, (int)dw.max.y);
+            file.setFrameBuffer(staging.data() - stageMinX - (ptrdiff_t)y0 * stageWidth, 1, stageWidth);
+            file.readTiles(tx0, tx1, ty, ty);
+            copyFromStaging(staging, stageMinX, stageWidth, y0, y1, window, buffer, rowBytes);
+        }
+        return staging.size() * sizeof(Imf::Rgba);
+    }
+}
+
+ReadOpenEXRWindowResult readOpenEXRWindow(std::string path, OpenEXRWindow window, void* buffer, int rowBytes, int rowsPerBand, int threadCount) {
+    ReadOpenEXRWindowResult result;
+    result.width = window.maxX - window.minX + 1;
+    result.height = window.maxY - window.minY + 1;
+    result.stagingBytes = 0;
+    result.success = false;
+    
+    if (result.width <= 0 || result.height <= 0) {
+        return result;
+    }
+    if (rowBytes % sizeof(Imf::Rgba) != 0 || (size_t)rowBytes < (size_t)result.width * sizeof(Imf::Rgba) || rowsPerBand <= 0) {
+        return result;
+    }
+    
+    try {
+        // The magic number check and the decoder share one stream, so the file is only opened once
+        Imf::StdIFStream stream(path.c_str());
+        bool isTiled = false;
+        if (!Imf::isOpenExrFile(stream, isTiled)) {
+            return result;
+        }
+        
+        if (isTiled) {
+            Imf::TiledRgbaInputFile file(stream, threadCount);
+            if (!containsWindow(file.dataWindow(), window)) {
+                return result;
+            }
+            result.stagingBytes = readTiledWindow(file, window, static_cast<char*>(buffer), rowBytes);
+        } else {
+            Imf::RgbaInputFile file(stream, threadCount);
+            if (!containsWindow(file.dataWindow(), window)) {
+                return result;
+            }
+            result.stagingBytes = readScanlineWindow(file, window, static_cast<char*>(buffer), rowBytes, rowsPerBand);
+        }
+        result.success = true;
+    } catch (const std::exception& e) {
+        TF_RUNTIME_ERROR("readOpenEXRWindow: %s", e.what());
+    }
+    
+    return result;
+}
+
+ReadOpenEXRResult readOpenEXRFullFrame(std::string path, void* buffer, int rowBytes) {
+    ReadOpenEXRResult result;
+    result.width = -1;
+    result.height = -1;
+    result.success = false;
+    
+    try {
+        Imf::RgbaInputFile file(path.c_str());
+        auto dw = file.dataWindow();
+        result.width = dw.max.x - dw.min.x + 1;
+        result.height = dw.max.y - dw.min.y + 1;
+        if ((size_t)rowBytes < (size_t)result.width * sizeof(Imf::Rgba)) {
+            return result;
+        }
+        
+        Imf::Array2D<Imf::Rgba> pixels(result.height, result.width);
+        file.setFrameBuffer(&pixels[0][0] - dw.min.x - dw.min.y * result.width, 1, result.width);
+        file.readPixels(dw.min.y, dw.max.y);
+        
+        for (int y = 0; y < result.height; y++) {
+            memcpy(static_cast<char*>(buffer) + (size_t)y * rowBytes, pixels[y], (size_t)result.width * sizeof(Imf::Rgba));
+        }
+        result.success = true;
+    } catch (const std::exception& e) {
+        TF_RUNTIME_ERROR("readOpenEXRFullFrame: %s", e.what());
+    }
+    
+    return result;
+}
+
+bool writeOpenEXRTiled(std::string srcPath, std::string dstPath, int tileWidth, int tileHeight) {
+    try {
+        Imf::RgbaInputFile src(srcPath.c_str());
+        auto dw = src.dataWindow();
+        int width = dw.max.x - dw.min.x + 1;
+        int height = dw.max.y - dw.min.y + 1;
+        
+        Imf::Array2D<Imf::Rgba> pixels(height, width);
+        src.setFrameBuffer(&pixels[0][0] - dw.min.x - dw.min.y * width, 1, width);
+        src.readPixels(dw.min.y, dw.max.y);
+        
+        Imf::TiledRgbaOutputFile dst(dstPath.c_str(), src.header(), src.channels(), tileWidth, tileHeight, Imf::ONE_LEVEL);
+        dst.setFrameBuffer(&pixels[0][0] - dw.min.x - dw.min.y * width, 1, width);
+        dst.writeTiles(0, dst.numXTiles() - 1, 0, dst.numYTiles() - 1);
+        return true;
+    } catch (const std::exception& e) {
+        TF_RUNTIME_ERROR("writeOpenEXRTiled: %s", e.what());
+        return false;
+    }
+}
+
 #endif // #if defined(SwiftUsd_PXR_ENABLE_OPENIMAGEIO_SUPPORT) || defined(SwiftUsd_PXR_ENABLE_ALEMBIC_SUPPORT) || defined(SwiftUsd_PXR_ENABLE_OPENVDB_SUPPORT)
@@ -215,5 +215,130 @@ final class RegressionTests: TemporaryDirectoryHelper {
         XCTAssertEqual(readOpenEXRResult.width, expectedWidth)
         XCTAssertEqual(readOpenEXRResult.height, expectedHeight)
     }
+    
+    private func decodeOpenEXRFullFrame(_ path: std.string, width: Int, height: Int) -> [UInt8] {
+        var pixels = [UInt8](repeating: 0, count: width * height * 8)
+        let result = pixels.withUnsafeMutableBytes {
+            readOpenEXRFullFrame(path, $0.baseAddress!, Int32(width * 8))
+        }
+        XCTAssertTrue(result.success)
+        return pixels
+    }
+    
+    private func decodeOpenEXRWindow(_ path: std.string, _ window: OpenEXRWindow, rowsPerBand: Int32 = 16, threadCount: Int32 = 4) -> ([UInt8], ReadOpenEXRWindowResult) {
+        let width = Int(window.maxX - window.minX + 1)
+        let height = Int(window.maxY - window.minY + 1)
+        var pixels = [UInt8](repeating: 0, count: width * height * 8)
+        let result = pixels.withUnsafeMutableBytes {
+            readOpenEXRWindow(path, window, $0.baseAddress!, Int32(width * 8), rowsPerBand, threadCount)
+        }
+        return (pixels, result)
+    }
+    
+    // Crops `window` out of a full frame decoded into `fullFrame`, for comparing against windowed reads
+    private func crop(_ fullFrame: [UInt8], fullWidth: Int, dataWindow: OpenEXRWindow, _ window: OpenEXRWindow) -> [UInt8] {
+        var result = [UInt8]()
+        let rowBytes = Int(window.maxX - window.minX + 1) * 8
+        for y in Int(window.minY)...Int(window.maxY) {
+            let start = ((y - Int(dataWindow.minY)) * fullWidth + Int(window.minX - dataWindow.minX)) * 8
+            result.append(contentsOf: fullFrame[start..<start + rowBytes])
+        }
+        return result
+    }
+    
+    func test_OpenEXRWindowedRead() {
+        let scanlinePath = std.string(urlForResource(subPath: "OpenEXR/USDLogoLrg.exr").path(percentEncoded: false))
+        let tiledPath = pathForStage(named: "USDLogoLrg_tiled.exr")
+        XCTAssertTrue(writeOpenEXRTiled(scanlinePath, tiledPath, 64, 32))
+        
+        let scanlineInfo = readOpenEXRInfo(scanlinePath)
+        XCTAssertTrue(scanlineInfo.success)
+        XCTAssertFalse(scanlineInfo.isTiled)
+        let tiledInfo = readOpenEXRInfo(tiledPath)
+        XCTAssertTrue(tiledInfo.success)
+        XCTAssertTrue(tiledInfo.isTiled)
+        XCTAssertEqual(tiledInfo.tileWidth, 64)
+        XCTAssertEqual(tiledInfo.tileHeight, 32)
+        
+        let dw = scanlineInfo.dataWindow
+        let width = Int(dw.maxX - dw.minX + 1)
+        let height = Int(dw.maxY - dw.minY + 1)
+        XCTAssertEqual(width, 860)
+        XCTAssertEqual(height, 289)
+        let fullFrame = decodeOpenEXRFullFrame(scanlinePath, width: width, height: height)
+        
+        let windows = [
+            dw,
+            OpenEXRWindow(minX: dw.minX, minY: dw.minY + 17, maxX: dw.maxX, maxY: dw.minY + 200),
+            OpenEXRWindow(minX: dw.minX + 100, minY: dw.minY + 50, maxX: dw.minX + 499, maxY: dw.minY + 249),
+            OpenEXRWindow(minX: dw.maxX - 9, minY: dw.maxY - 9, maxX: dw.maxX, maxY: dw.maxY),
+            OpenEXRWindow(minX: dw.minX + 63, minY: dw.minY + 31, maxX: dw.minX + 64, maxY: dw.minY + 32),
+        ]
+        for path in [scanlinePath, tiledPath] {
+            for window in windows {
+                let (pixels, result) = decodeOpenEXRWindow(path, window)
+                XCTAssertTrue(result.success, "\(path) \(window)")
+                XCTAssertEqual(pixels, crop(fullFrame, fullWidth: width, dataWindow: dw, window), "\(path) \(window)")
+            }
+        }
+        
+        // Full-width scanline reads don't need any staging
+        XCTAssertEqual(decodeOpenEXRWindow(scanlinePath, windows[1]).1.stagingBytes, 0)
+        XCTAssertEqual(decodeOpenEXRWindow(scanlinePath, windows[2], rowsPerBand: 8).1.stagingBytes, width * 8 * 8)
+        
+        // Windows outside the data window and undersized rows are rejected
+        XCTAssertFalse(decodeOpenEXRWindow(scanlinePath, OpenEXRWindow(minX: dw.minX - 1, minY: dw.minY, maxX: dw.maxX, maxY: dw.maxY)).1.success)
+        var tooSmall = [UInt8](repeating: 0, count: width * 8)
+        XCTAssertFalse(tooSmall.withUnsafeMutableBytes {
+            readOpenEXRWindow(scanlinePath, dw, $0.baseAddress!, Int32(width * 8 - 8), 16, 0)
+        }.success)
+    }
+    
+    func test_benchmark_OpenEXRWindowedRead() {
+        let scanlinePath = std.string(urlForResource(subPath: "OpenEXR/USDLogoLrg.exr").path(percentEncoded: false))
+        let tiledPath = pathForStage(named: "USDLogoLrg_tiled.exr")
+        XCTAssertTrue(writeOpenEXRTiled(scanlinePath, tiledPath, 64, 64))
+        let dw = readOpenEXRInfo(scanlinePath).dataWindow
+        let width = Int(dw.maxX - dw.minX + 1)
+        let height = Int(dw.maxY - dw.minY + 1)
+        let iterations = 50
+        
+        func report(_ name: String, bytesPerIteration: Int, _ body: () -> ()) {
+            let (elapsed, peak) = peakFootprintIncrease {
+                ContinuousClock().measure {
+                    for _ in 0..<iterations {
+                        body()
+                    }
+                }
+            }
+            let seconds = milliseconds(elapsed) / 1e3
+            let megabytesPerSecond = Double(bytesPerIteration * iterations) / seconds / 1e6
+            print("OpenEXR.\(name): \(String(format: "%.1f", megabytesPerSecond)) MB/s, " +
+                  "peak footprint +\(String(format: "%.1f", Double(peak) / 1e6)) MB")
+        }
+        
+        let fullBytes = width * height * 8
+        var buffer = [UInt8](repeating: 0, count: fullBytes)
+        let subWindow = OpenEXRWindow(minX: dw.minX + Int32(width / 4), minY: dw.minY + Int32(height / 4), maxX: dw.minX + Int32(3 * width / 4) - 1, maxY: dw.minY + Int32(3 * height / 4) - 1)
+        let subBytes = Int(subWindow.maxX - subWindow.minX + 1) * Int(subWindow.maxY - subWindow.minY + 1) * 8
+        
+        report("fullFrame", bytesPerIteration: fullBytes) {
+            _ = buffer.withUnsafeMutableBytes { readOpenEXRFullFrame(scanlinePath, $0.baseAddress!, Int32(width * 8)) }
+        }
+        for threadCount: Int32 in [0, 4] {
+            report("scanline.full(threads=\(threadCount))", bytesPerIteration: fullBytes) {
+                _ = buffer.withUnsafeMutableBytes { readOpenEXRWindow(scanlinePath, dw, $0.baseAddress!, Int32(width * 8), 16, threadCount) }
+            }
+            report("scanline.window(threads=\(threadCount))", bytesPerIteration: subBytes) {
+                _ = buffer.withUnsafeMutableBytes { readOpenEXRWindow(scanlinePath, subWindow, $0.baseAddress!, Int32(width * 8), 16, threadCount) }
+            }
+            report("tiled.full(threads=\(threadCount))", bytesPerIteration: fullBytes) {
+                _ = buffer.withUnsafeMutableBytes { readOpenEXRWindow(tiledPath, dw, $0.baseAddress!, Int32(width * 8), 16, threadCount) }
+            }
+            report("tiled.window(threads=\(threadCount))", bytesPerIteration: subBytes) {
+                _ = buffer.withUnsafeMutableBytes { readOpenEXRWindow(tiledPath, subWindow, $0.baseAddress!, Int32(width * 8), 16, threadCount) }
+            }
+        }
+    }
     #endif // #if canImport(SwiftUsd_PXR_ENABLE_OPENIMAGEIO_SUPPORT) || canImport(SwiftUsd_PXR_ENABLE_ALEMBIC_SUPPORT) || canImport(SwiftUsd_PXR_ENABLE_OPENVDB_SUPPORT)
 }
@@ -0,0 +1,284 @@
+//===----------------------------------------------------------------------===//
+// This source file is part of github.com/apple/SwiftUsd-Tests
+//
+// Copyright © 2025 Apple Inc. and the SwiftUsd-Tests project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import OpenUSD
+import Synchronization
+
+// Time-windowed cache of attribute samples, for playing back large caches like .abc files.
+//
+// Opening a stage only reads its hierarchy. Samples are read a window of time codes at a time,
+// the first time something asks for a time inside that window:
+// - A window holds every authored sample in `[start, start + windowLength)` for each tracked
+//   attribute, plus the last sample before `start` at its own time, so any time in the window can be answered
+// - `play(at:)` loads the window for a time if needed, and starts reading the next window
+//   on a Work thread, so steady playback never waits on the file
+// - Resident windows are evicted least-recently-used first whenever their samples add up to
+//   more than `maximumResidentBytes`. The window being read from is never evicted, so a single
+//   window bigger than the budget still works, it just doesn't stay resident. Prefetching
+//   only pays off if the budget fits at least two windows
+//
+// Values are held, not interpolated: a time between two samples gets the earlier sample,
+// like UsdInterpolationTypeHeld. Reading from several threads at once is fine.
+final class TimeWindowedSampleCache: @unchecked Sendable {
+    struct Statistics {
+        // Windows read on the calling thread, because they weren't resident or prefetched yet
+        var windowLoads = 0
+        var prefetchedWindowLoads = 0
+        var hits = 0
+        var misses = 0
+        var evictions = 0
+        // Bytes of sample data the cache holds on to, counted from element sizes, not counting
+        // windows being evicted. This isn't the process footprint: VtValue and array overhead,
+        // and whatever the file format keeps cached, come on top
+        var residentBytes = 0
+        var peakResidentBytes = 0
+        // Time spent reading samples, on any thread
+        var loadDuration = Duration.zero
+    }
+
+    private struct Samples {
+        var times: [Double]
+        var values: [pxr.VtValue]
+    }
+
+    private struct Window {
+        // Indexed like `attributes`
+        var samples: [Samples]
+        var byteCount: Int
+        var lastUse: Int
+    }
+
+    private struct State {
+        var windows: [Int: Window] = [:]
+        // Windows being read, and what to wait on to get them
+        var loading: [Int: DispatchGroup] = [:]
+        var useCounter = 0
+        var statistics = Statistics()
+    }
+
+    let stage: pxr.UsdStage
+    let attributes: [pxr.UsdAttribute]
+    let windowLength: Double
+    let maximumResidentBytes: Int
+    private let attributeIndices: [pxr.SdfPath: Int]
+    private let elementSizes: [Int]
+    private let state = Mutex<State>(State())
+
+    // Tracks `attributes`, or every attribute on the stage that has time samples if `nil`
+    init(stage: pxr.UsdStage, attributes: [pxr.UsdAttribute]? = nil, windowLength: Double, maximumResidentBytes: Int) {
+        precondition(windowLength > 0, "Window length must be positive")
+        self.stage = stage
+        self.attributes = attributes ?? Self.timeSampledAttributes(stage)
+        self.windowLength = windowLength
+        self.maximumResidentBytes = maximumResidentBytes
+        self.attributeIndices = Dictionary(uniqueKeysWithValues: self.attributes.enumerated().map { ($1.GetPath(), $0) })
+        self.elementSizes = self.attributes.map { Int($0.GetTypeName().GetScalarType().GetType().GetSizeof()) }
+    }
+
+    // Opens the file without reading any samples
+    static func open(_ url: URL, windowLength: Double, maximumResidentBytes: Int) -> TimeWindowedSampleCache? {
+        let path = std.string(url.path(percentEncoded: false))
+        guard let stage = Overlay.DereferenceOrNil(pxr.UsdStage.Open(path, .LoadAll)) else { return nil }
+        return TimeWindowedSampleCache(stage: stage, windowLength: windowLength, maximumResidentBytes: maximumResidentBytes)
+    }
+
+    private static func timeSampledAttributes(_ stage: pxr.UsdStage) -> [pxr.UsdAttribute] {
+        var result = [pxr.UsdAttribute]()
+        for prim in stage.Traverse() {
+            for attr in prim.GetAttributes() where attr.ValueMightBeTimeVarying() {
+                result.append(attr)
+            }
+        }
+        return result
+    }
+
+    var statistics: Statistics {
+        state.withLock { $0.statistics }
+    }
+
+    var residentWindows: [Int] {
+        state.withLock { $0.windows.keys.sorted() }
+    }
+
+    // MARK: Reading
+
+    func window(containing time: Double) -> Int {
+        let start = stage.GetStartTimeCode()
+        return Int(((time - start) / windowLength).rounded(.down))
+    }
+
+    private func interval(ofWindow window: Int) -> (start: Double, end: Double) {
+        let start = stage.GetStartTimeCode() + Double(window) * windowLength
+        return (start, start + windowLength)
+    }
+
+    // The value of `attribute` at `time`, reading its window first if it isn't resident
+    func value(_ attribute: pxr.SdfPath, at time: Double) -> pxr.VtValue? {
+        guard let index = attributeIndices[attribute] else { return nil }
+        return Self.heldValue(samples(inWindow: window(containing: time))[index], at: time)
+    }
+
+    // Playback entry point: the value of every attribute in `attributes` at `time`,
+    // and starts prefetching the next window
+    func play(at time: Double) -> [pxr.VtValue?] {
+        let current = window(containing: time)
+        prefetch(window: current + 1)
+        return samples(inWindow: current).map { Self.heldValue($0, at: time) }
+    }
+
+    // Last sample at or before `time`. The sample holding at the window start is always first
+    private static func heldValue(_ samples: Samples, at time: Double) -> pxr.VtValue? {
+        var lo = 0, hi = samples.times.count
+        while lo < hi {
+            let mid = (lo + hi) / 2
+            if samples.times[mid] <= time { lo = mid + 1 } else { hi = mid }
+        }
+        return lo == 0 ? nil : samples.values[lo - 1]
+    }
+
+    // Starts reading `window` on a Work thread, unless it's already resident or being read.
+    // Windows past the stage's end time code are ignored
+    func prefetch(window: Int) {
+        guard interval(ofWindow: window).start <= stage.GetEndTimeCode() else { return }
+        let group = DispatchGroup()
+        let shouldLoad = state.withLock { state in
+            guard state.windows[window] == nil, state.loading[window] == nil else { return false }
+            group.enter()
+            state.loading[window] = group
+            return true
+        }
+        guard shouldLoad else { return }
+        pxr.WorkRunDetachedTask { [self] in
+            finishLoading(window, read(window: window), group: group, isPrefetch: true)
+        }
+    }
+
+    // Waits for any in-flight prefetches, e.g. before measuring memory
+    func waitForPrefetches() {
+        let groups = state.withLock { Array($0.loading.values) }
+        for group in groups {
+            group.wait()
+        }
+    }
+
+    private func samples(inWindow window: Int) -> [Samples] {
+        while true {
+            enum Next { case resident([Samples]), wait(DispatchGroup), load(DispatchGroup) }
+            let next: Next = state.withLock { state in
+                if var resident = state.windows[window] {
+                    state.useCounter += 1
+                    resident.lastUse = state.useCounter
+                    state.windows[window] = resident
+                    state.statistics.hits += 1
+                    return .resident(resident.samples)
+                }
+                if let group = state.loading[window] {
+                    return .wait(group)
+                }
+                state.statistics.misses += 1
+                let group = DispatchGroup()
+                group.enter()
+                state.loading[window] = group
+                return .load(group)
+            }
+
+            switch next {
+            case let .resident(samples):
+                return samples
+            case let .wait(group):
+                // Being read by a prefetch or another reader. Check again after it's done,
+                // because with a small budget it might already have been evicted
+                group.wait()
+            case let .load(group):
+                let loaded = read(window: window)
+                finishLoading(window, loaded, group: group, isPrefetch: false)
+                return loaded.samples
+            }
+        }
+    }
+
+    // Reads every tracked attribute's samples in `window`, without touching the cache state
+    private func read(window: Int) -> (samples: [Samples], byteCount: Int, duration: Duration) {
+        let start = ContinuousClock.now
+        let (windowStart, windowEnd) = interval(ofWindow: window)
+        var byteCount = 0
+        var result = [Samples]()
+        result.reserveCapacity(attributes.count)
+
+        for (attr, elementSize) in zip(attributes, elementSizes) {
+            var times = Overlay.Double_Vector()
+            attr.GetTimeSamplesInInterval(pxr.GfInterval(windowStart, windowEnd, true, false), &times)
+            var samples = Samples(times: [], values: [])
+            // The sample holding at the window start, unless there's a sample exactly there.
+            // Reading at the window start itself would interpolate between the bracketing samples
+            // for attributes with linear interpolation, which isn't what a held read returns
+            if times.first != windowStart {
+                var lower = 0.0, upper = 0.0, hasTimeSamples = false
+                attr.GetBracketingTimeSamples(windowStart, &lower, &upper, &hasTimeSamples)
+                if hasTimeSamples && lower < windowStart {
+                    samples.times.append(lower)
+                } else {
+                    // Before the first sample, or without samples, the first sample or the default holds
+                    // for all earlier times. Both read the same at any time before the first sample
+                    samples.times.append(-.infinity)
+                }
+            }
+            samples.times.append(contentsOf: times)
+            samples.values = samples.times.map { time in
+                var value = pxr.VtValue()
+                attr.Get(&value, time == -.infinity ? pxr.UsdTimeCode(windowStart) : pxr.UsdTimeCode(time))
+                byteCount += elementSize * max(1, Int(value.GetArraySize()))
+                return value
+            }
+            result.append(samples)
+        }
+        return (result, byteCount, ContinuousClock.now - start)
+    }
+
+    private func finishLoading(_ window: Int, _ loaded: (samples: [Samples], byteCount: Int, duration: Duration), group: DispatchGroup, isPrefetch: Bool) {
+        state.withLock { state in
+            state.useCounter += 1
+            state.windows[window] = Window(samples: loaded.samples, byteCount: loaded.byteCount, lastUse: state.useCounter)
+            state.loading[window] = nil
+            state.statistics.residentBytes += loaded.byteCount
+            state.statistics.loadDuration += loaded.duration
+            if isPrefetch {
+                state.statistics.prefetchedWindowLoads += 1
+            } else {
+                state.statistics.windowLoads += 1
+            }
+            evict(&state, keeping: window)
+            state.statistics.peakResidentBytes = max(state.statistics.peakResidentBytes, state.statistics.residentBytes)
+        }
+        group.leave()
+    }
+
+    private func evict(_ state: inout State, keeping window: Int) {
+        while state.statistics.residentBytes > maximumResidentBytes {
+            guard let victim = state.windows.filter({ $0.key != window }).min(by: { $0.value.lastUse < $1.value.lastUse }) else {
+                return
+            }
+            state.windows[victim.key] = nil
+            state.statistics.residentBytes -= victim.value.byteCount
+            state.statistics.evictions += 1
+        }
+    }
+}
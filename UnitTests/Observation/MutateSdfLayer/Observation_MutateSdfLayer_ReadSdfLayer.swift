@@ -29,7 +29,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasField("/", "startTimeCode", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/", "startTimeCode", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetField("/", "startTimeCode", pxr.VtValue(17.0 as Double)))
@@ -40,7 +40,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        var (token, value) = registerNotification(layer.GetField("/", "endTimeCode"))
+        var (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/", "endTimeCode"))
         XCTAssertEqual(value.Get(), 0.0)
         
         expectingSomeNotifications([token], layer.SetField("/", "endTimeCode", pxr.VtValue(17.0 as Double)))
@@ -52,7 +52,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.IsDirty())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.IsDirty())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetField("/", "endTimeCode", pxr.VtValue(17.0 as Double)))
@@ -67,7 +67,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
 
         layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub1.usda")))
         
-        let (token, value) = registerNotification(layer.GetExpressionVariables())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetExpressionVariables())
         XCTAssertEqual(value.size(), 1)
         XCTAssertEqual(value["WHICH_SUBLAYER"], pxr.VtValue(pathForStage(named: "Sub1.usda")))
 
@@ -85,7 +85,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetStartTimeCode(7)
         
-        let (token, value) = registerNotification(layer.ListFields("/"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/"))
         XCTAssertEqual(value, ["startTimeCode"])
         
         expectingSomeNotifications([token], layer.EraseField("/", "startTimeCode"))
@@ -100,7 +100,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
 
         layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub1.usda")))
         
-        let (token, value) = registerNotification(layer.GetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
         XCTAssertEqual(value, pxr.VtValue(pathForStage(named: "Sub1.usda")))
 
         
@@ -114,7 +114,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(layer.HasColorConfiguration())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasColorConfiguration())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetColorConfiguration(pxr.SdfAssetPath("fizz")))
@@ -129,7 +129,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         
         layer.SetColorConfiguration(pxr.SdfAssetPath("foo"))
 
-        let (token, value) = registerNotification(layer.GetColorConfiguration())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetColorConfiguration())
         XCTAssertEqual(value, pxr.SdfAssetPath("foo"))
         
         expectingSomeNotifications([token], layer.ClearColorConfiguration())
@@ -142,7 +142,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(layer.GetColorManagementSystem())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetColorManagementSystem())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], layer.SetColorManagementSystem("fizz"))
@@ -156,7 +156,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetColorManagementSystem("buzz")
 
-        let (token, value) = registerNotification(layer.GetColorManagementSystem())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetColorManagementSystem())
         XCTAssertEqual(value, "buzz")
         
         expectingSomeNotifications([token], layer.ClearColorManagementSystem())
@@ -169,7 +169,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(layer.GetComment())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetComment())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], layer.SetComment("hello"))
@@ -184,7 +184,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         main.DefinePrim("/foo", "Cube")
         
 
-        let (token, value) = registerNotification(layer.HasDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasDefaultPrim())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetDefaultPrim("foo"))
@@ -200,7 +200,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.SetDefaultPrim("foo")
         
 
-        let (token, value) = registerNotification(layer.GetDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetDefaultPrim())
         XCTAssertEqual(value, "foo")
         
         expectingSomeNotifications([token], layer.ClearDefaultPrim())
@@ -213,7 +213,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetDocumentation())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetDocumentation())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], layer.SetDocumentation("fizzbuzz"))
@@ -226,7 +226,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetStartTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], layer.SetStartTimeCode(2.718))
@@ -237,7 +237,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasStartTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasStartTimeCode())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetStartTimeCode(2.718))
@@ -251,7 +251,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetStartTimeCode(7)
         
-        let (token, value) = registerNotification(layer.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetStartTimeCode())
         XCTAssertEqual(value, 7)
         
         expectingSomeNotifications([token], layer.ClearStartTimeCode())
@@ -263,7 +263,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetStartTimeCode(7)
         
-        let (token, value) = registerNotification(layer.HasStartTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasStartTimeCode())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearStartTimeCode())
@@ -276,7 +276,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetEndTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetEndTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], layer.SetEndTimeCode(2.718))
@@ -287,7 +287,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasEndTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasEndTimeCode())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetEndTimeCode(2.718))
@@ -301,7 +301,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetEndTimeCode(4)
         
-        let (token, value) = registerNotification(layer.GetEndTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetEndTimeCode())
         XCTAssertEqual(value, 4)
         
         expectingSomeNotifications([token], layer.ClearEndTimeCode())
@@ -313,7 +313,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetEndTimeCode(4)
         
-        let (token, value) = registerNotification(layer.HasEndTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasEndTimeCode())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearEndTimeCode())
@@ -326,7 +326,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetTimeCodesPerSecond())
         XCTAssertEqual(value, 24)
         
         expectingSomeNotifications([token], layer.SetTimeCodesPerSecond(19))
@@ -337,7 +337,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasTimeCodesPerSecond())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetTimeCodesPerSecond(19))
@@ -351,7 +351,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetTimeCodesPerSecond(4)
         
-        let (token, value) = registerNotification(layer.GetTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetTimeCodesPerSecond())
         XCTAssertEqual(value, 4)
         
         expectingSomeNotifications([token], layer.ClearTimeCodesPerSecond())
@@ -363,7 +363,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetTimeCodesPerSecond(4)
         
-        let (token, value) = registerNotification(layer.HasTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasTimeCodesPerSecond())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearTimeCodesPerSecond())
@@ -376,7 +376,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFramesPerSecond())
         XCTAssertEqual(value, 24)
         
         expectingSomeNotifications([token], layer.SetFramesPerSecond(19))
@@ -387,7 +387,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFramesPerSecond())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetFramesPerSecond(19))
@@ -401,7 +401,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetFramesPerSecond(5)
         
-        let (token, value) = registerNotification(layer.GetFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFramesPerSecond())
         XCTAssertEqual(value, 5)
         
         expectingSomeNotifications([token], layer.ClearFramesPerSecond())
@@ -413,7 +413,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetFramesPerSecond(5)
         
-        let (token, value) = registerNotification(layer.HasFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFramesPerSecond())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearFramesPerSecond())
@@ -426,7 +426,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetFramePrecision())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFramePrecision())
         XCTAssertEqual(value, 3)
         
         expectingSomeNotifications([token], layer.SetFramePrecision(6))
@@ -437,7 +437,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasFramePrecision())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFramePrecision())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetFramePrecision(6))
@@ -451,7 +451,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         layer.SetFramePrecision(5)
         
-        let (token, value) = registerNotification(layer.GetFramePrecision())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFramePrecision())
         XCTAssertEqual(value, 5)
         
         expectingSomeNotifications([token], layer.ClearFramePrecision())
@@ -463,7 +463,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         layer.SetFramePrecision(5)
         
-        let (token, value) = registerNotification(layer.HasFramePrecision())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFramePrecision())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearFramePrecision())
@@ -476,7 +476,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetOwner())
         XCTAssertEqual(value, "")
 
         expectingSomeNotifications([token], layer.SetOwner("foo"))
@@ -487,7 +487,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasOwner())
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], layer.SetOwner("foo"))
@@ -501,7 +501,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         layer.SetOwner("foo")
         
-        let (token, value) = registerNotification(layer.GetOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetOwner())
         XCTAssertEqual(value, "foo")
 
         expectingSomeNotifications([token], layer.ClearOwner())
@@ -513,7 +513,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         layer.SetOwner("foo")
         
-        let (token, value) = registerNotification(layer.HasOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasOwner())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.ClearOwner())
@@ -526,7 +526,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetSessionOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSessionOwner())
         XCTAssertEqual(value, "")
 
         expectingSomeNotifications([token], layer.SetSessionOwner("foo"))
@@ -537,7 +537,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasSessionOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSessionOwner())
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], layer.SetSessionOwner("foo"))
@@ -551,7 +551,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         layer.SetSessionOwner("foo")
         
-        let (token, value) = registerNotification(layer.GetSessionOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSessionOwner())
         XCTAssertEqual(value, "foo")
 
         expectingSomeNotifications([token], layer.ClearSessionOwner())
@@ -563,7 +563,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         layer.SetSessionOwner("foo")
         
-        let (token, value) = registerNotification(layer.HasSessionOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSessionOwner())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.ClearSessionOwner())
@@ -576,7 +576,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetHasOwnedSubLayers())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetHasOwnedSubLayers())
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], layer.SetHasOwnedSubLayers(true))
@@ -589,7 +589,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetCustomLayerData())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetCustomLayerData())
         XCTAssertEqual(value.size(), 0)
 
         var dict = pxr.VtDictionary()
@@ -604,7 +604,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasCustomLayerData())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasCustomLayerData())
         XCTAssertFalse(value)
 
         var dict = pxr.VtDictionary()
@@ -624,7 +624,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.SetCustomLayerData(dict)
 
         
-        let (token, value) = registerNotification(layer.GetCustomLayerData())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetCustomLayerData())
         XCTAssertEqual(value.size(), 1)
         XCTAssertEqual(value["foo"], pxr.VtValue("bar" as std.string))
 
@@ -641,7 +641,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.SetCustomLayerData(dict)
 
         
-        let (token, value) = registerNotification(layer.HasCustomLayerData())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasCustomLayerData())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.ClearCustomLayerData())
@@ -654,7 +654,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetExpressionVariables())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetExpressionVariables())
         XCTAssertEqual(value.size(), 0)
         
         var dict = pxr.VtDictionary()
@@ -670,7 +670,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasExpressionVariables())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasExpressionVariables())
         XCTAssertFalse(value)
         
         var dict = pxr.VtDictionary()
@@ -690,7 +690,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.SetExpressionVariables(dict)
 
         
-        let (token, value) = registerNotification(layer.GetExpressionVariables())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetExpressionVariables())
         XCTAssertEqual(value.size(), 1)
         XCTAssertEqual(value["foo"], pxr.VtValue("bar" as std.string))
         
@@ -707,7 +707,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.SetExpressionVariables(dict)
         
 
-        let (token, value) = registerNotification(layer.HasExpressionVariables())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasExpressionVariables())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearExpressionVariables())
@@ -724,7 +724,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         withExtendedLifetime(model) {}
         
         
-        let (token, value) = registerNotification(layer.GetCompositionAssetDependencies())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetCompositionAssetDependencies())
         XCTAssertEqual(Array(value), [])
         
         expectingSomeNotifications([token], layer.SetSubLayerPaths([pathForStage(named: "Model.usda")]))
@@ -739,7 +739,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         withExtendedLifetime(model) {}
         
         
-        let (token, value) = registerNotification(layer.GetSubLayerPaths())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSubLayerPaths())
         XCTAssertEqual(Array(value), [])
         
         expectingSomeNotifications([token], layer.SetSubLayerPaths([pathForStage(named: "Model.usda")]))
@@ -754,7 +754,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         withExtendedLifetime(model) {}
         
         
-        let (token, value) = registerNotification(layer.GetNumSubLayerPaths())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetNumSubLayerPaths())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], layer.SetSubLayerPaths([pathForStage(named: "Model.usda")]))
@@ -770,7 +770,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let model = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Model.usda"), Overlay.UsdStage.LoadAll))
         withExtendedLifetime(model) {}
 
-        let (token, value) = registerNotification(layer.GetSubLayerOffsets())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSubLayerOffsets())
         XCTAssertEqual(Array(value), [])
         
         expectingSomeNotifications([token], layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0))
@@ -784,7 +784,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.InsertSubLayerPath("/foo.usda", 0)
         layer.SetSubLayerOffset(pxr.SdfLayerOffset(2, 3), 0)
 
-        let (token, value) = registerNotification(layer.GetSubLayerOffset(0))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSubLayerOffset(0))
         XCTAssertEqual(value, pxr.SdfLayerOffset(2, 3))
         
         expectingSomeNotifications([token], layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0))
@@ -802,7 +802,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.SetSubLayerPaths([pathForStage(named: "Model.usda")])
         
         
-        let (token, value) = registerNotification(layer.GetSubLayerPaths())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSubLayerPaths())
         XCTAssertEqual(Array(value), [pxr.SdfAssetPath(pathForStage(named: "Model.usda"))])
         
         expectingSomeNotifications([token], layer.RemoveSubLayerPath(0))
@@ -819,7 +819,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         withExtendedLifetime(model) {}
         layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0)
 
-        let (token, value) = registerNotification(layer.GetSubLayerOffset(0))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSubLayerOffset(0))
         XCTAssertEqual(value, pxr.SdfLayerOffset(0, 1))
         
         expectingSomeNotifications([token], layer.SetSubLayerOffset(pxr.SdfLayerOffset(2, 3), 0))
@@ -829,10 +829,12 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
     // MARK: SetPermissionToSave
     
     func test_SetPermissionToSave_PermissionToSave() {
+        expectingUnobservableMutation("SdfLayer.SetPermissionToSave doesn't send a notice")
+        
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.PermissionToSave())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.PermissionToSave())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.SetPermissionToSave(false))
@@ -842,10 +844,12 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
     // MARK: SetPermissionToEdit
     
     func test_SetPermissionToEdit_PermissionToEdit() {
+        expectingUnobservableMutation("SdfLayer.SetPermissionToEdit doesn't send a notice")
+        
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.PermissionToEdit())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.PermissionToEdit())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.SetPermissionToEdit(false))
@@ -861,7 +865,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         main.DefinePrim("/beta", "Sphere")
         
         
-        let (token, value) = registerNotification(layer.HasSpec("/beta"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/beta"))
         XCTAssertTrue(value)
         
         var batchEdit = pxr.SdfBatchNamespaceEdit()
@@ -873,10 +877,12 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
     // MARK: SetStateDelegate
     
     func test_SetStateDelegate_GetStateDelegate() {
+        expectingUnobservableMutation("SdfLayer.SetStateDelegate doesn't send a notice")
+        
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(layer.GetStateDelegate())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetStateDelegate())
         
         let delegateForSetting = pxr.SdfSimpleLayerStateDelegate.New()
         expectingSomeNotifications([token], layer.SetStateDelegate(Overlay.TfRefPtr(Overlay.DereferenceOrNil(delegateForSetting)?.as())))
@@ -893,7 +899,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let light = pxr.UsdLuxDomeLight.Define(Overlay.TfWeakPtr(main), "/foo")
         light.GetTextureFileAttr().Set(pxr.SdfAssetPath("buzz"), 1.0)
         
-        let (token, value) = registerNotification(layer.ListAllTimeSamples())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListAllTimeSamples())
         XCTAssertEqual(Array(value), [1])
         
         expectingSomeNotifications([token], layer.SetTimeSample("/foo.inputs:texture:file", 2.0, pxr.SdfAssetPath("/fizz")))
@@ -906,7 +912,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let light = pxr.UsdLuxDomeLight.Define(Overlay.TfWeakPtr(main), "/foo")
         light.GetTextureFileAttr().Set(pxr.SdfAssetPath("buzz"), 1.0)
         
-        let (token, value) = registerNotification(layer.ListTimeSamplesForPath("/foo.inputs:texture:file"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListTimeSamplesForPath("/foo.inputs:texture:file"))
         XCTAssertEqual(Array(value), [1])
         
         expectingSomeNotifications([token], layer.SetTimeSample("/foo.inputs:texture:file", 2.0, pxr.SdfAssetPath("/fizz")))
@@ -919,7 +925,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let light = pxr.UsdLuxDomeLight.Define(Overlay.TfWeakPtr(main), "/foo")
         light.GetTextureFileAttr().Set(pxr.SdfAssetPath("buzz"), 1.0)
         
-        let (token, value) = registerNotification(layer.GetNumTimeSamplesForPath("/foo.inputs:texture:file"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetNumTimeSamplesForPath("/foo.inputs:texture:file"))
         XCTAssertEqual(value, 1)
         
         expectingSomeNotifications([token], layer.SetTimeSample("/foo.inputs:texture:file", 2.0, pxr.SdfAssetPath("/fizz")))
@@ -933,7 +939,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         light.GetTextureFileAttr().Set(pxr.SdfAssetPath("buzz"), 1.0)
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(layer.QueryTimeSample("/foo.inputs:texture:file", 2.0, &vtValue))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.QueryTimeSample("/foo.inputs:texture:file", 2.0, &vtValue))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetTimeSample("/foo.inputs:texture:file", 2.0, pxr.SdfAssetPath("/fizz")))
@@ -949,7 +955,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let light = pxr.UsdLuxDomeLight.Define(Overlay.TfWeakPtr(main), "/foo")
         light.GetTextureFileAttr().Set(pxr.SdfAssetPath("buzz"), 1.0)
         
-        let (token, value) = registerNotification(layer.ListAllTimeSamples())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListAllTimeSamples())
         XCTAssertEqual(Array(value), [1])
         
         expectingSomeNotifications([token], layer.EraseTimeSample("/foo.inputs:texture:file", 1))
@@ -963,7 +969,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         light.GetTextureFileAttr().Set(pxr.SdfAssetPath("buzz"), 1.0)
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(layer.QueryTimeSample("/foo.inputs:texture:file", 1, &vtValue))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.QueryTimeSample("/foo.inputs:texture:file", 1, &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue(pxr.SdfAssetPath("buzz")))
 
@@ -980,7 +986,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let other = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Other.usda"), Overlay.UsdStage.LoadAll))
         other.SetStartTimeCode(2.718)
         
-        let (token, value) = registerNotification(layer.HasStartTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasStartTimeCode())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.TransferContent(other.GetRootLayer()))
@@ -996,7 +1002,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         main.DefinePrim("/foo", "Sphere")
         main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(layer.GetRootPrims().keys())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetRootPrims().keys())
         XCTAssertEqual(value, ["foo", "bar"])
         
         expectingSomeNotifications([token], layer.SetRootPrims([layer.GetPrimAtPath("/bar"), layer.GetPrimAtPath("/foo")]))
@@ -1012,7 +1018,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         main.DefinePrim("/foo", "Sphere")
         main.DefinePrim("/foo/bar", "Sphere")
         
-        let (token, value) = registerNotification(layer.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ExportToString())
         XCTAssertEqual(value!, #"""
         #usda 1.0
 
@@ -1051,7 +1057,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         main.DefinePrim("/foo", "Sphere")
         main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(Array(layer.GetRootPrims().keys()))
+        let (token, value) = registerNotification(reading: [.of(layer)], Array(layer.GetRootPrims().keys()))
         XCTAssertEqual(value, ["foo", "bar"])
         
         expectingSomeNotifications([token], layer.RemoveRootPrim(layer.GetPrimAtPath("/bar")))
@@ -1065,7 +1071,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.OverridePrim("/foo")
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ScheduleRemoveIfInert(layer.GetObjectAtPath("/foo").GetSpec()))
@@ -1079,7 +1085,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.OverridePrim("/foo")
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemovePrimIfInert(layer.GetPrimAtPath("/foo")))
@@ -1094,7 +1100,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         main.OverridePrim("/foo").CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo.myAttr"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo.myAttr"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemovePropertyIfHasOnlyRequiredFields(layer.GetPropertyAtPath("/foo.myAttr")))
@@ -1109,7 +1115,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         main.OverridePrim("/foo")
         
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemoveInertSceneDescription())
@@ -1126,7 +1132,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         main.DefinePrim("/bar", "Sphere")
         
         
-        let (token, value) = registerNotification(Array(layer.GetRootPrimOrder()))
+        let (token, value) = registerNotification(reading: [.of(layer)], Array(layer.GetRootPrimOrder()))
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], layer.SetRootPrimOrder(["bar", "foo"]))
@@ -1144,7 +1150,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.SetRootPrimOrder(["foo"])
         
         
-        let (token, value) = registerNotification(Array(layer.GetRootPrimOrder()))
+        let (token, value) = registerNotification(reading: [.of(layer)], Array(layer.GetRootPrimOrder()))
         XCTAssertEqual(value, ["foo"])
 
         expectingSomeNotifications([token], layer.InsertInRootPrimOrder("bar", 0))
@@ -1162,7 +1168,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.SetRootPrimOrder(["bar", "foo"])
         
         
-        let (token, value) = registerNotification(Array(layer.GetRootPrimOrder()))
+        let (token, value) = registerNotification(reading: [.of(layer)], Array(layer.GetRootPrimOrder()))
         XCTAssertEqual(value, ["bar", "foo"])
 
         expectingSomeNotifications([token], layer.RemoveFromRootPrimOrder("bar"))
@@ -1180,7 +1186,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         layer.SetRootPrimOrder(["bar", "foo"])
         
         
-        let (token, value) = registerNotification(Array(layer.GetRootPrimOrder()))
+        let (token, value) = registerNotification(reading: [.of(layer)], Array(layer.GetRootPrimOrder()))
         XCTAssertEqual(value, ["bar", "foo"])
 
         expectingSomeNotifications([token], layer.RemoveFromRootPrimOrderByIndex(0))
@@ -1195,7 +1201,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
 
         main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(layer.IsDirty())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.IsDirty())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Save(true))
@@ -1208,7 +1214,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], layer.ImportFromString(std.string(#"""
@@ -1231,7 +1237,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
 
         main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Clear())
@@ -1246,7 +1252,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
 
         main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.Reload(true))
@@ -1262,7 +1268,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
 
         main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.Import(pathForStage(named: "Empty.usda")))
@@ -1277,7 +1283,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
 
         main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], pxr.SdfLayer.ReloadLayers([main.GetRootLayer()], true))
@@ -1292,7 +1298,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         
         main.Save()
 
-        let (token, value) = registerNotification(layer.GetIdentifier())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetIdentifier())
         XCTAssertEqual(value, pathForStage(named: "Main.usda"))
         
         expectingSomeNotifications([token], layer.SetIdentifier(pathForStage(named: "NewMain.usda")))
@@ -1308,7 +1314,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         
         
-        let (token, value) = registerNotification(layer.IsMuted())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.IsMuted())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetMuted(true))
@@ -1321,7 +1327,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(Array(pxr.SdfLayer.GetMutedLayers()))
+        let (token, value) = registerNotification(reading: [.mutedLayers], Array(pxr.SdfLayer.GetMutedLayers()))
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], layer.SetMuted(true))
@@ -1336,7 +1342,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         
         let path = pathForStage(named: "Main.usda")
         
-        let (token, value) = registerNotification(pxr.SdfLayer.IsMuted(path))
+        let (token, value) = registerNotification(reading: [.mutedLayers], pxr.SdfLayer.IsMuted(path))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetMuted(true))
@@ -1351,7 +1357,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(layer.IsMuted())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.IsMuted())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.AddToMutedLayers(pathForStage(named: "Main.usda")))
@@ -1361,7 +1367,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
     func test_AddToMutedLayers_GetMutedLayers() {
         for l in pxr.SdfLayer.GetMutedLayers() { pxr.SdfLayer.RemoveFromMutedLayers(l) }
         
-        let (token, value) = registerNotification(Array(pxr.SdfLayer.GetMutedLayers()))
+        let (token, value) = registerNotification(reading: [.mutedLayers], Array(pxr.SdfLayer.GetMutedLayers()))
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], pxr.SdfLayer.AddToMutedLayers("foo"))
@@ -1373,7 +1379,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
                 
         let path = pathForStage(named: "Main.usda")
 
-        let (token, value) = registerNotification(pxr.SdfLayer.IsMuted(path))
+        let (token, value) = registerNotification(reading: [.mutedLayers], pxr.SdfLayer.IsMuted(path))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.AddToMutedLayers(pathForStage(named: "Main.usda")))
@@ -1389,7 +1395,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         
         layer.SetMuted(true)
-        let (token, value) = registerNotification(layer.IsMuted())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.IsMuted())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.RemoveFromMutedLayers(pathForStage(named: "Main.usda")))
@@ -1400,7 +1406,7 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         for l in pxr.SdfLayer.GetMutedLayers() { pxr.SdfLayer.RemoveFromMutedLayers(l) }
         
         pxr.SdfLayer.AddToMutedLayers("foo")
-        let (token, value) = registerNotification(Array(pxr.SdfLayer.GetMutedLayers()))
+        let (token, value) = registerNotification(reading: [.mutedLayers], Array(pxr.SdfLayer.GetMutedLayers()))
         XCTAssertEqual(value, ["foo"])
         
         expectingSomeNotifications([token], pxr.SdfLayer.RemoveFromMutedLayers("foo"))
@@ -1413,12 +1419,26 @@ final class Observation_MutateSdfLayer_ReadSdfLayer: ObservationHelper {
         let path = pathForStage(named: "Main.usda")
         
         pxr.SdfLayer.AddToMutedLayers(path)
-        let (token, value) = registerNotification(pxr.SdfLayer.IsMuted(path))
+        let (token, value) = registerNotification(reading: [.mutedLayers], pxr.SdfLayer.IsMuted(path))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.RemoveFromMutedLayers(pathForStage(named: "Main.usda")))
         XCTAssertFalse(pxr.SdfLayer.IsMuted(path))
     }
+    
+    // MARK: Unrelated reads
+    
+    func test_SetDocumentation_unrelatedLayersStaySilent() {
+        let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
+        let other = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Other.usda"), Overlay.UsdStage.LoadAll))
+        let layer = Overlay.Dereference(main.GetRootLayer())
+        let otherLayer = Overlay.Dereference(other.GetRootLayer())
+        
+        let (layerToken, _) = registerNotification(reading: [.of(layer)], layer.GetDocumentation())
+        let (otherLayerToken, _) = registerNotification(reading: [.of(otherLayer)], otherLayer.GetDocumentation())
+        let (otherToken, _) = registerNotification(reading: [.of(other)], other.ExportToString())
+        
+        expectingOnlyNotifications([layerToken], layer.SetDocumentation("foo"))
+        withExtendedLifetime((otherLayerToken, otherToken)) {}
+    }
 }
-
-
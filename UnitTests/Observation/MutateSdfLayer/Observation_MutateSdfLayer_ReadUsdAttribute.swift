@@ -33,7 +33,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         let attr = p.GetAttribute("radius")
         attr.Set(5.0, 1.0)
                 
-        let (token, value) = registerNotification(attr.GetColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetColorSpace())
         XCTAssertEqual(value, "")
                 
         expectingSomeNotifications([token], layer.SetField("/foo.radius", "colorSpace", pxr.VtValue("fizzbuzz" as pxr.TfToken)))
@@ -58,7 +58,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         attrOver.Set(["foo"] as pxr.VtTokenArray, .Default())
 
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub2.usda"))))
@@ -75,7 +75,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         attr.SetVariability(Overlay.SdfVariabilityUniform)
 
         
-        let (token, value) = registerNotification(attr.GetVariability())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetVariability())
         XCTAssertEqual(value, Overlay.SdfVariabilityUniform)
         
         expectingSomeNotifications([token], layer.EraseField("/foo.myAttr", "variability"))
@@ -99,7 +99,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         attrOver.Set(["foo"] as pxr.VtTokenArray, .Default())
 
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
@@ -121,7 +121,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         overAttr.SetColorSpace("foobar")
 
         
-        let (token, value) = registerNotification(attr.HasColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasColorSpace())
         XCTAssertFalse(value)
         
         var dict = pxr.VtDictionary()
@@ -145,7 +145,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         overAttr.SetColorSpace("foo")
 
         
-        let (token, value) = registerNotification(attr.GetColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetColorSpace())
         XCTAssertEqual(value, "foo")
         
         expectingSomeNotifications([token], layer.ClearExpressionVariables())
@@ -170,7 +170,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         layer.SetSubLayerPaths([pathForStage(named: "Model2.usda"), pathForStage(named: "Model1.usda")])
         
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, 6.0))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.Get(&radius, 6.0))
         XCTAssertTrue(value)
         XCTAssertEqual(radius, 7.0)
         
@@ -192,7 +192,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
 
         
         var connections = pxr.SdfPathVector()
-        let (token, value) = registerNotification(attr.GetConnections(&connections))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetConnections(&connections))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0))
@@ -212,7 +212,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         model.OverridePrim("/foo").CreateAttribute("fizzy", .Bool, true, Overlay.SdfVariabilityUniform)
         
         
-        let (token, value) = registerNotification(attr.GetVariability())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetVariability())
         XCTAssertEqual(value, Overlay.SdfVariabilityUniform)
         
         expectingSomeNotifications([token], layer.RemoveSubLayerPath(0))
@@ -234,7 +234,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         overAttr.Set(9.0, 4.0)
         
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, 3.0))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.Get(&radius, 3.0))
         XCTAssertTrue(value)
         XCTAssertEqual(7, radius)
 
@@ -253,7 +253,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         attr.Set(pxr.SdfAssetPath("buzz"), 1.0)
         
         var assetPath = pxr.SdfAssetPath()
-        let (token, value) = registerNotification(attr.Get(&assetPath, 2.0))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.Get(&assetPath, 2.0))
         XCTAssertTrue(value)
         XCTAssertEqual(assetPath, pxr.SdfAssetPath("buzz"))
         
@@ -271,7 +271,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         let attr = light.GetTextureFileAttr()
         attr.Set(pxr.SdfAssetPath("buzz"), 1.0)
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseTimeSample("/foo.inputs:texture:file", 1.0))
@@ -290,7 +290,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         otherAttr.Set(6.0, 2)
         
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, 2))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.Get(&radius, 2))
         XCTAssertTrue(value)
         XCTAssertEqual(radius, 1)
         
@@ -308,7 +308,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, 2))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.Get(&radius, 2))
         XCTAssertTrue(value)
         XCTAssertEqual(radius, 1)
         
@@ -346,7 +346,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         let overAttr = sub.OverridePrim("/foo").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         overAttr.Set(5.0, 2.0)
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.Clear())
@@ -366,7 +366,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         let overAttr = sub.OverridePrim("/foo").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         overAttr.Set(5.0, 2.0)
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.Reload(true))
@@ -387,7 +387,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         let overAttr = sub.OverridePrim("/foo").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         overAttr.Set(5.0, 2.0)
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.Import(pathForStage(named: "Empty.usda")))
@@ -406,7 +406,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         let overAttr = sub.OverridePrim("/foo").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         overAttr.Set(5.0, 2.0)
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.ReloadLayers([sub.GetRootLayer()], true))
@@ -426,7 +426,7 @@ final class Observation_MutateSdfLayer_ReadUsdAttribute: ObservationHelper {
         let overAttr = sub.OverridePrim("/foo").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         overAttr.Set(5.0, 2.0)
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.SetIdentifier(pathForStage(named: "NewSub.usda")))
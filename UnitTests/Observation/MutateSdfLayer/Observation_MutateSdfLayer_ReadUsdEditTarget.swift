@@ -39,7 +39,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         sub1 = Overlay.Dereference(pxr.UsdStage.CreateInMemory(Overlay.UsdStage.LoadAll))
 
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub2.usda"))))
@@ -62,7 +62,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         sub1 = Overlay.Dereference(pxr.UsdStage.CreateInMemory(Overlay.UsdStage.LoadAll))
 
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
@@ -85,7 +85,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         sub1 = Overlay.Dereference(pxr.UsdStage.CreateInMemory(Overlay.UsdStage.LoadAll))
 
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         var dict = pxr.VtDictionary()
@@ -110,7 +110,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         sub1 = Overlay.Dereference(pxr.UsdStage.CreateInMemory(Overlay.UsdStage.LoadAll))
 
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearExpressionVariables())
@@ -131,7 +131,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         let editTarget = main.GetEditTarget()
         
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.SetSubLayerPaths([]))
@@ -152,7 +152,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         let editTarget = main.GetEditTarget()
         
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.RemoveSubLayerPath(0))
@@ -171,7 +171,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         model = nil
         let editTarget = main.GetEditTarget()
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ImportFromString(std.string(#"""
@@ -194,7 +194,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         model = nil
         let editTarget = main.GetEditTarget()
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Clear())
@@ -213,7 +213,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         model = nil
         let editTarget = main.GetEditTarget()
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Reload(true))
@@ -233,7 +233,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         model = nil
         let editTarget = main.GetEditTarget()
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Import(pathForStage(named: "Empty.usda")))
@@ -252,7 +252,7 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
         model = nil
         let editTarget = main.GetEditTarget()
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.ReloadLayers([main.GetRootLayer()], true))
@@ -262,10 +262,12 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
     // MARK: dtor
     
     func test_dtor_IsValid() {
+        expectingUnobservableMutation("USD doesn't send a notice when a stage or layer is destroyed")
+        
         var l: pxr.SdfLayer? = Overlay.Dereference(pxr.SdfLayer.CreateNew(pathForStage(named: "Main.usda"), pxr.SdfLayer.FileFormatArguments()))
         let target = pxr.UsdEditTarget(Overlay.TfWeakPtr(l!), pxr.SdfLayerOffset(0, 1))
         
-        let (token, value) = registerNotification(target.IsValid())
+        let (token, value) = registerNotification(reading: [.of(target)], target.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], l = nil)
@@ -273,10 +275,12 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
     }
     
     func test_dtor_GetLayer() {
+        expectingUnobservableMutation("USD doesn't send a notice when a stage or layer is destroyed")
+        
         var l: pxr.SdfLayer? = Overlay.Dereference(pxr.SdfLayer.CreateNew(pathForStage(named: "Main.usda"), pxr.SdfLayer.FileFormatArguments()))
         let target = pxr.UsdEditTarget(Overlay.TfWeakPtr(l!), pxr.SdfLayerOffset(0, 1))
         
-        let (token, value) = registerNotification(Bool(target.GetLayer()))
+        let (token, value) = registerNotification(reading: [.of(target)], Bool(target.GetLayer()))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], l = nil)
@@ -284,11 +288,13 @@ final class Observation_MutateSdfLayer_ReadUsdEditTarget: ObservationHelper {
     }
     
     func test_dtor_TfWeakPtr_operatorBool() {
+        expectingUnobservableMutation("USD doesn't send a notice when a stage or layer is destroyed")
+        
         var l: pxr.SdfLayer? = Overlay.Dereference(pxr.SdfLayer.CreateNew(pathForStage(named: "Main.usda"), pxr.SdfLayer.FileFormatArguments()))
         let target = pxr.UsdEditTarget(Overlay.TfWeakPtr(l!), pxr.SdfLayerOffset(0, 1))
         let editTargetsLayer = target.GetLayer()
         
-        let (token, value) = registerNotification(Bool(editTargetsLayer))
+        let (token, value) = registerNotification(reading: [.of(target)], Bool(editTargetsLayer))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], l = nil)
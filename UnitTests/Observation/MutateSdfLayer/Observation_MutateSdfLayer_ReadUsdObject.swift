@@ -31,7 +31,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         
         let p = main.DefinePrim("/foo", "Sphere")
                 
-        let (token, value) = registerNotification(p.GetDisplayName())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetDisplayName())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], layer.SetField("/foo", "displayName", pxr.VtValue("fizzbuzz" as std.string)))
@@ -44,7 +44,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         
         let p = main.DefinePrim("/foo", "Sphere")
                 
-        let (token, value) = registerNotification(p.HasAuthoredDisplayName())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredDisplayName())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetField("/foo", "displayName", pxr.VtValue("fizzbuzz" as std.string)))
@@ -69,7 +69,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
 
         
         var metadataOut = pxr.VtValue()
-        let (token, value) = registerNotification(p.GetMetadataByDictKey("assetInfo", "name", &metadataOut))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetMetadataByDictKey("assetInfo", "name", &metadataOut))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub2.usda"))))
@@ -86,7 +86,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetAssetInfoByKey("name", pxr.VtValue("foo" as std.string))
                 
-        let (token, value) = registerNotification(p.HasAuthoredMetadataDictKey("assetInfo", "name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadataDictKey("assetInfo", "name"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseField("/foo", "assetInfo"))
@@ -109,7 +109,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         sub2.OverridePrim("/foo").SetAssetInfoByKey("name", pxr.VtValue("foo" as std.string))
 
-        let (token, value) = registerNotification(p.HasMetadataDictKey("assetInfo", "name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasMetadataDictKey("assetInfo", "name"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
@@ -124,7 +124,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("colorConfiguration"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("colorConfiguration"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetColorConfiguration(pxr.SdfAssetPath("foo")))
@@ -139,7 +139,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetColorConfiguration(pxr.SdfAssetPath("foo"))
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("colorConfiguration"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("colorConfiguration"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearColorConfiguration())
@@ -154,7 +154,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("colorManagementSystem"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("colorManagementSystem"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetColorManagementSystem("foo"))
@@ -169,7 +169,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetColorManagementSystem("foo")
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("colorManagementSystem"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("colorManagementSystem"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearColorManagementSystem())
@@ -184,7 +184,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("comment"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("comment"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetComment("foo"))
@@ -199,7 +199,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("defaultPrim"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("defaultPrim"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetDefaultPrim("foo"))
@@ -214,7 +214,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetDefaultPrim("foo")
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("defaultPrim"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("defaultPrim"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearDefaultPrim())
@@ -229,7 +229,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("documentation"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("documentation"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetDocumentation("foo"))
@@ -244,7 +244,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("startTimeCode"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("startTimeCode"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetStartTimeCode(7))
@@ -259,7 +259,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetStartTimeCode(7)
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("startTimeCode"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("startTimeCode"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearStartTimeCode())
@@ -274,7 +274,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("endTimeCode"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("endTimeCode"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetEndTimeCode(7))
@@ -289,7 +289,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetEndTimeCode(7)
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("endTimeCode"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("endTimeCode"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearEndTimeCode())
@@ -304,7 +304,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("timeCodesPerSecond"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("timeCodesPerSecond"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetTimeCodesPerSecond(7))
@@ -319,7 +319,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetTimeCodesPerSecond(7)
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("timeCodesPerSecond"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("timeCodesPerSecond"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearTimeCodesPerSecond())
@@ -334,7 +334,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("framesPerSecond"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("framesPerSecond"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetFramesPerSecond(7))
@@ -349,7 +349,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetFramesPerSecond(7)
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("framesPerSecond"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("framesPerSecond"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearFramesPerSecond())
@@ -364,7 +364,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("framePrecision"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("framePrecision"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetFramePrecision(7))
@@ -379,7 +379,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetFramePrecision(7)
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("framePrecision"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("framePrecision"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearFramePrecision())
@@ -394,7 +394,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("owner"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("owner"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetOwner("foo"))
@@ -409,7 +409,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetOwner("foo")
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("owner"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("owner"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearOwner())
@@ -424,7 +424,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("sessionOwner"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("sessionOwner"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetSessionOwner("foo"))
@@ -439,7 +439,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetSessionOwner("foo")
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("sessionOwner"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("sessionOwner"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearSessionOwner())
@@ -454,7 +454,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("hasOwnedSubLayers"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("hasOwnedSubLayers"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetHasOwnedSubLayers(true))
@@ -469,7 +469,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("customLayerData"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("customLayerData"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetCustomLayerData(pxr.VtDictionary()))
@@ -484,7 +484,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetCustomLayerData(pxr.VtDictionary())
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("customLayerData"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("customLayerData"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearCustomLayerData())
@@ -505,7 +505,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         sub2.OverridePrim("/foo").SetHidden(true)
 
         
-        let (token, value) = registerNotification(p.HasAuthoredHidden())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredHidden())
         XCTAssertFalse(value)
         
         var dict = pxr.VtDictionary()
@@ -530,7 +530,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         sub2.OverridePrim("/foo").SetCustomData(dict)
 
         
-        let (token, value) = registerNotification(p.HasCustomDataKey("foo"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasCustomDataKey("foo"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearExpressionVariables())
@@ -548,7 +548,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         model.OverridePrim("/foo").SetActive(false)
         
         
-        let (token, value) = registerNotification(p.GetAllMetadata())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAllMetadata())
         XCTAssertNil(value["active"])
         
         expectingSomeNotifications([token], layer.SetSubLayerPaths([pathForStage(named: "Model.usda")]))
@@ -565,7 +565,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         model.OverridePrim("/foo").SetActive(false)
         
         
-        let (token, value) = registerNotification(p.GetAllAuthoredMetadata())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAllAuthoredMetadata())
         XCTAssertEqual(value.size(), 2)
         XCTAssertEqual(value["specifier"], pxr.VtValue(Overlay.SdfSpecifierDef))
         XCTAssertEqual(value["typeName"], pxr.VtValue("Cube" as pxr.TfToken))
@@ -588,7 +588,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let model = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Model.usda"), Overlay.UsdStage.LoadAll))
         model.OverridePrim("/foo").SetCustomDataByKey("myKey", pxr.VtValue("foo" as std.string))
 
-        let (token, value) = registerNotification(p.GetCustomDataByKey("myKey"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetCustomDataByKey("myKey"))
         XCTAssertTrue(value.IsEmpty())
         
         expectingSomeNotifications([token], layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0))
@@ -607,7 +607,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         model.OverridePrim("/foo").SetCustomDataByKey("fizz:buzz", pxr.VtValue("foo" as std.string))
         
         
-        let (token, value) = registerNotification(p.HasAuthoredCustomData())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredCustomData())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemoveSubLayerPath(0))
@@ -623,7 +623,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/beta", "Sphere")
         
         
-        let (token, value) = registerNotification(Bool(p))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(p))
         XCTAssertTrue(value)
         
         var batchEdit = pxr.SdfBatchNamespaceEdit()
@@ -642,7 +642,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.IsValid())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.TransferContent(other.GetRootLayer()))
@@ -658,7 +658,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(Bool(foo))
+        let (token, value) = registerNotification(reading: [.of(foo)], Bool(foo))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.SetRootPrims([layer.GetPrimAtPath("/bar")]))
@@ -674,7 +674,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         main.DefinePrim("/foo", "Sphere")
         let bar = main.DefinePrim("/foo/bar", "Sphere")
         
-        let (token, value) = registerNotification(bar.IsValid())
+        let (token, value) = registerNotification(reading: [.of(bar)], bar.IsValid())
         XCTAssertTrue(value)
                 
         expectingSomeNotifications([token], layer.InsertRootPrim(layer.GetPrimAtPath("/foo/bar"), 0))
@@ -689,7 +689,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         
         let foo = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(foo.IsValid())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemoveRootPrim(layer.GetPrimAtPath("/foo")))
@@ -703,7 +703,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.OverridePrim("/foo")
         
-        let (token, value) = registerNotification(Bool(p))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(p))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ScheduleRemoveIfInert(layer.GetObjectAtPath("/foo").GetSpec()))
@@ -717,7 +717,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.OverridePrim("/foo")
         
-        let (token, value) = registerNotification(p.IsValid())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemovePrimIfInert(layer.GetPrimAtPath("/foo")))
@@ -733,7 +733,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let attr = p.CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(Bool(attr))
+        let (token, value) = registerNotification(reading: [.of(attr)], Bool(attr))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemovePropertyIfHasOnlyRequiredFields(layer.GetPropertyAtPath("/foo.myAttr")))
@@ -749,7 +749,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let bar = main.OverridePrim("/foo/bar")
         
         
-        let (token, value) = registerNotification(Bool(bar))
+        let (token, value) = registerNotification(reading: [.of(bar)], Bool(bar))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemoveInertSceneDescription())
@@ -764,7 +764,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.IsValid())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsValid())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.ImportFromString(std.string(#"""
@@ -783,7 +783,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
 
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.IsValid())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Clear())
@@ -798,7 +798,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
 
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(Bool(p))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(p))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Reload(true))
@@ -814,7 +814,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
 
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(Bool(p))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(p))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Import(pathForStage(named: "Empty.usda")))
@@ -828,7 +828,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
 
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(Bool(p))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(p))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.ReloadLayers([main.GetRootLayer()], true))
@@ -848,7 +848,7 @@ final class Observation_MutateSdfLayer_ReadUsdObject: ObservationHelper {
         let p = main.GetPrimAtPath("/foo")
         
         
-        let (token, value) = registerNotification(p.IsValid())
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], p.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], overLayer.SetIdentifier(pathForStage(named: "NewOverStage.usda")))
@@ -31,7 +31,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         
         let p = main.DefinePrim("/foo", "Sphere")
                 
-        let (token, value) = registerNotification(p.IsActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsActive())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.SetField("/foo", "active", pxr.VtValue(false)))
@@ -55,7 +55,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         sub2.OverridePrim("/foo").ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
 
         
-        let (token, value) = registerNotification(p.GetAppliedSchemas())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAppliedSchemas())
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub2.usda"))))
@@ -71,7 +71,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetKind("model")
                 
-        let (token, value) = registerNotification(p.IsModel())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsModel())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseField("/foo", "kind"))
@@ -93,7 +93,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         sub1.OverridePrim("/foo").ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
 
         
-        let (token, value) = registerNotification(p.GetAppliedSchemas())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAppliedSchemas())
         XCTAssertEqual(value, [.UsdPhysicsTokens.PhysicsRigidBodyAPI])
         
         expectingSomeNotifications([token], layer.EraseFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
@@ -114,7 +114,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         sub2.OverridePrim("/foo").SetActive(true)
 
         
-        let (token, value) = registerNotification(p.HasAuthoredActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredActive())
         XCTAssertFalse(value)
         
         var dict = pxr.VtDictionary()
@@ -137,7 +137,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         sub2.OverridePrim("/foo").CreateAttribute("myAttr", .Float, true, Overlay.SdfVariabilityVarying)
 
         
-        let (token, value) = registerNotification(p.HasProperty("myAttr"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasProperty("myAttr"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearExpressionVariables())
@@ -155,7 +155,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         model.OverridePrim("/foo").SetTypeName("Cube")
         
         
-        let (token, value) = registerNotification(p.HasAuthoredTypeName())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredTypeName())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetSubLayerPaths([pathForStage(named: "Model.usda")]))
@@ -172,7 +172,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let model = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Model.usda"), Overlay.UsdStage.LoadAll))
         model.DefinePrim("/foo/bar", "Cube")
 
-        let (token, value) = registerNotification(p.GetChildrenNames())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetChildrenNames())
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0))
@@ -191,7 +191,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         
         
-        let (token, value) = registerNotification(p.IsActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsActive())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.RemoveSubLayerPath(0))
@@ -211,7 +211,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         model.OverridePrim("/foo").CreateAttribute("radius", .Double, false, Overlay.SdfVariabilityVarying).Set(5.0, 2.0)
 
-        var (token, value) = registerNotification(p.GetPrimStackWithLayerOffsets())
+        var (token, value) = registerNotification(reading: [.of(p)], p.GetPrimStackWithLayerOffsets())
         XCTAssertEqual(value.size(), 2)
         XCTAssertEqual(value[0].first, layer.GetPrimAtPath("/foo"))
         XCTAssertEqual(value[0].second, pxr.SdfLayerOffset(0, 1))
@@ -238,7 +238,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         main.DefinePrim("/beta/alpha", "Sphere")
         
         
-        let (token, value) = registerNotification(p.GetChildrenNames())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetChildrenNames())
         XCTAssertEqual(value, ["alpha"])
         
         var batchEdit = pxr.SdfBatchNamespaceEdit()
@@ -258,7 +258,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         other.DefinePrim("/foo", "Sphere").SetActive(false)
         
-        let (token, value) = registerNotification(p.IsActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsActive())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.TransferContent(other.GetRootLayer()))
@@ -275,7 +275,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let bar = main.DefinePrim("/bar", "Sphere")
         let fizz = main.DefinePrim("/fizz", "Sphere")
         
-        let (token, value) = registerNotification(bar.GetNextSibling())
+        let (token, value) = registerNotification(reading: [.of(bar)], bar.GetNextSibling())
         XCTAssertEqual(value, fizz)
         
         expectingSomeNotifications([token], layer.SetRootPrims([layer.GetPrimAtPath("/bar"), layer.GetPrimAtPath("/foo"), layer.GetPrimAtPath("/fizz")]))
@@ -291,7 +291,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         let bar = main.DefinePrim("/foo/bar", "Sphere")
         
-        let (token, value) = registerNotification(Array(foo.GetAllChildren()))
+        let (token, value) = registerNotification(reading: [.of(foo)], Array(foo.GetAllChildren()))
         XCTAssertEqual(value, [bar])
                 
         expectingSomeNotifications([token], layer.InsertRootPrim(layer.GetPrimAtPath("/foo/bar"), 0))
@@ -308,7 +308,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let bar = main.DefinePrim("/bar", "Sphere")
         let fizz = main.DefinePrim("/fizz", "Sphere")
         
-        let (token, value) = registerNotification(foo.GetNextSibling())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetNextSibling())
         XCTAssertEqual(value, bar)
         
         expectingSomeNotifications([token], layer.RemoveRootPrim(layer.GetPrimAtPath("/bar")))
@@ -323,7 +323,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         main.OverridePrim("/foo/bar")
         
-        let (token, value) = registerNotification(p.GetAllChildrenNames())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAllChildrenNames())
         XCTAssertEqual(value, ["bar"])
         
         expectingSomeNotifications([token], layer.ScheduleRemoveIfInert(layer.GetObjectAtPath("/foo/bar").GetSpec()))
@@ -338,7 +338,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let bar = main.OverridePrim("/foo/bar")
         
-        let (token, value) = registerNotification(Array(p.GetAllDescendants()))
+        let (token, value) = registerNotification(reading: [.of(p)], Array(p.GetAllDescendants()))
         XCTAssertEqual(value, [bar])
         
         expectingSomeNotifications([token], layer.RemovePrimIfInert(layer.GetPrimAtPath("/foo/bar")))
@@ -354,7 +354,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         p.CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(p.HasProperty("myAttr"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasProperty("myAttr"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemovePropertyIfHasOnlyRequiredFields(layer.GetPropertyAtPath("/foo.myAttr")))
@@ -370,7 +370,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let bar = main.OverridePrim("/foo/bar")
         
         
-        let (token, value) = registerNotification(Array(foo.GetAllChildren()))
+        let (token, value) = registerNotification(reading: [.of(foo)], Array(foo.GetAllChildren()))
         XCTAssertEqual(value, [bar])
         
         expectingSomeNotifications([token], layer.RemoveInertSceneDescription())
@@ -388,7 +388,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let fizz = main.DefinePrim("/fizz", "Sphere")
         
         
-        let (token, value) = registerNotification(bar.GetNextSibling())
+        let (token, value) = registerNotification(reading: [.of(bar)], bar.GetNextSibling())
         XCTAssertEqual(value, fizz)
         
         expectingSomeNotifications([token], layer.SetRootPrimOrder(["bar", "foo", "fizz"]))
@@ -407,7 +407,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         layer.SetRootPrimOrder(["foo", "fizz"])
 
         
-        let (token, value) = registerNotification(bar.GetNextSibling())
+        let (token, value) = registerNotification(reading: [.of(bar)], bar.GetNextSibling())
         XCTAssertEqual(value, fizz)
 
         expectingSomeNotifications([token], layer.InsertInRootPrimOrder("bar", 0))
@@ -426,7 +426,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         layer.SetRootPrimOrder(["bar", "foo", "fizz"])
 
         
-        let (token, value) = registerNotification(bar.GetNextSibling())
+        let (token, value) = registerNotification(reading: [.of(bar)], bar.GetNextSibling())
         XCTAssertEqual(value, foo)
 
         expectingSomeNotifications([token], layer.RemoveFromRootPrimOrder("bar"))
@@ -445,7 +445,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         layer.SetRootPrimOrder(["bar", "foo", "fizz"])
 
         
-        let (token, value) = registerNotification(bar.GetNextSibling())
+        let (token, value) = registerNotification(reading: [.of(bar)], bar.GetNextSibling())
         XCTAssertEqual(value, foo)
 
         expectingSomeNotifications([token], layer.RemoveFromRootPrimOrderByIndex(0))
@@ -461,7 +461,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetActive(false)
         
-        let (token, value) = registerNotification(p.HasAuthoredActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredActive())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.ImportFromString(std.string(#"""
@@ -488,7 +488,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         sub.OverridePrim("/foo").SetActive(false)
         
-        let (token, value) = registerNotification(p.IsActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsActive())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], subLayer.Clear())
@@ -507,7 +507,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         sub.OverridePrim("/foo").SetActive(false)
         
-        let (token, value) = registerNotification(p.HasAuthoredActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredActive())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.Reload(true))
@@ -527,7 +527,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         sub.OverridePrim("/foo").SetActive(false)
         
-        let (token, value) = registerNotification(p.HasAuthoredActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredActive())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.Import(pathForStage(named: "Empty.usda")))
@@ -545,7 +545,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         sub.OverridePrim("/foo").SetActive(false)
         
-        let (token, value) = registerNotification(p.HasAuthoredActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredActive())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.ReloadLayers([sub.GetRootLayer()], true))
@@ -565,7 +565,7 @@ final class Observation_MutateSdfLayer_ReadUsdPrim: ObservationHelper {
         overStage.OverridePrim("/foo").CreateRelationship("myRel", true)
         
         
-        let (token, value) = registerNotification(p.HasProperty("myRel"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasProperty("myRel"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], overLayer.SetIdentifier(pathForStage(named: "NewOverStage.usda")))
@@ -33,7 +33,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         let attr = p.GetAttribute("radius")
         attr.Set(5.0, 1.0)
                 
-        let (token, value) = registerNotification(attr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetDisplayGroup())
         XCTAssertEqual(value, "")
                 
         expectingSomeNotifications([token], layer.SetField("/foo.radius", "displayGroup", pxr.VtValue("fizzbuzz" as std.string)))
@@ -57,7 +57,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         sub2.OverridePrim("/foo").CreateAttribute("radius", .Double, false, Overlay.SdfVariabilityVarying).SetDisplayGroup("fizzbuzz")
 
         
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub2.usda"))))
@@ -74,7 +74,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         attr.SetDisplayGroup("fizzbuzz")
 
         
-        let (token, value) = registerNotification(attr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetDisplayGroup())
         XCTAssertEqual(value, "fizzbuzz")
         
         expectingSomeNotifications([token], layer.EraseField("/foo.radius", "displayGroup"))
@@ -95,7 +95,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         sub1.OverridePrim("/foo").CreateAttribute("radius", .Double, false, Overlay.SdfVariabilityVarying).SetDisplayGroup("fizzbuzz")
 
         
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
@@ -117,7 +117,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         overAttr.SetNestedDisplayGroups(["alpha", "beta"])
 
         
-        let (token, value) = registerNotification(attr.GetNestedDisplayGroups())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetNestedDisplayGroups())
         XCTAssertEqual(value, [])
         
         var dict = pxr.VtDictionary()
@@ -141,7 +141,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         overAttr.SetDisplayGroup("foo")
 
         
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearExpressionVariables())
@@ -160,7 +160,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         overAttr.SetDisplayGroup("fizz")
         
         
-        let (token, value) = registerNotification(attr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetDisplayGroup())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], layer.SetSubLayerPaths([pathForStage(named: "Model.usda")]))
@@ -178,7 +178,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         model.OverridePrim("/foo").CreateAttribute("radius", .Double, false, Overlay.SdfVariabilityVarying).SetDisplayGroup("foo")
 
         
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0))
@@ -198,7 +198,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         overAttr.SetDisplayGroup("fizz")
         
         
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemoveSubLayerPath(0))
@@ -219,7 +219,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         attr.Set(1.0, 2)
         model.OverridePrim("/foo").CreateAttribute("radius", .Double, false, Overlay.SdfVariabilityVarying).Set(5.0, 2.0)
 
-        var (token, value) = registerNotification(attr.GetPropertyStackWithLayerOffsets(2))
+        var (token, value) = registerNotification(reading: [.of(attr)], attr.GetPropertyStackWithLayerOffsets(2))
         XCTAssertEqual(value.size(), 2)
         XCTAssertEqual(value[0].first, layer.GetPropertyAtPath("/foo.radius"))
         XCTAssertEqual(value[0].second, pxr.SdfLayerOffset(0, 1))
@@ -247,7 +247,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let attr = p.GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.TransferContent(other.GetRootLayer()))
@@ -264,7 +264,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         let attr = foo.GetAttribute("radius")
         main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.SetRootPrims([layer.GetPrimAtPath("/bar")]))
@@ -281,7 +281,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         let bar = main.DefinePrim("/foo/bar", "Sphere")
         let attr = bar.GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
                 
         expectingSomeNotifications([token], layer.InsertRootPrim(layer.GetPrimAtPath("/foo/bar"), 0))
@@ -297,7 +297,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         let attr = foo.GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemoveRootPrim(layer.GetPrimAtPath("/foo")))
@@ -313,7 +313,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         let attr = p.CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemovePropertyIfHasOnlyRequiredFields(layer.GetPropertyAtPath("/foo.myAttr")))
@@ -328,7 +328,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.ImportFromString(std.string(#"""
@@ -347,7 +347,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
 
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Clear())
@@ -362,7 +362,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
 
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Reload(true))
@@ -378,7 +378,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
 
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Import(pathForStage(named: "Empty.usda")))
@@ -392,7 +392,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
 
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.ReloadLayers([main.GetRootLayer()], true))
@@ -413,7 +413,7 @@ final class Observation_MutateSdfLayer_ReadUsdProperty: ObservationHelper {
         let rel = main.GetRelationshipAtPath("/foo.myRel")
         
         
-        let (token, value) = registerNotification(rel.IsDefined())
+        let (token, value) = registerNotification(reading: [.object(main, "/foo.myRel")], rel.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], overLayer.SetIdentifier(pathForStage(named: "NewOverStage.usda")))
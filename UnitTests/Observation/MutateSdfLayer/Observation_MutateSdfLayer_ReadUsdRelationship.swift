@@ -40,7 +40,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         overRelationship.AddTarget(".doubleSided", Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(bigRelationship.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(bigRelationship)], bigRelationship.HasAuthoredTargets())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Model.usda"))))
@@ -58,7 +58,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         rel.AddTarget(".doubleSided", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.doubleSided"])
         
@@ -84,7 +84,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         overRelationship.AddTarget(".doubleSided", Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(bigRelationship.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(bigRelationship)], bigRelationship.HasAuthoredTargets())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
@@ -106,7 +106,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         overAttr.AddTarget(".doubleSided", Overlay.UsdListPositionBackOfPrependList)
 
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertFalse(value)
         
         var dict = pxr.VtDictionary()
@@ -130,7 +130,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         overAttr.AddTarget(".doubleSided", Overlay.UsdListPositionBackOfPrependList)
 
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearExpressionVariables())
@@ -150,7 +150,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetSubLayerPaths([pathForStage(named: "Model.usda")]))
@@ -170,7 +170,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         overRel.AddTarget(".displayColor", Overlay.UsdListPositionBackOfPrependList)
 
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0))
@@ -190,7 +190,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         overRel.AddTarget(".displayColor", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.displayColor"])
         
@@ -210,7 +210,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         otherRel.AddTarget(".doubleSided", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo/child.doubleSided"])
 
@@ -238,7 +238,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], Overlay.Dereference(copyDest.GetRootLayer()).TransferContent(copySrc.GetRootLayer()))
@@ -259,7 +259,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/bar.fizz"])
         
@@ -281,7 +281,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/bar.fizz"])
         
@@ -303,7 +303,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.doubleSided"])
         
@@ -322,7 +322,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.ImportFromString(std.string(#"""
@@ -353,7 +353,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         let overRel = sub.OverridePrim("/foo").CreateRelationship("myAttr", true)
         overRel.AddTarget("/foo.radius", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.Clear())
@@ -373,7 +373,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         let overRel = sub.OverridePrim("/foo").CreateRelationship("myAttr", true)
         overRel.AddTarget("/foo.radius", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.Reload(true))
@@ -394,7 +394,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         let overRel = sub.OverridePrim("/foo").CreateRelationship("myAttr", true)
         overRel.AddTarget("/foo.radius", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.Import(pathForStage(named: "Empty.usda")))
@@ -413,7 +413,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         let overRel = sub.OverridePrim("/foo").CreateRelationship("myAttr", true)
         overRel.AddTarget("/foo.radius", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.ReloadLayers([sub.GetRootLayer()], true))
@@ -433,7 +433,7 @@ final class Observation_MutateSdfLayer_ReadUsdRelationship: ObservationHelper {
         let overRel = sub.OverridePrim("/foo").CreateRelationship("myAttr", true)
         overRel.AddTarget("/foo.radius", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], subLayer.SetIdentifier(pathForStage(named: "NewSub.usda")))
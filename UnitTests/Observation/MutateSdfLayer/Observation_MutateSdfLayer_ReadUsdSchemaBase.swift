@@ -41,7 +41,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         }
 
         
-        let (token, value) = registerNotification(Bool(s))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(s))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub2.usda"))))
@@ -59,7 +59,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         
         let schema = pxr.UsdPhysicsRigidBodyAPI(prim)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(prim)], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseField("/foo", "apiSchemas"))
@@ -83,7 +83,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         }
 
         
-        let (token, value) = registerNotification(Bool(s))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(s))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
@@ -104,7 +104,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         let schema = pxr.UsdGeomCube(main.GetPrimAtPath("/foo"))
         
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
         
         var dict = pxr.VtDictionary()
@@ -126,7 +126,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         let schema = pxr.UsdPhysicsRigidBodyAPI(main.GetPrimAtPath("/foo"))
         
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
         
         var dict = pxr.VtDictionary()
@@ -149,7 +149,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         let schema = pxr.UsdGeomCube(main.GetPrimAtPath("/foo"))
         
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearExpressionVariables())
@@ -169,7 +169,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         model.OverridePrim("/foo").SetTypeName("Cube")
         let schema = pxr.UsdGeomCube.Get(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.SetSubLayerPaths([]))
@@ -187,7 +187,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         model.OverridePrim("/foo").ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
 
         
-        let (token, value) = registerNotification(Bool(pxr.UsdPhysicsRigidBodyAPI(p)))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(pxr.UsdPhysicsRigidBodyAPI(p)))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0))
@@ -207,7 +207,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         model.OverridePrim("/foo").SetTypeName("Cube")
         let schema = pxr.UsdGeomCube.Get(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.RemoveSubLayerPath(0))
@@ -222,7 +222,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
                 
         let schema = pxr.UsdGeomCube.Define(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
 
                 
@@ -243,7 +243,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let schema = pxr.UsdGeomSphere(p)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.TransferContent(other.GetRootLayer()))
@@ -259,7 +259,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         let foo = pxr.UsdGeomSphere(main.DefinePrim("/foo", "Sphere"))
         main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(Bool(foo))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(foo))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.SetRootPrims([layer.GetPrimAtPath("/bar")]))
@@ -275,7 +275,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         main.DefinePrim("/foo", "Sphere")
         let bar = pxr.UsdGeomSphere(main.DefinePrim("/foo/bar", "Sphere"))
         
-        let (token, value) = registerNotification(Bool(bar))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo/bar")], Bool(bar))
         XCTAssertTrue(value)
                 
         expectingSomeNotifications([token], layer.InsertRootPrim(layer.GetPrimAtPath("/foo/bar"), 0))
@@ -290,7 +290,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         
         let foo = pxr.UsdGeomSphere(main.DefinePrim("/foo", "Sphere"))
         
-        let (token, value) = registerNotification(Bool(foo))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(foo))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.RemoveRootPrim(layer.GetPrimAtPath("/foo")))
@@ -305,7 +305,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         
         let schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ImportFromString(std.string(#"""
@@ -325,7 +325,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         
         let schema = pxr.UsdPhysicsRigidBodyAPI(p)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ImportFromString(std.string(#"""
@@ -348,7 +348,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         
         let schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Clear())
@@ -363,7 +363,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         
         let schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Reload(true))
@@ -379,7 +379,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         
         let schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.Import(pathForStage(named: "Empty.usda")))
@@ -393,7 +393,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         
         let schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], pxr.SdfLayer.ReloadLayers([main.GetRootLayer()], true))
@@ -412,7 +412,7 @@ final class Observation_MutateSdfLayer_ReadUsdSchemaBase: ObservationHelper {
         model.DefinePrim("/foo", "Sphere")
         let schema = pxr.UsdGeomSphere.Get(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], modelLayer.SetIdentifier(pathForStage(named: "NewModel.usda")))
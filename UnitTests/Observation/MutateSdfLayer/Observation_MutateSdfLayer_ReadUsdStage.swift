@@ -29,7 +29,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetStartTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], layer.SetField("/", "startTimeCode", pxr.VtValue(17.0 as Double)))
@@ -42,7 +42,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         
         let p = main.DefinePrim("/foo", "Sphere")
                 
-        let (token, value) = registerNotification(main.Traverse())
+        let (token, value) = registerNotification(reading: [.of(main)], main.Traverse())
         XCTAssertEqual(Array(value), [p])
         
         expectingSomeNotifications([token], layer.SetField("/foo", "active", pxr.VtValue(false)))
@@ -62,7 +62,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub1.usda")))
 
         
-        let (token, value) = registerNotification(main.GetLayerStack(false))
+        let (token, value) = registerNotification(reading: [.of(main)], main.GetLayerStack(false))
         XCTAssertEqual(Array(value), [main.GetRootLayer(), sub1.GetRootLayer()])
         
         expectingSomeNotifications([token], layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub2.usda"))))
@@ -76,7 +76,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetStartTimeCode(7)
         
-        let (token, value) = registerNotification(main.HasAuthoredMetadata("startTimeCode"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredMetadata("startTimeCode"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.EraseField("/", "startTimeCode"))
@@ -95,7 +95,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.SetFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER", pxr.VtValue(pathForStage(named: "Sub1.usda")))
 
         
-        let (token, value) = registerNotification(main.GetLayerStack(false))
+        let (token, value) = registerNotification(reading: [.of(main)], main.GetLayerStack(false))
         XCTAssertEqual(Array(value), [main.GetRootLayer(), sub1.GetRootLayer()])
         
         expectingSomeNotifications([token], layer.EraseFieldDictValueByKey("/", "expressionVariables", "WHICH_SUBLAYER"))
@@ -108,7 +108,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(main.GetColorConfiguration())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetColorConfiguration())
         XCTAssertEqual(value, pxr.SdfAssetPath(""))
         
         expectingSomeNotifications([token], layer.SetColorConfiguration(pxr.SdfAssetPath("fizz")))
@@ -122,7 +122,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetColorConfiguration(pxr.SdfAssetPath("fizz"))
 
-        let (token, value) = registerNotification(main.GetColorConfiguration())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetColorConfiguration())
         XCTAssertEqual(value, pxr.SdfAssetPath("fizz"))
         
         expectingSomeNotifications([token], layer.ClearColorConfiguration())
@@ -135,7 +135,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(main.GetColorManagementSystem())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetColorManagementSystem())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], layer.SetColorManagementSystem("fizz"))
@@ -149,7 +149,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetColorManagementSystem("buzz")
 
-        let (token, value) = registerNotification(main.GetColorManagementSystem())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetColorManagementSystem())
         XCTAssertEqual(value, "buzz")
         
         expectingSomeNotifications([token], layer.ClearColorManagementSystem())
@@ -162,7 +162,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value!, #"""
         #usda 1.0
         (
@@ -194,7 +194,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         main.DefinePrim("/foo", "Cube")
         
 
-        let (token, value) = registerNotification(main.GetDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(main)], main.GetDefaultPrim())
         XCTAssertFalse(Bool(value))
         
         expectingSomeNotifications([token], layer.SetDefaultPrim("foo"))
@@ -207,7 +207,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         main.DefinePrim("/foo", "Cube")
         
 
-        let (token, value) = registerNotification(main.HasDefaultPrim())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasDefaultPrim())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetDefaultPrim("foo"))
@@ -222,7 +222,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         main.DefinePrim("/foo", "Cube")
         main.SetDefaultPrim(main.GetPrimAtPath("foo"))
 
-        let (token, value) = registerNotification(main.GetDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(main)], main.GetDefaultPrim())
         XCTAssertEqual(value, main.GetPrimAtPath("foo"))
         
         expectingSomeNotifications([token], layer.ClearDefaultPrim())
@@ -235,7 +235,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         main.DefinePrim("/foo", "Cube")
         main.SetDefaultPrim(main.GetPrimAtPath("/foo"))
 
-        let (token, value) = registerNotification(main.HasDefaultPrim())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasDefaultPrim())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearDefaultPrim())
@@ -249,7 +249,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         
         var metadataOut = pxr.VtValue()
-        let (token, value) = registerNotification(main.GetMetadata("documentation", &metadataOut))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMetadata("documentation", &metadataOut))
         XCTAssertTrue(value)
         XCTAssertEqual(metadataOut.Get() as std.string, "")
         
@@ -264,7 +264,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetStartTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], layer.SetStartTimeCode(2.718))
@@ -276,7 +276,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetEndTimeCode(7)
         
-        let (token, value) = registerNotification(main.HasAuthoredTimeCodeRange())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredTimeCodeRange())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetStartTimeCode(2.718))
@@ -290,7 +290,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetStartTimeCode(4)
         
-        let (token, value) = registerNotification(main.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetStartTimeCode())
         XCTAssertEqual(value, 4)
         
         expectingSomeNotifications([token], layer.ClearStartTimeCode())
@@ -303,7 +303,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         main.SetStartTimeCode(4)
         main.SetEndTimeCode(200)
         
-        let (token, value) = registerNotification(main.HasAuthoredTimeCodeRange())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredTimeCodeRange())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearStartTimeCode())
@@ -316,7 +316,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.GetEndTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetEndTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], layer.SetEndTimeCode(2.718))
@@ -328,7 +328,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetStartTimeCode(-3.14)
         
-        let (token, value) = registerNotification(main.HasAuthoredTimeCodeRange())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredTimeCodeRange())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], layer.SetEndTimeCode(2.718))
@@ -342,7 +342,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetEndTimeCode(4)
         
-        let (token, value) = registerNotification(main.GetEndTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetEndTimeCode())
         XCTAssertEqual(value, 4)
         
         expectingSomeNotifications([token], layer.ClearEndTimeCode())
@@ -355,7 +355,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         main.SetStartTimeCode(1)
         main.SetEndTimeCode(4)
         
-        let (token, value) = registerNotification(main.HasAuthoredTimeCodeRange())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredTimeCodeRange())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], layer.ClearEndTimeCode())
@@ -368,7 +368,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.GetTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetTimeCodesPerSecond())
         XCTAssertEqual(value, 24)
         
         expectingSomeNotifications([token], layer.SetTimeCodesPerSecond(19))
@@ -382,7 +382,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetTimeCodesPerSecond(4)
         
-        let (token, value) = registerNotification(main.GetTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetTimeCodesPerSecond())
         XCTAssertEqual(value, 4)
         
         expectingSomeNotifications([token], layer.ClearTimeCodesPerSecond())
@@ -395,7 +395,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.GetFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetFramesPerSecond())
         XCTAssertEqual(value, 24)
         
         expectingSomeNotifications([token], layer.SetFramesPerSecond(19))
@@ -409,7 +409,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         main.SetFramesPerSecond(5)
         
-        let (token, value) = registerNotification(main.GetFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetFramesPerSecond())
         XCTAssertEqual(value, 5)
         
         expectingSomeNotifications([token], layer.ClearFramesPerSecond())
@@ -423,7 +423,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         
         var metadataOut = pxr.VtValue()
-        let (token, value) = registerNotification(main.GetMetadata("framePrecision", &metadataOut))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMetadata("framePrecision", &metadataOut))
         XCTAssertTrue(value)
         XCTAssertEqual(metadataOut.Get() as Int32, 3)
         
@@ -440,7 +440,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.SetFramePrecision(16)
         
         var metadataOut = pxr.VtValue()
-        let (token, value) = registerNotification(main.GetMetadata("framePrecision", &metadataOut))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMetadata("framePrecision", &metadataOut))
         XCTAssertTrue(value)
         XCTAssertEqual(metadataOut.Get() as Int32, 16)
         
@@ -455,7 +455,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.HasAuthoredMetadata("owner"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredMetadata("owner"))
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], layer.SetOwner("foo"))
@@ -469,7 +469,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         layer.SetOwner("foo")
         
-        let (token, value) = registerNotification(main.HasAuthoredMetadata("owner"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredMetadata("owner"))
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.ClearOwner())
@@ -482,7 +482,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.HasAuthoredMetadata("sessionOwner"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredMetadata("sessionOwner"))
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], layer.SetSessionOwner("foo"))
@@ -496,7 +496,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         layer.SetSessionOwner("foo")
         
-        let (token, value) = registerNotification(main.HasAuthoredMetadata("sessionOwner"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredMetadata("sessionOwner"))
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.ClearSessionOwner())
@@ -509,7 +509,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.HasAuthoredMetadata("hasOwnedSubLayers"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredMetadata("hasOwnedSubLayers"))
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], layer.SetHasOwnedSubLayers(true))
@@ -523,7 +523,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(main.GetMetadataByDictKey("customLayerData", "foo", &vtValue))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMetadataByDictKey("customLayerData", "foo", &vtValue))
         XCTAssertFalse(value)
 
         var dict = pxr.VtDictionary()
@@ -537,7 +537,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.HasMetadataDictKey("customLayerData", "foo"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasMetadataDictKey("customLayerData", "foo"))
         XCTAssertFalse(value)
 
         var dict = pxr.VtDictionary()
@@ -558,7 +558,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
 
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(main.GetMetadataByDictKey("customLayerData", "foo", &vtValue))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMetadataByDictKey("customLayerData", "foo", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue("bar" as std.string))
 
@@ -575,7 +575,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.SetCustomLayerData(dict)
 
         
-        let (token, value) = registerNotification(main.HasMetadataDictKey("customLayerData", "foo"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasMetadataDictKey("customLayerData", "foo"))
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], layer.ClearCustomLayerData())
@@ -589,7 +589,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(main.GetMetadataByDictKey("expressionVariables", "foo", &vtValue))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMetadataByDictKey("expressionVariables", "foo", &vtValue))
         XCTAssertFalse(value)
         
         var dict = pxr.VtDictionary()
@@ -603,7 +603,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(main.HasMetadataDictKey("expressionVariables", "foo"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasMetadataDictKey("expressionVariables", "foo"))
         XCTAssertFalse(value)
         
         var dict = pxr.VtDictionary()
@@ -623,7 +623,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.SetExpressionVariables(dict)
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(main.GetMetadataByDictKey("expressionVariables", "foo", &vtValue))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMetadataByDictKey("expressionVariables", "foo", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue("bar" as std.string))
         
@@ -640,7 +640,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.SetExpressionVariables(dict)
 
         
-        let (token, value) = registerNotification(main.HasMetadataDictKey("expressionVariables", "foo"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasMetadataDictKey("expressionVariables", "foo"))
         XCTAssertTrue(value)
                 
         expectingSomeNotifications([token], layer.ClearExpressionVariables())
@@ -656,7 +656,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let model = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Model5.usda"), Overlay.UsdStage.LoadAll))
         
         
-        let (token, value) = registerNotification(main.GetUsedLayers(false))
+        let (token, value) = registerNotification(reading: [.of(main)], main.GetUsedLayers(false))
         XCTAssertEqual(Array(value).sorted(), [main.GetRootLayer(), main.GetSessionLayer()].sorted())
         
         expectingSomeNotifications([token], layer.SetSubLayerPaths([pathForStage(named: "Model5.usda")]))
@@ -673,7 +673,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         model.OverridePrim("/alpha").SetActive(false)
         
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [main.GetPrimAtPath("/alpha")])
         
         expectingSomeNotifications([token], layer.SetSubLayerPaths([pathForStage(named: "Model.usda")]))
@@ -688,7 +688,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         
         let model = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Model.usda"), Overlay.UsdStage.LoadAll))
 
-        let (token, value) = registerNotification(main.GetLayerStack(true))
+        let (token, value) = registerNotification(reading: [.of(main)], main.GetLayerStack(true))
         XCTAssertEqual(Array(value), [main.GetSessionLayer(), main.GetRootLayer()])
         
         expectingSomeNotifications([token], layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0))
@@ -706,7 +706,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         model.DefinePrim("/beta", "Sphere")
         
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [main.GetPrimAtPath("/beta")])
         
         expectingSomeNotifications([token], layer.RemoveSubLayerPath(0))
@@ -723,7 +723,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.InsertSubLayerPath(pathForStage(named: "Model.usda"), 0)
         model.DefinePrim("/foo", "Sphere").GetAttribute("radius").Set(6.0, 2.0)
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -769,7 +769,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         main.DefinePrim("/beta", "Sphere")
         
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [main.GetPrimAtPath("/beta")])
         
         var batchEdit = pxr.SdfBatchNamespaceEdit()
@@ -802,7 +802,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         Overlay.Dereference(top.GetRootLayer()).InsertSubLayerPath("CopyDest.usda", 0)
         Overlay.Dereference(copySrc.GetRootLayer()).InsertSubLayerPath("Opinion.usda", 0)
         
-        let (token, value) = registerNotification(top.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(top)], top.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -853,7 +853,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         Overlay.Dereference(copySrc.GetRootLayer()).InsertSubLayerPath("Sub/copy.usda", 0)
         Overlay.Dereference(copySrc.GetRootLayer()).InsertSubLayerPath("Sub/opinion.usda", 0)
         
-        let (token, value) = registerNotification(top.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(top)], top.ExportToString())
         XCTAssertEqual(value, #"""
             #usda 1.0
             (
@@ -889,7 +889,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         let bar = main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [foo, bar])
         
         expectingSomeNotifications([token], layer.SetRootPrims([layer.GetPrimAtPath("/bar"), layer.GetPrimAtPath("/foo")]))
@@ -905,7 +905,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         let bar = main.DefinePrim("/foo/bar", "Sphere")
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [foo, bar])
         
         expectingSomeNotifications([token], layer.InsertRootPrim(layer.GetPrimAtPath("/foo/bar"), 0))
@@ -921,7 +921,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         let bar = main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [foo, bar])
         
         expectingSomeNotifications([token], layer.RemoveRootPrim(layer.GetPrimAtPath("/bar")))
@@ -935,7 +935,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.OverridePrim("/foo")
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [p])
         
         expectingSomeNotifications([token], layer.ScheduleRemoveIfInert(layer.GetObjectAtPath("/foo").GetSpec()))
@@ -949,7 +949,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.OverridePrim("/foo")
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [p])
         
         expectingSomeNotifications([token], layer.RemovePrimIfInert(layer.GetPrimAtPath("/foo")))
@@ -964,7 +964,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         main.OverridePrim("/foo").CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(layer.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
 
@@ -992,7 +992,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let p = main.OverridePrim("/foo")
         
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [p])
         
         expectingSomeNotifications([token], layer.RemoveInertSceneDescription())
@@ -1009,7 +1009,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let bar = main.DefinePrim("/bar", "Sphere")
         
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [foo, bar])
         
         expectingSomeNotifications([token], layer.SetRootPrimOrder(["bar", "foo"]))
@@ -1027,7 +1027,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.SetRootPrimOrder(["foo"])
         
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [foo, bar])
         
         expectingSomeNotifications([token], layer.InsertInRootPrimOrder("bar", 0))
@@ -1045,7 +1045,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.SetRootPrimOrder(["bar", "foo"])
         
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [bar, foo])
         
         expectingSomeNotifications([token], layer.RemoveFromRootPrimOrder("bar"))
@@ -1063,7 +1063,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         layer.SetRootPrimOrder(["bar", "foo"])
         
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [bar, foo])
         
         expectingSomeNotifications([token], layer.RemoveFromRootPrimOrderByIndex(0))
@@ -1076,7 +1076,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value!, #"""
         #usda 1.0
         (
@@ -1123,7 +1123,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
 
         let foo = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [foo])
         
         expectingSomeNotifications([token], layer.Clear())
@@ -1138,7 +1138,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
 
         let foo = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [foo])
         
         expectingSomeNotifications([token], layer.Reload(true))
@@ -1154,7 +1154,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
 
         let foo = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [foo])
         
         expectingSomeNotifications([token], layer.Import(pathForStage(named: "Empty.usda")))
@@ -1168,7 +1168,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
 
         let foo = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [foo])
         
         expectingSomeNotifications([token], pxr.SdfLayer.ReloadLayers([main.GetRootLayer()], true))
@@ -1181,7 +1181,7 @@ final class Observation_MutateSdfLayer_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -31,7 +31,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(layer.GetField("/foo.myAttr", "variability"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo.myAttr", "variability"))
         XCTAssertEqual(value, pxr.VtValue(Overlay.SdfVariabilityVarying))
         
         expectingSomeNotifications([token], attr.SetVariability(Overlay.SdfVariabilityUniform))
@@ -46,7 +46,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(layer.GetField("/foo.myAttr", "typeName"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo.myAttr", "typeName"))
         XCTAssertEqual(value, pxr.VtValue("double" as pxr.TfToken))
         
         expectingSomeNotifications([token], attr.SetTypeName(.Float))
@@ -60,7 +60,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "connectionPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "connectionPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.AddConnection("/foo.displayColor", Overlay.UsdListPositionBackOfPrependList))
@@ -75,7 +75,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.AddConnection("/foo.displayColor", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(layer.GetField("/foo.radius", "connectionPaths"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo.radius", "connectionPaths"))
         var listOp = pxr.SdfPathListOp()
         listOp.SetPrependedItems(["/foo.displayColor"], nil)
         XCTAssertEqual(value, pxr.VtValue(listOp))
@@ -93,7 +93,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "connectionPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "connectionPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetConnections(["/foo.displayColor"]))
@@ -108,7 +108,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.AddConnection("/foo.displayColor", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "connectionPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "connectionPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearConnections())
@@ -121,7 +121,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.AddConnection("/foo.displayColor", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(layer.GetField("/foo.radius", "connectionPaths"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo.radius", "connectionPaths"))
         var listOp = pxr.SdfPathListOp()
         listOp.SetPrependedItems(["/foo.displayColor"], nil)
         XCTAssertEqual(value, pxr.VtValue(listOp))
@@ -137,7 +137,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "colorSpace", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "colorSpace", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetColorSpace("bar"))
@@ -152,7 +152,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetColorSpace("bar")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "colorSpace", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "colorSpace", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearColorSpace())
@@ -166,7 +166,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "timeSamples", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "timeSamples", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.Set(2.718, 1.059462309))
@@ -178,7 +178,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "default", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "default", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.Set(2.718, .Default()))
@@ -190,7 +190,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
-        let (token, value) = registerNotification(layer.ListAllTimeSamples())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListAllTimeSamples())
         XCTAssertEqual(Array(value), [])
         
         expectingSomeNotifications([token], attr.Set(2.718, 1.059462309))
@@ -202,7 +202,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
-        let (token, value) = registerNotification(layer.ListTimeSamplesForPath("/foo.radius"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListTimeSamplesForPath("/foo.radius"))
         XCTAssertEqual(Array(value), [])
         
         expectingSomeNotifications([token], attr.Set(2.718, 1.059462309))
@@ -214,7 +214,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
-        let (token, value) = registerNotification(layer.GetNumTimeSamplesForPath("/foo.radius"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetNumTimeSamplesForPath("/foo.radius"))
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], attr.Set(2.718, 1.059462309))
@@ -227,7 +227,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(layer.QueryTimeSample("/foo.radius", 1.059462309, &vtValue))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.QueryTimeSample("/foo.radius", 1.059462309, &vtValue))
         XCTAssertFalse(value)
         XCTAssertTrue(vtValue.IsEmpty())
         
@@ -244,7 +244,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(2.718, 1.059462309)
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "timeSamples", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "timeSamples", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.Clear())
@@ -260,7 +260,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         attr.Set(3.0, 5)
         attr.Set(4.0, 6)
         
-        let (token, value) = registerNotification(layer.ListTimeSamplesForPath("/foo.radius"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListTimeSamplesForPath("/foo.radius"))
         XCTAssertEqual(Array(value).sorted(), [5, 6])
         
         expectingSomeNotifications([token], attr.ClearAtTime(6))
@@ -275,7 +275,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(3.0, .Default())
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "default", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "default", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearDefault())
@@ -290,7 +290,7 @@ final class Observation_MutateUsdAttribute_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(3.0, 7)
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "timeSamples", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "timeSamples", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.Block())
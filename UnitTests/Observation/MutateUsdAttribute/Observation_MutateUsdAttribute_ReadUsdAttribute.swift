@@ -30,7 +30,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(attr.GetVariability())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetVariability())
         XCTAssertEqual(value, Overlay.SdfVariabilityVarying)
         
         expectingSomeNotifications([token], attr.SetVariability(Overlay.SdfVariabilityUniform))
@@ -43,7 +43,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(attr.GetTypeName())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetTypeName())
         XCTAssertEqual(value, .Double)
         
         expectingSomeNotifications([token], attr.SetTypeName(.Float))
@@ -57,7 +57,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
         var connections = pxr.SdfPathVector()
-        let (token, value) = registerNotification(attr.GetConnections(&connections))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetConnections(&connections))
         XCTAssertFalse(value)
         XCTAssertEqual(connections, [])
         
@@ -70,7 +70,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.HasAuthoredConnections())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredConnections())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.AddConnection("/foo.displayColor", Overlay.UsdListPositionBackOfPrependList))
@@ -86,7 +86,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         
         
         var connections = pxr.SdfPathVector()
-        let (token, value) = registerNotification(attr.GetConnections(&connections))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetConnections(&connections))
         XCTAssertTrue(value)
         XCTAssertEqual(connections, ["/foo.displayColor"])
         
@@ -102,7 +102,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
         var connections = pxr.SdfPathVector()
-        let (token, value) = registerNotification(attr.GetConnections(&connections))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetConnections(&connections))
         XCTAssertFalse(value)
         XCTAssertEqual(connections, [])
         
@@ -115,7 +115,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.HasAuthoredConnections())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredConnections())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetConnections(["/foo.displayColor"]))
@@ -130,7 +130,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         attr.SetConnections(["/foo.displayColor"])
         
         var connections = pxr.SdfPathVector()
-        let (token, value) = registerNotification(attr.GetConnections(&connections))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetConnections(&connections))
         XCTAssertTrue(value)
         XCTAssertEqual(connections, ["/foo.displayColor"])
 
@@ -144,7 +144,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetConnections(["/foo.displayColor"])
         
-        let (token, value) = registerNotification(attr.HasAuthoredConnections())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredConnections())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], attr.ClearConnections())
@@ -157,7 +157,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.GetColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetColorSpace())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], attr.SetColorSpace("bar"))
@@ -168,7 +168,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.HasColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasColorSpace())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetColorSpace("bar"))
@@ -182,7 +182,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetColorSpace("bar")
         
-        let (token, value) = registerNotification(attr.GetColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetColorSpace())
         XCTAssertEqual(value, "bar")
         
         expectingSomeNotifications([token], attr.ClearColorSpace())
@@ -194,7 +194,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetColorSpace("bar")
         
-        let (token, value) = registerNotification(attr.HasColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasColorSpace())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearColorSpace())
@@ -208,7 +208,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
         var timeSamples = Overlay.Double_Vector()
-        let (token, value) = registerNotification(attr.GetTimeSamples(&timeSamples))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetTimeSamples(&timeSamples))
         XCTAssertTrue(value)
         #warning("assert commented out to avoid compiler crash")
         //XCTAssertEqual(Array(timeSamples), [])
@@ -224,7 +224,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
         var timeSamples = Overlay.Double_Vector()
-        let (token, value) = registerNotification(attr.GetTimeSamplesInInterval(pxr.GfInterval(3, 4, true, true), &timeSamples))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetTimeSamplesInInterval(pxr.GfInterval(3, 4, true, true), &timeSamples))
         XCTAssertTrue(value)
         #warning("assert commented out to avoid compiler crash")
         //XCTAssertEqual(Array(timeSamples), [])
@@ -239,7 +239,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
-        let (token, value) = registerNotification(attr.GetNumTimeSamples())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetNumTimeSamples())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], attr.Set(2.718, 3.1415))
@@ -253,7 +253,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         var lower = 0.0
         var upper = 0.0
         var hasTimeSamples = true
-        let (token, value) = registerNotification(attr.GetBracketingTimeSamples(3, &lower, &upper, &hasTimeSamples))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetBracketingTimeSamples(3, &lower, &upper, &hasTimeSamples))
         XCTAssertTrue(value)
         XCTAssertEqual(lower, 0.0)
         XCTAssertEqual(upper, 0.0)
@@ -270,7 +270,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "PointInstancer").GetAttribute("protoIndices")
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.Set([1, 2, 3] as pxr.VtIntArray, .Default()))
@@ -281,7 +281,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "PointInstancer").GetAttribute("protoIndices")
         
-        let (token, value) = registerNotification(attr.HasAuthoredValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredValue())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.Set([1, 2, 3] as pxr.VtIntArray, .Default()))
@@ -293,7 +293,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(5.0, 5)
 
-        let (token, value) = registerNotification(attr.ValueMightBeTimeVarying())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.ValueMightBeTimeVarying())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.Set(2.718, 3.1415))
@@ -305,7 +305,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, 2))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.Get(&radius, 2))
         XCTAssertTrue(value)
         XCTAssertEqual(radius, 1)
         
@@ -321,7 +321,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "PointInstancer").GetAttribute("protoIndices")
         attr.Set([1, 2, 3] as pxr.VtIntArray, .Default())
         
-        let (token, value) = registerNotification(attr.HasAuthoredValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.Clear())
@@ -337,7 +337,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         attr.Set(4.0, 6)
 
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, 6))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.Get(&radius, 6))
         XCTAssertTrue(value)
         XCTAssertEqual(radius, 4)
         
@@ -354,7 +354,7 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         attr.Set(3.0, .Default())
         
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, .Default()))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.Get(&radius, .Default()))
         XCTAssertTrue(value)
         XCTAssertEqual(radius, 3)
         
@@ -370,10 +370,28 @@ final class Observation_MutateUsdAttribute_ReadUsdAttribute: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(3.0, 7)
         
-        let (token, value) = registerNotification(attr.HasAuthoredValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.Block())
         XCTAssertFalse(attr.HasAuthoredValue())
     }
+    
+    // MARK: Unrelated reads
+    
+    func test_Set_unrelatedAttributesStaySilent() {
+        let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
+        let fooRadius = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
+        let barRadius = main.DefinePrim("/bar", "Sphere").GetAttribute("radius")
+        let fooColor = main.GetPrimAtPath("/foo").GetAttribute("displayColor")
+        fooRadius.Set(1.0, .Default())
+        barRadius.Set(1.0, .Default())
+        
+        let (fooRadiusToken, _) = registerNotification(reading: [.of(fooRadius)], fooRadius.HasAuthoredValue())
+        let (barRadiusToken, _) = registerNotification(reading: [.of(barRadius)], barRadius.HasAuthoredValue())
+        let (fooColorToken, _) = registerNotification(reading: [.of(fooColor)], fooColor.HasAuthoredValue())
+        
+        expectingOnlyNotifications([fooRadiusToken], fooRadius.Set(2.0, .Default()))
+        withExtendedLifetime((barRadiusToken, fooColorToken)) {}
+    }
 }
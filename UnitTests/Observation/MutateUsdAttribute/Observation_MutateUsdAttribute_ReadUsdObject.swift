@@ -31,7 +31,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(attr.GetMetadata("variability", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetMetadata("variability", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue(Overlay.SdfVariabilityVarying))
         
@@ -48,7 +48,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(attr.GetMetadata("typeName", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetMetadata("typeName", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue("double" as pxr.TfToken))
         
@@ -64,7 +64,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
         
-        let (token, value) = registerNotification(attr.HasMetadata("connectionPaths"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasMetadata("connectionPaths"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.AddConnection("/foo.displayColor", Overlay.UsdListPositionBackOfPrependList))
@@ -80,7 +80,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(attr.GetMetadata("connectionPaths", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetMetadata("connectionPaths", &vtValue))
         XCTAssertTrue(value)
         var listOp = pxr.SdfPathListOp()
         listOp.SetPrependedItems(["/foo.displayColor"], nil)
@@ -100,7 +100,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
         
-        let (token, value) = registerNotification(attr.HasMetadata("connectionPaths"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasMetadata("connectionPaths"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetConnections(["/foo.displayColor"]))
@@ -115,7 +115,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         attr.AddConnection("/foo.displayColor", Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(attr.HasMetadata("connectionPaths"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasMetadata("connectionPaths"))
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], attr.ClearConnections())
@@ -129,7 +129,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(attr.GetMetadata("colorSpace", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetMetadata("colorSpace", &vtValue))
         XCTAssertFalse(value)
         XCTAssertTrue(vtValue.IsEmpty())
         
@@ -145,7 +145,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetColorSpace("bar")
 
-        let (token, value) = registerNotification(attr.HasMetadata("colorSpace"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasMetadata("colorSpace"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearColorSpace())
@@ -159,7 +159,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(attr.GetMetadata("default", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetMetadata("default", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue(1.0))
         
@@ -175,7 +175,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(2.718, .Default())
         
-        let (token, value) = registerNotification(attr.HasAuthoredMetadata("default"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredMetadata("default"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.Clear())
@@ -189,7 +189,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(3.0, 5)
         
-        let (token, value) = registerNotification(attr.HasAuthoredMetadata("timeSamples"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredMetadata("timeSamples"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearAtTime(5))
@@ -203,7 +203,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(3.0, .Default())
         
-        let (token, value) = registerNotification(attr.HasAuthoredMetadata("default"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredMetadata("default"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearDefault())
@@ -217,7 +217,7 @@ final class Observation_MutateUsdAttribute_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(3.0, 7)
         
-        let (token, value) = registerNotification(attr.HasAuthoredMetadata("timeSamples"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredMetadata("timeSamples"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.Block())
@@ -29,7 +29,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -68,7 +68,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -107,7 +107,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -146,7 +146,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.AddConnection("/foo.displayColor", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -185,7 +185,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -224,7 +224,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.AddConnection("/foo.displayColor", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -263,7 +263,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -304,7 +304,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetColorSpace("bar")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -346,7 +346,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -385,7 +385,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
 
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -424,7 +424,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(2.718, .Default())
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -465,7 +465,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         attr.Set(3.0, 5)
         attr.Set(4.0, 6)
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -510,7 +510,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(3.0, .Default())
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -550,7 +550,7 @@ final class Observation_MutateUsdAttribute_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.Set(3.0, .Default())
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -31,7 +31,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let attr = p.GetAttribute("radius")
 
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "colorSpace", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "colorSpace", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetMetadata("colorSpace", pxr.VtValue("foo" as pxr.TfToken)))
@@ -44,7 +44,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let attr = p.GetAttribute("radius")
 
-        let (token, value) = registerNotification(layer.GetField("/foo.radius", "colorSpace"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo.radius", "colorSpace"))
         XCTAssertTrue(value.IsEmpty())
         
         expectingSomeNotifications([token], attr.SetMetadata("colorSpace", pxr.VtValue("foo" as pxr.TfToken)))
@@ -56,7 +56,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.GetColorConfiguration())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetColorConfiguration())
         XCTAssertEqual(value, pxr.SdfAssetPath(""))
         
         expectingSomeNotifications([token], p.SetMetadata("colorConfiguration", pxr.VtValue(pxr.SdfAssetPath("fizzy"))))
@@ -68,7 +68,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.HasColorManagementSystem())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasColorManagementSystem())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadata("colorManagementSystem", pxr.VtValue("fizzy" as pxr.TfToken)))
@@ -80,7 +80,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.GetComment())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetComment())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], p.SetMetadata("comment", pxr.VtValue("my doc" as std.string)))
@@ -93,7 +93,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.HasDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasDefaultPrim())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadata("defaultPrim", pxr.VtValue("foo" as pxr.TfToken)))
@@ -105,7 +105,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetStartTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], p.SetMetadata("startTimeCode", pxr.VtValue(17.0)))
@@ -117,7 +117,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.HasEndTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasEndTimeCode())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadata("endTimeCode", pxr.VtValue(17.0)))
@@ -129,7 +129,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.HasTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasTimeCodesPerSecond())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadata("timeCodesPerSecond", pxr.VtValue(17.0)))
@@ -141,7 +141,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.GetFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFramesPerSecond())
         XCTAssertEqual(value, 24)
         
         expectingSomeNotifications([token], p.SetMetadata("framesPerSecond", pxr.VtValue(17.0)))
@@ -153,7 +153,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.HasFramePrecision())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFramePrecision())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadata("framePrecision", pxr.VtValue(17.0)))
@@ -165,7 +165,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.GetOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetOwner())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], p.SetMetadata("owner", pxr.VtValue("fizz" as std.string)))
@@ -177,7 +177,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.GetSessionOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSessionOwner())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], p.SetMetadata("sessionOwner", pxr.VtValue("fizz" as std.string)))
@@ -189,7 +189,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.GetCustomLayerData())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetCustomLayerData())
         XCTAssertEqual(value, [:])
         
         expectingSomeNotifications([token], p.SetMetadata("customLayerData", pxr.VtValue(["fizz" : pxr.VtValue(17.0)] as pxr.VtDictionary)))
@@ -201,7 +201,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.GetExpressionVariables())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetExpressionVariables())
         XCTAssertEqual(value, [:])
         
         expectingSomeNotifications([token], p.SetMetadata("expressionVariables", pxr.VtValue(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)] as pxr.VtDictionary)))
@@ -213,7 +213,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.HasExpressionVariables())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasExpressionVariables())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadata("expressionVariables", pxr.VtValue(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)] as pxr.VtDictionary)))
@@ -225,7 +225,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(layer.GetNumSubLayerPaths())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetNumSubLayerPaths())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], p.SetMetadata("subLayers", pxr.VtValue([pathForStage(named: "Model.usda")] as Overlay.String_Vector)))
@@ -241,7 +241,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let attr = p.GetAttribute("radius")
         attr.SetMetadata("colorSpace", pxr.VtValue("foo" as pxr.TfToken))
 
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "colorSpace", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "colorSpace", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearMetadata("colorSpace"))
@@ -254,7 +254,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetColorConfiguration(pxr.SdfAssetPath("/myConfig"))
 
-        let (token, value) = registerNotification(layer.HasColorConfiguration())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasColorConfiguration())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("colorConfiguration"))
@@ -267,7 +267,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetColorManagementSystem("bar")
 
-        let (token, value) = registerNotification(layer.GetColorManagementSystem())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetColorManagementSystem())
         XCTAssertEqual(value, "bar")
         
         expectingSomeNotifications([token], p.ClearMetadata("colorManagementSystem"))
@@ -281,7 +281,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetDefaultPrim("foo")
 
-        let (token, value) = registerNotification(layer.GetDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetDefaultPrim())
         XCTAssertEqual(value, "foo")
         
         expectingSomeNotifications([token], p.ClearMetadata("defaultPrim"))
@@ -294,7 +294,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetDocumentation("foo")
 
-        let (token, value) = registerNotification(layer.GetDocumentation())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetDocumentation())
         XCTAssertEqual(value, "foo")
         
         expectingSomeNotifications([token], p.ClearMetadata("documentation"))
@@ -307,7 +307,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetStartTimeCode(6)
 
-        let (token, value) = registerNotification(layer.HasStartTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasStartTimeCode())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("startTimeCode"))
@@ -320,7 +320,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetEndTimeCode(6)
 
-        let (token, value) = registerNotification(layer.GetEndTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetEndTimeCode())
         XCTAssertEqual(value, 6)
         
         expectingSomeNotifications([token], p.ClearMetadata("endTimeCode"))
@@ -333,7 +333,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetTimeCodesPerSecond(6)
 
-        let (token, value) = registerNotification(layer.GetTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetTimeCodesPerSecond())
         XCTAssertEqual(value, 6)
         
         expectingSomeNotifications([token], p.ClearMetadata("timeCodesPerSecond"))
@@ -346,7 +346,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetFramesPerSecond(6)
 
-        let (token, value) = registerNotification(layer.HasFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFramesPerSecond())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("framesPerSecond"))
@@ -359,7 +359,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetFramePrecision(6)
 
-        let (token, value) = registerNotification(layer.GetFramePrecision())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFramePrecision())
         XCTAssertEqual(value, 6)
         
         expectingSomeNotifications([token], p.ClearMetadata("framePrecision"))
@@ -372,7 +372,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetOwner("foo")
 
-        let (token, value) = registerNotification(layer.HasOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasOwner())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("owner"))
@@ -385,7 +385,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetSessionOwner("foo")
 
-        let (token, value) = registerNotification(layer.HasSessionOwner())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSessionOwner())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("sessionOwner"))
@@ -398,7 +398,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetHasOwnedSubLayers(true)
 
-        let (token, value) = registerNotification(layer.GetHasOwnedSubLayers())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetHasOwnedSubLayers())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("hasOwnedSubLayers"))
@@ -411,7 +411,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.SetCustomLayerData(["foo" : pxr.VtValue("bar" as std.string)])
 
-        let (token, value) = registerNotification(layer.HasCustomLayerData())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasCustomLayerData())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("customLayerData"))
@@ -424,7 +424,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.InsertSubLayerPath("/foo.usda", 0)
 
-        let (token, value) = registerNotification(layer.GetSubLayerPaths())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSubLayerPaths())
         XCTAssertEqual(Array(value), ["/foo.usda"])
         
         expectingSomeNotifications([token], p.ClearMetadata("subLayers"))
@@ -437,7 +437,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.GetPseudoRoot()
         layer.InsertSubLayerPath("/foo.usda", 0)
 
-        let (token, value) = registerNotification(layer.GetSubLayerOffsets())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSubLayerOffsets())
         XCTAssertEqual(Array(value), [pxr.SdfLayerOffset(0, 1)])
         
         expectingSomeNotifications([token], p.ClearMetadata("subLayerOffsets"))
@@ -451,7 +451,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         layer.InsertSubLayerPath("/foo.usda", 0)
         layer.SetSubLayerOffset(pxr.SdfLayerOffset(0, 2), 0)
 
-        let (token, value) = registerNotification(layer.GetSubLayerOffset(0))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSubLayerOffset(0))
         XCTAssertEqual(value, pxr.SdfLayerOffset(0, 2))
         
         expectingSomeNotifications([token], p.ClearMetadata("subLayerOffsets"))
@@ -466,7 +466,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(layer.HasFieldDictKey("/foo", "assetInfo", "name", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFieldDictKey("/foo", "assetInfo", "name", &vtValue))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string)))
@@ -483,7 +483,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string))
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(layer.HasFieldDictKey("/foo", "assetInfo", "name", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFieldDictKey("/foo", "assetInfo", "name", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue("fizzy" as std.string))
         
@@ -498,7 +498,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.ListFields("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/foo"))
         XCTAssertEqual(value, ["specifier", "typeName"])
         
         expectingSomeNotifications([token], p.SetHidden(true))
@@ -513,7 +513,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetHidden(true)
         
-        let (token, value) = registerNotification(layer.ListFields("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/foo"))
         XCTAssertEqual(value, ["specifier", "typeName", "hidden"])
         
         expectingSomeNotifications([token], p.ClearHidden())
@@ -527,7 +527,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasField("/foo", "customData", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "customData", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)]))
@@ -541,7 +541,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasFieldDictKey("/foo", "customData", "fizz", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFieldDictKey("/foo", "customData", "fizz", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetCustomDataByKey("fizz", pxr.VtValue("buzz" as pxr.TfToken)))
@@ -556,7 +556,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)])
         
-        let (token, value) = registerNotification(layer.HasField("/foo", "customData", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "customData", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearCustomData())
@@ -571,7 +571,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetCustomDataByKey("fizz", pxr.VtValue("buzz" as pxr.TfToken))
         
-        let (token, value) = registerNotification(layer.HasFieldDictKey("/foo", "customData", "fizz", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFieldDictKey("/foo", "customData", "fizz", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearCustomDataByKey("fizz"))
@@ -585,7 +585,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasField("/foo", "assetInfo", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "assetInfo", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetAssetInfo(["name" : pxr.VtValue("fizzy" as std.string)]))
@@ -599,7 +599,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasFieldDictKey("/foo", "assetInfo", "name", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFieldDictKey("/foo", "assetInfo", "name", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetAssetInfoByKey("name", pxr.VtValue("fizzy" as std.string)))
@@ -614,7 +614,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetAssetInfo(["name" : pxr.VtValue("fizzy" as std.string)])
         
-        let (token, value) = registerNotification(layer.HasField("/foo", "assetInfo", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "assetInfo", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearAssetInfo())
@@ -629,7 +629,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetAssetInfo(["name" : pxr.VtValue("fizzy" as std.string)])
         
-        let (token, value) = registerNotification(layer.HasFieldDictKey("/foo", "assetInfo", "name", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasFieldDictKey("/foo", "assetInfo", "name", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearAssetInfoByKey("name"))
@@ -643,7 +643,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasField("/foo", "documentation", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "documentation", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetDocumentation("my documentation string"))
@@ -658,7 +658,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetDocumentation("my documentation string")
         
-        let (token, value) = registerNotification(layer.HasField("/foo", "documentation", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "documentation", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearDocumentation())
@@ -672,7 +672,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasField("/foo", "displayName", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "displayName", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetDisplayName("bar"))
@@ -687,7 +687,7 @@ final class Observation_MutateUsdObject_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetDisplayName("bar")
         
-        let (token, value) = registerNotification(layer.HasField("/foo", "displayName", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "displayName", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearDisplayName())
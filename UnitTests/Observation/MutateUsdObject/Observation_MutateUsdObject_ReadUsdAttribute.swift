@@ -30,7 +30,7 @@ final class Observation_MutateUsdObject_ReadUsdAttribute: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let attr = p.GetAttribute("radius")
 
-        let (token, value) = registerNotification(attr.GetColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetColorSpace())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], attr.SetMetadata("colorSpace", pxr.VtValue("foo" as pxr.TfToken)))
@@ -45,7 +45,7 @@ final class Observation_MutateUsdObject_ReadUsdAttribute: ObservationHelper {
         let attr = p.GetAttribute("radius")
         attr.SetMetadata("colorSpace", pxr.VtValue("foo" as pxr.TfToken))
 
-        let (token, value) = registerNotification(attr.GetColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetColorSpace())
         XCTAssertEqual(value, "foo")
         
         expectingSomeNotifications([token], attr.ClearMetadata("colorSpace"))
@@ -30,7 +30,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
 
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(p.GetMetadata("active", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetMetadata("active", &vtValue))
         XCTAssertFalse(value)
         XCTAssertTrue(vtValue.IsEmpty())
         
@@ -43,7 +43,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(p.HasMetadata("active"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasMetadata("active"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadata("active", pxr.VtValue(false)))
@@ -54,7 +54,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("active"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("active"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadata("active", pxr.VtValue(false)))
@@ -69,7 +69,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         p.SetMetadata("active", pxr.VtValue(false))
 
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(p.GetMetadata("active", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetMetadata("active", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue(false))
         
@@ -82,7 +82,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetMetadata("active", pxr.VtValue(false))
 
-        let (token, value) = registerNotification(p.HasMetadata("active"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasMetadata("active"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("active"))
@@ -94,7 +94,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetMetadata("active", pxr.VtValue(false))
 
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("active"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("active"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("active"))
@@ -108,7 +108,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(p.GetMetadataByDictKey("assetInfo", "name", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetMetadataByDictKey("assetInfo", "name", &vtValue))
         XCTAssertFalse(value)
         XCTAssertTrue(vtValue.IsEmpty())
         
@@ -121,7 +121,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.HasMetadataDictKey("assetInfo", "name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasMetadataDictKey("assetInfo", "name"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string)))
@@ -132,7 +132,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadataDictKey("assetInfo", "name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadataDictKey("assetInfo", "name"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string)))
@@ -144,7 +144,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         
         
-        let (token, value) = registerNotification(p.GetAllMetadata())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAllMetadata())
         XCTAssertEqual(value.size(), 2)
         XCTAssertEqual(value["specifier"], pxr.VtValue(Overlay.SdfSpecifierDef))
         XCTAssertEqual(value["typeName"], pxr.VtValue("Sphere" as pxr.TfToken))
@@ -162,7 +162,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         
         
-        let (token, value) = registerNotification(p.GetAllAuthoredMetadata())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAllAuthoredMetadata())
         XCTAssertEqual(value.size(), 2)
         XCTAssertEqual(value["specifier"], pxr.VtValue(Overlay.SdfSpecifierDef))
         XCTAssertEqual(value["typeName"], pxr.VtValue("Sphere" as pxr.TfToken))
@@ -183,7 +183,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string))
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(p.GetMetadataByDictKey("assetInfo", "name", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetMetadataByDictKey("assetInfo", "name", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue("fizzy" as std.string))
 
@@ -196,7 +196,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string))
         
-        let (token, value) = registerNotification(p.HasMetadataDictKey("assetInfo", "name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasMetadataDictKey("assetInfo", "name"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadataByDictKey("assetInfo", "name"))
@@ -208,7 +208,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string))
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadataDictKey("assetInfo", "name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadataDictKey("assetInfo", "name"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadataByDictKey("assetInfo", "name"))
@@ -220,7 +220,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string))
         
-        let (token, value) = registerNotification(p.GetAllMetadata())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAllMetadata())
         XCTAssertEqual(value.size(), 3)
         XCTAssertEqual(value["assetInfo"], pxr.VtValue(["name" : pxr.VtValue("fizzy" as std.string)] as pxr.VtDictionary))
         XCTAssertEqual(value["specifier"], pxr.VtValue(Overlay.SdfSpecifierDef))
@@ -238,7 +238,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string))
         
-        let (token, value) = registerNotification(p.GetAllAuthoredMetadata())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAllAuthoredMetadata())
         XCTAssertEqual(value.size(), 3)
         XCTAssertEqual(value["assetInfo"], pxr.VtValue(["name" : pxr.VtValue("fizzy" as std.string)] as pxr.VtDictionary))
         XCTAssertEqual(value["specifier"], pxr.VtValue(Overlay.SdfSpecifierDef))
@@ -257,7 +257,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.IsHidden())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsHidden())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetHidden(true))
@@ -268,7 +268,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.HasAuthoredHidden())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredHidden())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetHidden(true))
@@ -282,7 +282,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetHidden(true)
         
-        let (token, value) = registerNotification(p.IsHidden())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsHidden())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearHidden())
@@ -294,7 +294,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetHidden(true)
         
-        let (token, value) = registerNotification(p.HasAuthoredHidden())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredHidden())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearHidden())
@@ -307,7 +307,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.GetCustomData())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetCustomData())
         XCTAssertEqual(value, ["userDocBrief" : pxr.VtValue("Defines a primitive sphere centered at the origin." as std.string)])
         
         expectingSomeNotifications([token], p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)]))
@@ -319,7 +319,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "")
         
-        let (token, value) = registerNotification(p.HasCustomData())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasCustomData())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)]))
@@ -332,7 +332,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.GetCustomDataByKey("fizz"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetCustomDataByKey("fizz"))
         XCTAssertTrue(value.IsEmpty())
         
         expectingSomeNotifications([token], p.SetCustomDataByKey("fizz", pxr.VtValue("buzz" as pxr.TfToken)))
@@ -343,7 +343,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.HasCustomDataKey("fizz"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasCustomDataKey("fizz"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetCustomDataByKey("fizz", pxr.VtValue("buzz" as pxr.TfToken)))
@@ -357,7 +357,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "")
         p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)])
         
-        let (token, value) = registerNotification(p.GetCustomData())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetCustomData())
         XCTAssertEqual(value, ["fizz" : pxr.VtValue("buzz" as pxr.TfToken)])
         
         expectingSomeNotifications([token], p.ClearCustomData())
@@ -369,7 +369,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "")
         p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)])
         
-        let (token, value) = registerNotification(p.HasCustomData())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasCustomData())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearCustomData())
@@ -383,7 +383,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)])
         
-        let (token, value) = registerNotification(p.GetCustomDataByKey("fizz"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetCustomDataByKey("fizz"))
         XCTAssertEqual(value, pxr.VtValue("buzz" as pxr.TfToken))
         
         expectingSomeNotifications([token], p.ClearCustomDataByKey("fizz"))
@@ -395,7 +395,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)])
         
-        let (token, value) = registerNotification(p.HasCustomDataKey("fizz"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasCustomDataKey("fizz"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearCustomDataByKey("fizz"))
@@ -408,7 +408,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.GetAssetInfo())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAssetInfo())
         XCTAssertEqual(value, [:])
         
         expectingSomeNotifications([token], p.SetAssetInfo(["name" : pxr.VtValue("fizzy" as std.string)]))
@@ -419,7 +419,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.HasAssetInfo())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAssetInfo())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetAssetInfo(["name" : pxr.VtValue("fizzy" as std.string)]))
@@ -432,7 +432,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.GetAssetInfoByKey("name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAssetInfoByKey("name"))
         XCTAssertTrue(value.IsEmpty())
         
         expectingSomeNotifications([token], p.SetAssetInfoByKey("name", pxr.VtValue("fizzy" as std.string)))
@@ -443,7 +443,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.HasAssetInfoKey("name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAssetInfoKey("name"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetAssetInfoByKey("name", pxr.VtValue("fizzy" as std.string)))
@@ -457,7 +457,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetAssetInfo(["name" : pxr.VtValue("fizzy" as std.string)])
         
-        let (token, value) = registerNotification(p.GetAssetInfo())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAssetInfo())
         XCTAssertEqual(value, ["name" : pxr.VtValue("fizzy" as std.string)])
         
         expectingSomeNotifications([token], p.ClearAssetInfo())
@@ -469,7 +469,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetAssetInfo(["name" : pxr.VtValue("fizzy" as std.string)])
         
-        let (token, value) = registerNotification(p.HasAssetInfo())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAssetInfo())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearAssetInfo())
@@ -483,7 +483,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetAssetInfoByKey("name", pxr.VtValue("fizzy" as std.string))
         
-        let (token, value) = registerNotification(p.GetAssetInfoByKey("name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAssetInfoByKey("name"))
         XCTAssertEqual(value, pxr.VtValue("fizzy" as std.string))
         
         expectingSomeNotifications([token], p.ClearAssetInfo())
@@ -495,7 +495,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetAssetInfoByKey("name", pxr.VtValue("fizzy" as std.string))
         
-        let (token, value) = registerNotification(p.HasAssetInfoKey("name"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAssetInfoKey("name"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearAssetInfo())
@@ -508,7 +508,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.GetDocumentation())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetDocumentation())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], p.SetDocumentation("my documentation string"))
@@ -519,7 +519,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.HasAuthoredDocumentation())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredDocumentation())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetDocumentation("my documentation string"))
@@ -533,7 +533,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetDocumentation("my documentation string")
         
-        let (token, value) = registerNotification(p.GetDocumentation())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetDocumentation())
         XCTAssertEqual(value, "my documentation string")
         
         expectingSomeNotifications([token], p.ClearDocumentation())
@@ -545,7 +545,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetDocumentation("my documentation string")
         
-        let (token, value) = registerNotification(p.HasAuthoredDocumentation())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredDocumentation())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearDocumentation())
@@ -558,7 +558,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.GetDisplayName())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetDisplayName())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], p.SetDisplayName("bar"))
@@ -569,7 +569,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.HasAuthoredDisplayName())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredDisplayName())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetDisplayName("bar"))
@@ -583,7 +583,7 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetDisplayName("bar")
         
-        let (token, value) = registerNotification(p.GetDisplayName())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetDisplayName())
         XCTAssertEqual(value, "bar")
         
         expectingSomeNotifications([token], p.ClearDisplayName())
@@ -595,10 +595,29 @@ final class Observation_MutateUsdObject_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetDisplayName("bar")
         
-        let (token, value) = registerNotification(p.HasAuthoredDisplayName())
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredDisplayName())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearDisplayName())
         XCTAssertFalse(p.HasAuthoredDisplayName())
     }
+    
+    // MARK: Unrelated reads
+    
+    func test_SetCustomDataByKey_unrelatedObjectsStaySilent() {
+        let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
+        let foo = main.DefinePrim("/foo", "Sphere")
+        let bar = main.DefinePrim("/bar", "Sphere")
+        let fooRadius = foo.GetAttribute("radius")
+        fooRadius.Set(1.0, .Default())
+        
+        let (fooToken, _) = registerNotification(reading: [.of(foo)], foo.HasCustomData())
+        let (barToken, _) = registerNotification(reading: [.of(bar)], bar.HasCustomData())
+        let (fooRadiusToken, _) = registerNotification(reading: [.of(fooRadius)], fooRadius.HasCustomData())
+        
+        expectingOnlyNotifications([fooToken], foo.SetCustomDataByKey("fizz", pxr.VtValue("foo" as std.string)))
+        // Prim reads include the prim's properties
+        expectingOnlyNotifications([fooToken, fooRadiusToken], fooRadius.SetCustomDataByKey("fizz", pxr.VtValue("foo" as std.string)))
+        withExtendedLifetime(barToken) {}
+    }
 }
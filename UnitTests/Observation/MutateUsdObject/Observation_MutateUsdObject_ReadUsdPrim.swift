@@ -29,7 +29,7 @@ final class Observation_MutateUsdObject_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(p.IsActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsActive())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.SetMetadata("active", pxr.VtValue(false)))
@@ -43,7 +43,7 @@ final class Observation_MutateUsdObject_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetMetadata("active", pxr.VtValue(false))
 
-        let (token, value) = registerNotification(p.IsActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsActive())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("active"))
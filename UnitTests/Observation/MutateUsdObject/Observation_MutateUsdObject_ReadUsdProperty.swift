@@ -30,7 +30,7 @@ final class Observation_MutateUsdObject_ReadUsdProperty: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let attr = p.GetAttribute("radius")
 
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetMetadata("displayGroup", pxr.VtValue("foo" as std.string)))
@@ -45,7 +45,7 @@ final class Observation_MutateUsdObject_ReadUsdProperty: ObservationHelper {
         let attr = p.GetAttribute("radius")
         attr.SetMetadata("displayGroup", pxr.VtValue("foo" as std.string))
 
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearMetadata("displayGroup"))
@@ -32,7 +32,7 @@ final class Observation_MutateUsdObject_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -50,7 +50,7 @@ final class Observation_MutateUsdObject_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -70,7 +70,7 @@ final class Observation_MutateUsdObject_ReadUsdRelationship: ObservationHelper {
         rel.AddTarget("/foo.fizzbuzz", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.fizzbuzz"])
         
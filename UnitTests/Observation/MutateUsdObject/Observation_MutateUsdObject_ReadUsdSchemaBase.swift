@@ -30,7 +30,7 @@ final class Observation_MutateUsdObject_ReadUsdSchemaBase: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         
         let schema = pxr.UsdPhysicsRigidBodyAPI(p)
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(schema))
         XCTAssertFalse(value)
         
         var listOp = pxr.SdfTokenListOp()
@@ -47,7 +47,7 @@ final class Observation_MutateUsdObject_ReadUsdSchemaBase: ObservationHelper {
         p.ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
         
         let schema = pxr.UsdPhysicsRigidBodyAPI(p)
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearMetadata("apiSchemas"))
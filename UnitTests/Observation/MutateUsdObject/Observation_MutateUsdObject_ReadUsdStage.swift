@@ -30,7 +30,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let attr = p.GetAttribute("radius")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -68,7 +68,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(main.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetStartTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], p.SetMetadata("startTimeCode", pxr.VtValue(7.28)))
@@ -80,7 +80,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.GetPseudoRoot()
         main.SetStartTimeCode(2)
         
-        let (token, value) = registerNotification(main.HasAuthoredTimeCodeRange())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredTimeCodeRange())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetMetadata("endTimeCode", pxr.VtValue(7.28)))
@@ -91,7 +91,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.GetPseudoRoot()
         
-        let (token, value) = registerNotification(main.GetTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetTimeCodesPerSecond())
         XCTAssertEqual(value, 24)
         
         expectingSomeNotifications([token], p.SetMetadata("timeCodesPerSecond", pxr.VtValue(7.28)))
@@ -106,7 +106,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let attr = p.GetAttribute("radius")
         attr.SetMetadata("colorSpace", pxr.VtValue("foo" as pxr.TfToken))
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -146,7 +146,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.GetPseudoRoot()
         main.SetEndTimeCode(7.28)
         
-        let (token, value) = registerNotification(main.GetEndTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetEndTimeCode())
         XCTAssertEqual(value, 7.28)
         
         expectingSomeNotifications([token], p.ClearMetadata("endTimeCode"))
@@ -158,7 +158,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.GetPseudoRoot()
         main.SetFramesPerSecond(7.28)
         
-        let (token, value) = registerNotification(main.GetFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetFramesPerSecond())
         XCTAssertEqual(value, 7.28)
         
         expectingSomeNotifications([token], p.ClearMetadata("framesPerSecond"))
@@ -171,7 +171,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -213,7 +213,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetMetadataByDictKey("assetInfo", "name", pxr.VtValue("fizzy" as std.string))
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -254,7 +254,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -294,7 +294,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetHidden(true)
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -333,7 +333,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -374,7 +374,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -416,7 +416,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)])
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -458,7 +458,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetCustomData(["fizz" : pxr.VtValue("buzz" as pxr.TfToken)])
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -499,7 +499,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -540,7 +540,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -582,7 +582,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetAssetInfo(["name" : pxr.VtValue("fizzy" as std.string)])
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -624,7 +624,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetAssetInfoByKey("name", pxr.VtValue("fizzy" as std.string))
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -665,7 +665,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -705,7 +705,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetDocumentation("my documentation string")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -744,7 +744,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -784,7 +784,7 @@ final class Observation_MutateUsdObject_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         p.SetDisplayName("bar")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -30,7 +30,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(layer.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
 
@@ -60,7 +60,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(layer.GetFieldAs("/foo", "typeName", pxr.TfToken()))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFieldAs("/foo", "typeName", pxr.TfToken()))
         XCTAssertEqual(value, "Cube")
         
         expectingSomeNotifications([token], p.SetTypeName("Sphere"))
@@ -74,7 +74,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(layer.HasField("/foo", "typeName", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "typeName", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearTypeName())
@@ -88,7 +88,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(layer.HasField("/foo", "active", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "active", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetActive(false))
@@ -103,7 +103,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         p.SetActive(true)
 
-        let (token, value) = registerNotification(layer.HasField("/foo", "active", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo", "active", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearActive())
@@ -117,7 +117,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(layer.ListFields("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/foo"))
         XCTAssertEqual(value, ["specifier", "typeName"])
         
         expectingSomeNotifications([token], p.SetPropertyOrder(["fizz"]))
@@ -132,7 +132,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         p.SetPropertyOrder(["fizz"])
         
-        let (token, value) = registerNotification(layer.ListFields("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/foo"))
         XCTAssertEqual(value, ["specifier", "typeName", "propertyOrder"])
         
         expectingSomeNotifications([token], p.ClearPropertyOrder())
@@ -147,7 +147,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         var p = main.DefinePrim("/foo", "Cube")
         p.CreateRelationship("alpha", true)
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo.alpha"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo.alpha"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.RemoveProperty("alpha"))
@@ -161,7 +161,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(layer.ListFields("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/foo"))
         XCTAssertEqual(value, ["specifier", "typeName"])
         
         expectingSomeNotifications([token], p.SetKind("component"))
@@ -175,7 +175,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(layer.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
 
@@ -212,7 +212,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         var listOp = pxr.SdfTokenListOp()
         listOp.SetItems(["PhysicsRigidBodyAPI"], Overlay.SdfListOpTypePrepended, nil)
 
-        let (token, value) = registerNotification(layer.GetField("/foo", "apiSchemas"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo", "apiSchemas"))
         XCTAssertEqual(value, pxr.VtValue(listOp))
         
         expectingSomeNotifications([token], p.RemoveAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -228,7 +228,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(layer.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
 
@@ -264,7 +264,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         var listOp = pxr.SdfTokenListOp()
         listOp.SetItems(["PhysicsRigidBodyAPI"], Overlay.SdfListOpTypePrepended, nil)
 
-        let (token, value) = registerNotification(layer.GetField("/foo", "apiSchemas"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo", "apiSchemas"))
         XCTAssertEqual(value, pxr.VtValue(listOp))
         
         expectingSomeNotifications([token], p.RemoveAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -284,7 +284,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         main.DefinePrim("/foo/delta", "Sphere")
         
         
-        let (token, value) = registerNotification(layer.GetField("/foo", "primOrder"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo", "primOrder"))
         XCTAssertTrue(value.IsEmpty())
         
         expectingSomeNotifications([token], foo.SetChildrenReorder(["delta", "bar"]))
@@ -302,7 +302,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         main.DefinePrim("/foo/delta", "Sphere")
         foo.SetChildrenReorder(["delta", "bar"])
         
-        let (token, value) = registerNotification(layer.GetField("/foo", "primOrder"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo", "primOrder"))
         XCTAssertEqual(value, pxr.VtValue(["delta", "bar"] as pxr.TfTokenVector))
         
         expectingSomeNotifications([token], foo.ClearChildrenReorder())
@@ -316,7 +316,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(layer.HasSpec("/foo.myAttr"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo.myAttr"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying))
@@ -330,7 +330,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(layer.HasSpec("/foo.myRel"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo.myRel"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.CreateRelationship("myRel", true))
@@ -351,7 +351,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         foo.SetPayload(pathForStage(named: "Payload.usda"), "/root")
         
         
-        let (token, value) = registerNotification(layer.ListFields("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/foo"))
         XCTAssertEqual(value, ["specifier", "typeName", "payload"])
         
         expectingSomeNotifications([token], foo.ClearPayload())
@@ -371,7 +371,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
                 
         
-        let (token, value) = registerNotification(layer.ListFields("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/foo"))
         XCTAssertEqual(value, ["specifier", "typeName"])
         
         expectingSomeNotifications([token], foo.SetPayload(pathForStage(named: "Payload.usda"), "/root"))
@@ -385,7 +385,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(mainStage.GetRootLayer())
         let scopePrim = mainStage.DefinePrim("/smallModel", "Scope")
 
-        let (token, value) = registerNotification(layer.ListFields("/smallModel"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/smallModel"))
         XCTAssertEqual(value, ["specifier", "typeName"])
         
         expectingSomeNotifications([token], scopePrim.SetInstanceable(true))
@@ -400,7 +400,7 @@ final class Observation_MutateUsdPrim_ReadSdfLayer: ObservationHelper {
         let scopePrim = mainStage.DefinePrim("/smallModel", "Scope")
         scopePrim.SetInstanceable(true)
 
-        let (token, value) = registerNotification(layer.ListFields("/smallModel"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.ListFields("/smallModel"))
         XCTAssertEqual(value, ["specifier", "typeName", "instanceable"])
         
         expectingSomeNotifications([token], scopePrim.ClearInstanceable())
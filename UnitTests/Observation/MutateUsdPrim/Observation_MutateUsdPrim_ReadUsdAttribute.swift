@@ -30,7 +30,7 @@ final class Observation_MutateUsdPrim_ReadUsdAttribute: ObservationHelper {
         let p = main.DefinePrim("/foo", "")
         let attr = p.CreateAttribute("radius", .Float3, false, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(attr.GetTypeName())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetTypeName())
         XCTAssertEqual(value, .Float3)
         
         expectingSomeNotifications([token], p.SetTypeName("Sphere"))
@@ -44,7 +44,7 @@ final class Observation_MutateUsdPrim_ReadUsdAttribute: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let attr = p.GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.GetTypeName())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetTypeName())
         XCTAssertEqual(value, .Double)
         
         expectingSomeNotifications([token], p.ClearTypeName())
@@ -68,7 +68,7 @@ final class Observation_MutateUsdPrim_ReadUsdAttribute: ObservationHelper {
         main.SetEditTarget(pxr.UsdEditTarget(sub2.GetRootLayer(), pxr.SdfLayerOffset(0, 1)))
         attr.SetTypeName(.Bool)
         
-        let (token, value) = registerNotification(attr.GetTypeName())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetTypeName())
         XCTAssertEqual(value, .Bool)
         
         expectingSomeNotifications([token], p.RemoveProperty("alpha"))
@@ -84,7 +84,7 @@ final class Observation_MutateUsdPrim_ReadUsdAttribute: ObservationHelper {
         let attr = foo.CreateAttribute("physics:velocity", .Vector3f, false, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -101,7 +101,7 @@ final class Observation_MutateUsdPrim_ReadUsdAttribute: ObservationHelper {
         foo.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
         
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.RemoveAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -117,7 +117,7 @@ final class Observation_MutateUsdPrim_ReadUsdAttribute: ObservationHelper {
         let attr = foo.CreateAttribute("physics:velocity", .Vector3f, false, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -134,7 +134,7 @@ final class Observation_MutateUsdPrim_ReadUsdAttribute: ObservationHelper {
         foo.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
         
         
-        let (token, value) = registerNotification(attr.HasValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.RemoveAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -157,7 +157,7 @@ final class Observation_MutateUsdPrim_ReadUsdAttribute: ObservationHelper {
         let attr = foo.GetAttributeAtPath("model.radius")
         
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, 5))
+        let (token, value) = registerNotification(reading: [.object(foo, "model.radius")], attr.Get(&radius, 5))
         XCTAssertTrue(value)
         XCTAssertEqual(radius, 7)
         
@@ -180,7 +180,7 @@ final class Observation_MutateUsdPrim_ReadUsdAttribute: ObservationHelper {
         let attr = foo.GetAttributeAtPath("model.radius")
         
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, 5))
+        let (token, value) = registerNotification(reading: [.object(foo, "model.radius")], attr.Get(&radius, 5))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetPayload(pathForStage(named: "Payload.usda"), "/root"))
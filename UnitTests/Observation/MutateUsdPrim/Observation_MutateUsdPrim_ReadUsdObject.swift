@@ -30,7 +30,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
 
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(p.GetMetadata("specifier", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetMetadata("specifier", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue(Overlay.SdfSpecifierDef))
         
@@ -46,7 +46,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(p.GetMetadata("typeName", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetMetadata("typeName", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue("Cube" as pxr.TfToken))
         
@@ -61,7 +61,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(p.HasMetadata("typeName"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasMetadata("typeName"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearTypeName())
@@ -75,7 +75,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Cube")
         let p = main.DefinePrim("/foo/p", "Sphere")
 
-        let (token, value) = registerNotification(Bool(p))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(p))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.SetActive(false))
@@ -89,7 +89,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Cube")
         foo.SetActive(true)
 
-        let (token, value) = registerNotification(foo.HasAuthoredMetadata("active"))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasAuthoredMetadata("active"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ClearActive())
@@ -102,7 +102,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(foo.HasAuthoredMetadata("propertyOrder"))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasAuthoredMetadata("propertyOrder"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetPropertyOrder(["alpha"]))
@@ -116,7 +116,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Cube")
         foo.SetPropertyOrder(["alpha"])
 
-        let (token, value) = registerNotification(foo.HasAuthoredMetadata("propertyOrder"))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasAuthoredMetadata("propertyOrder"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ClearPropertyOrder())
@@ -130,7 +130,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         var p = main.DefinePrim("/foo", "Cube")
         let attr = p.CreateAttribute("alpha", .Double, true, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(attr.IsValid())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.RemoveProperty("alpha"))
@@ -143,7 +143,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(p.HasMetadata("kind"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasMetadata("kind"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetKind("component"))
@@ -156,7 +156,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("apiSchemas"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("apiSchemas"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -173,7 +173,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         var vtValue = pxr.VtValue()
         var listOp = pxr.SdfTokenListOp()
         listOp.SetItems(["PhysicsRigidBodyAPI"], Overlay.SdfListOpTypeExplicit, nil)
-        let (token, value) = registerNotification(p.GetMetadata("apiSchemas", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetMetadata("apiSchemas", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue(listOp))
         
@@ -190,7 +190,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("apiSchemas"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("apiSchemas"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -207,7 +207,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         var vtValue = pxr.VtValue()
         var listOp = pxr.SdfTokenListOp()
         listOp.SetItems(["PhysicsRigidBodyAPI"], Overlay.SdfListOpTypeExplicit, nil)
-        let (token, value) = registerNotification(p.GetMetadata("apiSchemas", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetMetadata("apiSchemas", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue(listOp))
         
@@ -228,7 +228,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         main.DefinePrim("/foo/delta", "Sphere")
         
         
-        let (token, value) = registerNotification(foo.HasMetadata("primOrder"))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasMetadata("primOrder"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetChildrenReorder(["delta", "bar"]))
@@ -245,7 +245,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         main.DefinePrim("/foo/delta", "Sphere")
         foo.SetChildrenReorder(["delta", "bar"])
         
-        let (token, value) = registerNotification(foo.HasMetadata("primOrder"))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasMetadata("primOrder"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ClearChildrenReorder())
@@ -259,7 +259,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         let attr = foo.GetAttribute("myAttr")
 
-        let (token, value) = registerNotification(Bool(attr))
+        let (token, value) = registerNotification(reading: [.of(attr)], Bool(attr))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying))
@@ -273,7 +273,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         let rel = foo.GetRelationship("myRel")
 
-        let (token, value) = registerNotification(Bool(rel))
+        let (token, value) = registerNotification(reading: [.of(rel)], Bool(rel))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.CreateRelationship("myRel", true))
@@ -293,7 +293,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         foo.SetPayload(pathForStage(named: "Payload.usda"), "/root")
         
         
-        let (token, value) = registerNotification(foo.HasMetadata("payload"))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasMetadata("payload"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ClearPayload())
@@ -312,7 +312,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         
         
-        let (token, value) = registerNotification(foo.HasMetadata("payload"))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasMetadata("payload"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetPayload(pathForStage(named: "Payload.usda"), "/root"))
@@ -332,7 +332,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], scopePrim.Load(Overlay.UsdLoadWithDescendants))
@@ -352,7 +352,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], scopePrim.Unload())
@@ -365,7 +365,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let mainStage = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let scopePrim = mainStage.DefinePrim("/smallModel", "Scope")
 
-        let (token, value) = registerNotification(scopePrim.HasAuthoredMetadata("instanceable"))
+        let (token, value) = registerNotification(reading: [.of(scopePrim)], scopePrim.HasAuthoredMetadata("instanceable"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], scopePrim.SetInstanceable(true))
@@ -379,7 +379,7 @@ final class Observation_MutateUsdPrim_ReadUsdObject: ObservationHelper {
         let scopePrim = mainStage.DefinePrim("/smallModel", "Scope")
         scopePrim.SetInstanceable(true)
 
-        let (token, value) = registerNotification(scopePrim.HasAuthoredMetadata("instanceable"))
+        let (token, value) = registerNotification(reading: [.of(scopePrim)], scopePrim.HasAuthoredMetadata("instanceable"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], scopePrim.ClearInstanceable())
@@ -29,7 +29,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(p.GetSpecifier())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetSpecifier())
         XCTAssertEqual(value, Overlay.SdfSpecifierDef)
         
         expectingSomeNotifications([token], p.SetSpecifier(Overlay.SdfSpecifierClass))
@@ -42,7 +42,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(p.GetTypeName())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetTypeName())
         XCTAssertEqual(value, "Cube")
         
         expectingSomeNotifications([token], p.SetTypeName("Sphere"))
@@ -55,7 +55,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(p.HasProperty("size"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasProperty("size"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearTypeName())
@@ -68,7 +68,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(p.IsActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsActive())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.SetActive(false))
@@ -80,7 +80,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Cube")
         let p = main.DefinePrim("/foo/p", "Sphere")
 
-        let (token, value) = registerNotification(foo.GetChildrenNames())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetChildrenNames())
         XCTAssertEqual(value, ["p"])
         
         expectingSomeNotifications([token], p.SetActive(false))
@@ -94,7 +94,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         p.SetActive(false)
 
-        let (token, value) = registerNotification(p.IsActive())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsActive())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.ClearActive())
@@ -110,7 +110,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         p.CreateRelationship("beta", true)
         
         
-        let (token, value) = registerNotification(p.GetPropertyNames(Overlay.DefaultPropertyPredicateFunc))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetPropertyNames(Overlay.DefaultPropertyPredicateFunc))
         XCTAssertEqual(value, ["alpha", "beta"])
         
         expectingSomeNotifications([token], p.SetPropertyOrder(["beta", "alpha"]))
@@ -124,7 +124,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let beta = p.CreateRelationship("beta", true)
         
         
-        let (token, value) = registerNotification(p.GetProperties(Overlay.DefaultPropertyPredicateFunc))
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetProperties(Overlay.DefaultPropertyPredicateFunc))
         XCTAssertEqual(value.map { Overlay.UsdProperty_As($0) }, [alpha, beta])
         
         expectingSomeNotifications([token], p.SetPropertyOrder(["beta", "alpha"]))
@@ -138,7 +138,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         p.CreateRelationship("beta", true)
         
         
-        let (token, value) = registerNotification(p.GetPropertyOrder())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetPropertyOrder())
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], p.SetPropertyOrder(["beta", "alpha"]))
@@ -155,7 +155,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         p.SetPropertyOrder(["beta", "alpha"])
         
         
-        let (token, value) = registerNotification(p.GetPropertyOrder())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetPropertyOrder())
         XCTAssertEqual(value, ["beta", "alpha"])
         
         expectingSomeNotifications([token], p.ClearPropertyOrder())
@@ -169,7 +169,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         var p = main.DefinePrim("/foo", "Cube")
         p.CreateRelationship("alpha", true)
         
-        let (token, value) = registerNotification(p.HasProperty("alpha"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasProperty("alpha"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.RemoveProperty("alpha"))
@@ -182,7 +182,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(p.IsModel())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsModel())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], p.SetKind("component"))
@@ -197,7 +197,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo/bar/p", "Cube")
         p.SetKind("component")
         
-        let (token, value) = registerNotification(p.IsModel())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsModel())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], bar.SetKind("assembly"))
@@ -209,7 +209,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
 
         let foo = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(foo.IsGroup())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.IsGroup())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetKind("group"))
@@ -225,7 +225,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let fizz = main.DefinePrim("/foo/bar/fizz", "Cube")
         fizz.SetKind("group")
         
-        let (token, value) = registerNotification(fizz.IsGroup())
+        let (token, value) = registerNotification(reading: [.of(fizz)], fizz.IsGroup())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], bar.SetKind("group"))
@@ -236,7 +236,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(foo.IsComponent())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.IsComponent())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetKind("component"))
@@ -250,7 +250,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let fizz = main.DefinePrim("/foo/bar/fizz", "Cube")
         fizz.SetKind("component")
         
-        let (token, value) = registerNotification(fizz.IsComponent())
+        let (token, value) = registerNotification(reading: [.of(fizz)], fizz.IsComponent())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], bar.SetKind("assembly"))
@@ -265,7 +265,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let fizz = main.DefinePrim("/foo/bar/fizz", "Cube")
         fizz.SetKind("component")
         
-        let (token, value) = registerNotification(fizz.IsComponent())
+        let (token, value) = registerNotification(reading: [.of(fizz)], fizz.IsComponent())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], bar.SetKind("group"))
@@ -276,7 +276,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(foo.IsSubComponent())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.IsSubComponent())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetKind("subcomponent"))
@@ -288,7 +288,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Cube")
 
         var kind = pxr.TfToken()
-        let (token, value) = registerNotification(foo.GetKind(&kind))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetKind(&kind))
         XCTAssertFalse(value)
         XCTAssertEqual(kind, "")
         
@@ -303,7 +303,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(p.GetAppliedSchemas())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAppliedSchemas())
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], p.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -317,7 +317,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         p.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
 
-        let (token, value) = registerNotification(p.GetAppliedSchemas())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAppliedSchemas())
         XCTAssertEqual(value, [.UsdPhysicsTokens.PhysicsRigidBodyAPI])
         
         expectingSomeNotifications([token], p.RemoveAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -330,7 +330,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(p.GetAppliedSchemas())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAppliedSchemas())
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], p.ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -344,7 +344,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         p.ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
 
-        let (token, value) = registerNotification(p.GetAppliedSchemas())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAppliedSchemas())
         XCTAssertEqual(value, [.UsdPhysicsTokens.PhysicsRigidBodyAPI])
         
         expectingSomeNotifications([token], p.RemoveAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -361,7 +361,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let delta = main.DefinePrim("/foo/delta", "Sphere")
         
         
-        let (token, value) = registerNotification(Array(foo.GetChildren()))
+        let (token, value) = registerNotification(reading: [.of(foo)], Array(foo.GetChildren()))
         XCTAssertEqual(value, [bar, delta])
         
         expectingSomeNotifications([token], foo.SetChildrenReorder(["delta", "bar"]))
@@ -376,7 +376,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         main.DefinePrim("/foo/delta", "Sphere")
         
         
-        let (token, value) = registerNotification(foo.GetChildrenReorder())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetChildrenReorder())
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], foo.SetChildrenReorder(["delta", "bar"]))
@@ -393,7 +393,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let delta = main.DefinePrim("/foo/delta", "Sphere")
         foo.SetChildrenReorder(["delta", "bar"])
         
-        let (token, value) = registerNotification(Array(foo.GetChildren()))
+        let (token, value) = registerNotification(reading: [.of(foo)], Array(foo.GetChildren()))
         XCTAssertEqual(value, [delta, bar])
         
         expectingSomeNotifications([token], foo.ClearChildrenReorder())
@@ -408,7 +408,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         main.DefinePrim("/foo/delta", "Sphere")
         foo.SetChildrenReorder(["delta", "bar"])
         
-        let (token, value) = registerNotification(foo.GetChildrenReorder())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetChildrenReorder())
         XCTAssertEqual(value, ["delta", "bar"])
         
         expectingSomeNotifications([token], foo.ClearChildrenReorder())
@@ -421,7 +421,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(foo.GetAuthoredPropertyNames(Overlay.DefaultPropertyPredicateFunc))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetAuthoredPropertyNames(Overlay.DefaultPropertyPredicateFunc))
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], foo.CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying))
@@ -432,7 +432,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Scope")
 
-        let (token, value) = registerNotification(foo.GetAttributes())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetAttributes())
         XCTAssertEqual(value, [foo.GetAttribute("purpose"), foo.GetAttribute("visibility")])
         
         let attr = expectingSomeNotifications([token], foo.CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying))
@@ -443,7 +443,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Scope")
 
-        let (token, value) = registerNotification(foo.GetAuthoredAttributes())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetAuthoredAttributes())
         XCTAssertEqual(value, [])
         
         let attr = expectingSomeNotifications([token], foo.CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying))
@@ -454,7 +454,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(foo.HasAttribute("myAttr"))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasAttribute("myAttr"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying))
@@ -467,7 +467,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(foo.GetAuthoredPropertyNames(Overlay.DefaultPropertyPredicateFunc))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetAuthoredPropertyNames(Overlay.DefaultPropertyPredicateFunc))
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], foo.CreateRelationship("myRel", true))
@@ -478,7 +478,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(foo.GetRelationships())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetRelationships())
         XCTAssertEqual(value, [foo.GetRelationship("proxyPrim")])
         
         let rel = expectingSomeNotifications([token], foo.CreateRelationship("myRel", true))
@@ -489,7 +489,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(foo.GetAuthoredRelationships())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetAuthoredRelationships())
         XCTAssertEqual(value, [])
         
         let rel = expectingSomeNotifications([token], foo.CreateRelationship("myRel", true))
@@ -500,7 +500,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(foo.HasRelationship("myRel"))
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasRelationship("myRel"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.CreateRelationship("myRel", true))
@@ -520,7 +520,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         foo.SetPayload(pathForStage(named: "Payload.usda"), "/root")
         
         
-        let (token, value) = registerNotification(foo.HasPayload())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasPayload())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ClearPayload())
@@ -538,7 +538,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         foo.SetPayload(pathForStage(named: "Payload.usda"), "/root")
         
         
-        let (token, value) = registerNotification(foo.HasAuthoredPayloads())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasAuthoredPayloads())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ClearPayload())
@@ -557,7 +557,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         
         
-        let (token, value) = registerNotification(foo.HasPayload())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasPayload())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetPayload(pathForStage(named: "Payload.usda"), "/root"))
@@ -574,7 +574,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
                 
         
-        let (token, value) = registerNotification(foo.HasAuthoredPayloads())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.HasAuthoredPayloads())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetPayload(pathForStage(named: "Payload.usda"), "/root"))
@@ -596,7 +596,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rootPrim.GetAllDescendants())
+        let (token, value) = registerNotification(reading: [.of(rootPrim)], rootPrim.GetAllDescendants())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/root/smallModel")])
         
         expectingSomeNotifications([token], scopePrim.Load(Overlay.UsdLoadWithDescendants))
@@ -618,7 +618,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rootPrim.GetAllDescendants())
+        let (token, value) = registerNotification(reading: [.of(rootPrim)], rootPrim.GetAllDescendants())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/root/smallModel"), mainStage.GetPrimAtPath("/root/smallModel/bigModel")])
         
         expectingSomeNotifications([token], scopePrim.Unload())
@@ -631,7 +631,7 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let mainStage = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let scopePrim = mainStage.DefinePrim("/smallModel", "Scope")
 
-        let (token, value) = registerNotification(scopePrim.IsInstanceable())
+        let (token, value) = registerNotification(reading: [.of(scopePrim)], scopePrim.IsInstanceable())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], scopePrim.SetInstanceable(true))
@@ -645,10 +645,26 @@ final class Observation_MutateUsdPrim_ReadUsdPrim: ObservationHelper {
         let scopePrim = mainStage.DefinePrim("/smallModel", "Scope")
         scopePrim.SetInstanceable(true)
 
-        let (token, value) = registerNotification(scopePrim.HasAuthoredInstanceable())
+        let (token, value) = registerNotification(reading: [.of(scopePrim)], scopePrim.HasAuthoredInstanceable())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], scopePrim.ClearInstanceable())
         XCTAssertFalse(scopePrim.HasAuthoredInstanceable())
     }
+    
+    // MARK: Unrelated reads
+    
+    func test_SetKind_unrelatedPrimsStaySilent() {
+        let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
+        let foo = main.DefinePrim("/foo", "Scope")
+        let bar = main.DefinePrim("/bar", "Scope")
+        let fooChild = main.DefinePrim("/foo/child", "Scope")
+        
+        let (fooToken, _) = registerNotification(reading: [.of(foo)], foo.IsModel())
+        let (barToken, _) = registerNotification(reading: [.of(bar)], bar.IsModel())
+        let (fooChildToken, _) = registerNotification(reading: [.of(fooChild)], fooChild.IsModel())
+        
+        expectingOnlyNotifications([fooToken], foo.SetKind("component"))
+        withExtendedLifetime((barToken, fooChildToken)) {}
+    }
 }
@@ -30,7 +30,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         let attr = p.GetAttribute("size")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.SetTypeName("Sphere"))
@@ -44,7 +44,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         let attr = p.GetAttribute("size")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearTypeName())
@@ -59,7 +59,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         let foo = main.DefinePrim("/bar/foo", "Cube")
         let attr = foo.GetAttribute("size")
 
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], bar.SetActive(false))
@@ -85,7 +85,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         
         let attr = main.DefinePrim("/foo/bar", "Cube").GetAttribute("size")
 
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
                 
         expectingSomeNotifications([token], foo.ClearActive())
@@ -99,7 +99,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         var p = main.DefinePrim("/foo", "Cube")
         let rel = p.CreateRelationship("alpha", true)
         
-        let (token, value) = registerNotification(rel.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.RemoveProperty("alpha"))
@@ -115,7 +115,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         let attr = foo.CreateAttribute("physics:velocity", .Vector3f, true, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(attr.IsCustom())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsCustom())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -130,7 +130,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         p.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
         let attr = p.GetAttribute("physics:velocity")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.RemoveAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -146,7 +146,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         let attr = foo.CreateAttribute("physics:velocity", .Vector3f, true, Overlay.SdfVariabilityVarying)
         
         
-        let (token, value) = registerNotification(attr.IsCustom())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsCustom())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -161,7 +161,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         p.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
         let attr = p.GetAttribute("physics:velocity")
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.RemoveAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -175,7 +175,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         let attr = foo.GetAttribute("myAttr")
 
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.CreateAttribute("myAttr", .Double, true, Overlay.SdfVariabilityVarying))
@@ -189,7 +189,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         let rel = foo.GetRelationship("myRel")
 
-        let (token, value) = registerNotification(rel.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.IsDefined())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.CreateRelationship("myRel", true))
@@ -210,7 +210,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         let attr = foo.GetAttributeAtPath("model.radius")
         
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.object(foo, "model.radius")], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ClearPayload())
@@ -234,7 +234,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         let attr = foo.GetAttributeAtPath("model.radius")
         
         
-        let (token, value) = registerNotification(attr.GetPropertyStack(6.0))
+        let (token, value) = registerNotification(reading: [.object(foo, "model.radius")], attr.GetPropertyStack(6.0))
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], foo.SetPayload(pathForStage(named: "Payload.usda"), "/root"))
@@ -254,7 +254,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
+        let (token, value) = registerNotification(reading: [.object(mainStage, "/smallModel/bigModel.doubleSided")], mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], scopePrim.Load(Overlay.UsdLoadWithDescendants))
@@ -274,7 +274,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
+        let (token, value) = registerNotification(reading: [.object(mainStage, "/smallModel/bigModel.doubleSided")], mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], scopePrim.Unload())
@@ -291,7 +291,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         scopePrim.GetReferences().AddInternalReference("/instanceTarget", pxr.SdfLayerOffset(0, 1), Overlay.UsdListPositionBackOfPrependList)
         let attr = mainStage.DefinePrim("/smallModel/belowInstanceable", "Sphere").GetAttribute("radius")
 
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], scopePrim.SetInstanceable(true))
@@ -309,7 +309,7 @@ final class Observation_MutateUsdPrim_ReadUsdProperty: ObservationHelper {
         mainStage.DefinePrim("/smallModel/belowInstanceable", "Sphere")
         scopePrim.SetInstanceable(true)
 
-        let (token, value) = registerNotification(mainStage.GetAttributeAtPath("/smallModel/belowInstanceable.radius").IsDefined())
+        let (token, value) = registerNotification(reading: [.object(mainStage, "/smallModel/belowInstanceable.radius")], mainStage.GetAttributeAtPath("/smallModel/belowInstanceable.radius").IsDefined())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], scopePrim.ClearInstanceable())
@@ -32,7 +32,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         rel.AddTarget(".prototypes", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.prototypes"])
         
@@ -50,7 +50,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         rel.AddTarget(".prototypes", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -70,7 +70,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         main.DefinePrim("/foo/bar", "PointInstancer")
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -91,7 +91,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         foo.SetActive(false)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo/bar.prototypes"])
         
@@ -112,7 +112,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         otherRel.AddTarget(".radius", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(myRel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: myRel)], myRel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/p.radius"])
         
@@ -133,7 +133,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         
 
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(myRel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: myRel)], myRel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.physics:simulationOwner"])
         
@@ -154,7 +154,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         
 
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(myRel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: myRel)], myRel.GetForwardedTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -174,7 +174,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         
 
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(myRel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: myRel)], myRel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.physics:simulationOwner"])
         
@@ -195,7 +195,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         
 
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(myRel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: myRel)], myRel.GetForwardedTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -215,7 +215,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(firstRel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: firstRel)], firstRel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.secondRel"])
         
@@ -239,7 +239,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         foo.SetPayload(pathForStage(named: "Payload.usda"), "/root")
         let rel = foo.GetRelationshipAtPath("model.myRel")
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.object(foo, "model.myRel")], rel.HasAuthoredTargets())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ClearPayload())
@@ -260,7 +260,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         main.OverridePrim("/foo/model").CreateRelationship("myRel", true)
         let rel = foo.GetRelationshipAtPath("model.myRel")
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.object(foo, "model.myRel")], rel.HasAuthoredTargets())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetPayload(pathForStage(named: "Payload.usda"), "/root"))
@@ -286,7 +286,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         relationship.AddTarget("/smallModel/bigModel.otherRel", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(relationship.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: relationship)], relationship.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/smallModel/bigModel.otherRel"])
         
@@ -314,7 +314,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         relationship.AddTarget("/smallModel/bigModel.otherRel", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(relationship.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: relationship)], relationship.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/smallModel/bigModel.doubleSided"])
         
@@ -339,7 +339,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
             .AddTarget(".fizz", Overlay.UsdListPositionBackOfPrependList)
 
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(firstRel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: firstRel)], firstRel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/smallModel/child.fizz"])
         
@@ -364,7 +364,7 @@ final class Observation_MutateUsdPrim_ReadUsdRelationship: ObservationHelper {
         scopePrim.SetInstanceable(true)
 
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(firstRel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: firstRel)], firstRel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/smallModel/child.myProperty"])
         
@@ -30,7 +30,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let schema = pxr.UsdGeomSphere(p)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.SetTypeName("Cube"))
@@ -44,7 +44,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let schema = pxr.UsdGeomSphere(p)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.ClearTypeName())
@@ -58,7 +58,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         let p = main.DefinePrim("/foo", "Sphere")
         let schema = pxr.UsdGeomSphere(main.DefinePrim("/foo/bar", "Sphere"))
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo/bar")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], p.SetActive(false))
@@ -85,7 +85,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         
         let schema = pxr.UsdGeomCube(main.DefinePrim("/foo/bar", "Cube"))
 
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo/bar")], Bool(schema))
         XCTAssertTrue(value)
                 
         expectingSomeNotifications([token], foo.ClearActive())
@@ -99,7 +99,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Cube")
         let schema = pxr.UsdPhysicsRigidBodyAPI(foo)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(foo)], Bool(schema))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -114,7 +114,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         foo.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
         let schema = pxr.UsdPhysicsRigidBodyAPI(foo)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(foo)], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.RemoveAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -128,7 +128,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Cube")
         let schema = pxr.UsdPhysicsRigidBodyAPI(foo)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(foo)], Bool(schema))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -143,7 +143,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         foo.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
         let schema = pxr.UsdPhysicsRigidBodyAPI(foo)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(foo)], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.RemoveAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI))
@@ -162,7 +162,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         foo.SetPayload(pathForStage(named: "Payload.usda"), "/root")
         let schema = pxr.UsdGeomSphere(foo)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(foo)], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], foo.ClearPayload())
@@ -180,7 +180,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         let foo = main.DefinePrim("/foo", "")
         let schema = pxr.UsdGeomSphere(foo)
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.of(foo)], Bool(schema))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], foo.SetPayload(pathForStage(named: "Payload.usda"), "/root"))
@@ -202,7 +202,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
                                            Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], scopePrim.Load(Overlay.UsdLoadWithDescendants))
@@ -224,7 +224,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
                                            Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], scopePrim.Unload())
@@ -242,7 +242,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         scopePrim.GetReferences().AddInternalReference("/instanceTarget", pxr.SdfLayerOffset(0, 1), Overlay.UsdListPositionBackOfPrependList)
         let schema = pxr.UsdGeomSphere(mainStage.DefinePrim("/smallModel/belowInstanceable", "Sphere"))
 
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/belowInstanceable")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], scopePrim.SetInstanceable(true))
@@ -260,7 +260,7 @@ final class Observation_MutateUsdPrim_ReadUsdSchemaBase: ObservationHelper {
         mainStage.DefinePrim("/smallModel/belowInstanceable", "Sphere")
         scopePrim.SetInstanceable(true)
 
-        let (token, value) = registerNotification(Bool(pxr.UsdGeomSphere(mainStage.GetPrimAtPath("/smallModel/belowInstanceable"))))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/belowInstanceable")], Bool(pxr.UsdGeomSphere(mainStage.GetPrimAtPath("/smallModel/belowInstanceable"))))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], scopePrim.ClearInstanceable())
@@ -28,7 +28,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [p])
         
         expectingSomeNotifications([token], p.SetSpecifier(Overlay.SdfSpecifierOver))
@@ -41,7 +41,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -78,7 +78,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -115,7 +115,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [p])
         
         expectingSomeNotifications([token], p.SetActive(false))
@@ -129,7 +129,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         p.SetActive(false)
 
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], p.ClearActive())
@@ -145,7 +145,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         p.CreateRelationship("beta", true)
         
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -190,7 +190,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         p.CreateRelationship("beta", true)
         p.SetPropertyOrder(["beta", "alpha"])
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -233,7 +233,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         var p = main.DefinePrim("/foo", "Cube")
         p.CreateRelationship("alpha", true)
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -271,7 +271,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -310,7 +310,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -350,7 +350,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         p.AddAppliedSchema(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -391,7 +391,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = main.DefinePrim("/foo", "Cube")
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -431,7 +431,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let p = main.DefinePrim("/foo", "Cube")
         p.ApplyAPI(.UsdPhysicsTokens.PhysicsRigidBodyAPI)
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -476,7 +476,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let delta = main.DefinePrim("/foo/delta", "Sphere")
         
         
-        let (token, value) = registerNotification(Array(main.Traverse()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.Traverse()))
         XCTAssertEqual(value, [foo, bar, delta])
         
         expectingSomeNotifications([token], foo.SetChildrenReorder(["delta", "bar"]))
@@ -493,7 +493,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let delta = main.DefinePrim("/foo/delta", "Sphere")
         foo.SetChildrenReorder(["delta", "bar"])
         
-        let (token, value) = registerNotification(Array(main.TraverseAll()))
+        let (token, value) = registerNotification(reading: [.of(main)], Array(main.TraverseAll()))
         XCTAssertEqual(value, [foo, delta, bar])
         
         expectingSomeNotifications([token], foo.ClearChildrenReorder())
@@ -506,7 +506,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -544,7 +544,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Sphere")
 
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -588,7 +588,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         foo.SetPayload(pathForStage(named: "Payload.usda"), "/root")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -633,7 +633,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let foo = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -683,7 +683,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.Traverse())
+        let (token, value) = registerNotification(reading: [.of(mainStage)], mainStage.Traverse())
         // After AddPayload, the prim is loadable, so with LoadNone it isn't loaded and doesn't get caught by Traverse()
         XCTAssertEqual(Array(value), [])
         
@@ -704,7 +704,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.Traverse())
+        let (token, value) = registerNotification(reading: [.of(mainStage)], mainStage.Traverse())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/smallModel"), mainStage.GetPrimAtPath("/smallModel/bigModel")])
         
         expectingSomeNotifications([token], scopePrim.Unload())
@@ -717,7 +717,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let mainStage = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let scopePrim = mainStage.DefinePrim("/smallModel", "Scope")
 
-        let (token, value) = registerNotification(mainStage.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(mainStage)], mainStage.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -757,7 +757,7 @@ final class Observation_MutateUsdPrim_ReadUsdStage: ObservationHelper {
         let scopePrim = mainStage.DefinePrim("/smallModel", "Scope")
         scopePrim.SetInstanceable(true)
 
-        let (token, value) = registerNotification(mainStage.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(mainStage)], mainStage.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
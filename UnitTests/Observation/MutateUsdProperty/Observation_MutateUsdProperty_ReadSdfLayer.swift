@@ -30,7 +30,7 @@ final class Observation_MutateUsdProperty_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "displayGroup", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "displayGroup", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetDisplayGroup("buzz"))
@@ -45,7 +45,7 @@ final class Observation_MutateUsdProperty_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetDisplayGroup("buzz")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "displayGroup", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "displayGroup", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearDisplayGroup())
@@ -59,7 +59,7 @@ final class Observation_MutateUsdProperty_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.radius", "displayGroup", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.radius", "displayGroup", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetNestedDisplayGroups(["buzz", "bar"]))
@@ -73,7 +73,7 @@ final class Observation_MutateUsdProperty_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(layer.GetField("/foo.myAttr", "custom"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo.myAttr", "custom"))
         XCTAssertEqual(value, pxr.VtValue(false))
         
         expectingSomeNotifications([token], attr.SetCustom(true))
@@ -88,7 +88,7 @@ final class Observation_MutateUsdProperty_ReadSdfLayer: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         let otherPrim = main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasSpec("/bar.myAttr"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/bar.myAttr"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.FlattenTo(otherPrim))
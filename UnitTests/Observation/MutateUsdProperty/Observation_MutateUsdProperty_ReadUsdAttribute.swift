@@ -32,7 +32,7 @@ final class Observation_MutateUsdProperty_ReadUsdAttribute: ObservationHelper {
         let otherPrim = main.DefinePrim("/bar", "Sphere")
         let attrDest = otherPrim.CreateAttribute("myAttr", .Float, false, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(attrDest.GetTypeName())
+        let (token, value) = registerNotification(reading: [.of(attrDest)], attrDest.GetTypeName())
         XCTAssertEqual(value, .Float)
         
         expectingSomeNotifications([token], attr.FlattenTo(otherPrim))
@@ -46,7 +46,7 @@ final class Observation_MutateUsdProperty_ReadUsdAttribute: ObservationHelper {
         let otherPrim = main.DefinePrim("/bar", "Sphere")
         let attrDest = otherPrim.CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(attrDest.GetColorSpace())
+        let (token, value) = registerNotification(reading: [.of(attrDest)], attrDest.GetColorSpace())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], attr.FlattenTo(otherPrim))
@@ -30,7 +30,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(attr.GetMetadata("displayGroup", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetMetadata("displayGroup", &vtValue))
         XCTAssertFalse(value)
         XCTAssertTrue(vtValue.IsEmpty())
         
@@ -43,7 +43,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.HasMetadata("displayGroup"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasMetadata("displayGroup"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetDisplayGroup("buzz"))
@@ -54,7 +54,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.HasAuthoredMetadata("displayGroup"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredMetadata("displayGroup"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetDisplayGroup("buzz"))
@@ -69,7 +69,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         attr.SetDisplayGroup("buzz")
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(attr.GetMetadata("displayGroup", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetMetadata("displayGroup", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue("buzz" as std.string))
         
@@ -82,7 +82,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetDisplayGroup("buzz")
         
-        let (token, value) = registerNotification(attr.HasMetadata("displayGroup"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasMetadata("displayGroup"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearDisplayGroup())
@@ -94,7 +94,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetDisplayGroup("buzz")
         
-        let (token, value) = registerNotification(attr.HasAuthoredMetadata("displayGroup"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredMetadata("displayGroup"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearDisplayGroup())
@@ -108,7 +108,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(attr.GetMetadata("displayGroup", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetMetadata("displayGroup", &vtValue))
         XCTAssertFalse(value)
         XCTAssertTrue(vtValue.IsEmpty())
         
@@ -121,7 +121,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.HasMetadata("displayGroup"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasMetadata("displayGroup"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetNestedDisplayGroups(["buzz", "bar"]))
@@ -132,7 +132,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.HasAuthoredMetadata("displayGroup"))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredMetadata("displayGroup"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetNestedDisplayGroups(["buzz", "bar"]))
@@ -146,7 +146,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(attr.GetMetadata("custom", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetMetadata("custom", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue(false))
         
@@ -163,7 +163,7 @@ final class Observation_MutateUsdProperty_ReadUsdObject: ObservationHelper {
         let otherPrim = main.DefinePrim("/bar", "Sphere")
         let attrDest = otherPrim.GetAttribute("myAttr")
         
-        let (token, value) = registerNotification(Bool(attrDest))
+        let (token, value) = registerNotification(reading: [.of(attrDest)], Bool(attrDest))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.FlattenTo(otherPrim))
@@ -30,7 +30,7 @@ final class Observation_MutateUsdProperty_ReadUsdPrim: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         let otherPrim = main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(otherPrim.HasProperty("myAttr"))
+        let (token, value) = registerNotification(reading: [.of(otherPrim)], otherPrim.HasProperty("myAttr"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.FlattenTo(otherPrim))
@@ -29,7 +29,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetDisplayGroup())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], attr.SetDisplayGroup("buzz"))
@@ -40,7 +40,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetDisplayGroup("buzz"))
@@ -51,7 +51,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.GetNestedDisplayGroups())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetNestedDisplayGroups())
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], attr.SetDisplayGroup("buzz:foo"))
@@ -65,7 +65,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetDisplayGroup("buzz")
         
-        let (token, value) = registerNotification(attr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetDisplayGroup())
         XCTAssertEqual(value, "buzz")
         
         expectingSomeNotifications([token], attr.ClearDisplayGroup())
@@ -77,7 +77,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetDisplayGroup("buzz")
         
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], attr.ClearDisplayGroup())
@@ -89,7 +89,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetDisplayGroup("buzz:foo")
         
-        let (token, value) = registerNotification(attr.GetNestedDisplayGroups())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetNestedDisplayGroups())
         XCTAssertEqual(value, ["buzz", "foo"])
         
         expectingSomeNotifications([token], attr.ClearDisplayGroup())
@@ -102,7 +102,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetDisplayGroup())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], attr.SetNestedDisplayGroups(["buzz", "bar"]))
@@ -113,7 +113,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetNestedDisplayGroups(["buzz", "bar"]))
@@ -124,7 +124,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(attr.GetNestedDisplayGroups())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetNestedDisplayGroups())
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], attr.SetNestedDisplayGroups(["buzz", "foo"]))
@@ -137,7 +137,7 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(attr.IsCustom())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.IsCustom())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], attr.SetCustom(true))
@@ -153,10 +153,26 @@ final class Observation_MutateUsdProperty_ReadUsdProperty: ObservationHelper {
         let otherPrim = main.DefinePrim("/bar", "Sphere")
         let attrDest = otherPrim.CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(attrDest.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attrDest)], attrDest.GetDisplayGroup())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], attr.FlattenTo(otherPrim))
         XCTAssertEqual(attrDest.GetDisplayGroup(), "fizz")
     }
+    
+    // MARK: Unrelated reads
+    
+    func test_SetDisplayGroup_unrelatedPropertiesStaySilent() {
+        let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
+        let fooRadius = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
+        let barRadius = main.DefinePrim("/bar", "Sphere").GetAttribute("radius")
+        fooRadius.Set(1.0, .Default())
+        barRadius.Set(1.0, .Default())
+        
+        let (fooRadiusToken, _) = registerNotification(reading: [.of(fooRadius)], fooRadius.GetDisplayGroup())
+        let (barRadiusToken, _) = registerNotification(reading: [.of(barRadius)], barRadius.GetDisplayGroup())
+        
+        expectingOnlyNotifications([fooRadiusToken], fooRadius.SetDisplayGroup("buzz"))
+        withExtendedLifetime(barRadiusToken) {}
+    }
 }
@@ -33,7 +33,7 @@ final class Observation_MutateUsdProperty_ReadUsdRelationship: ObservationHelper
         let relDest = otherPrim.CreateRelationship("myRel", true)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(relDest.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: relDest)], relDest.GetForwardedTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -29,7 +29,7 @@ final class Observation_MutateUsdProperty_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -70,7 +70,7 @@ final class Observation_MutateUsdProperty_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         attr.SetDisplayGroup("buzz")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -111,7 +111,7 @@ final class Observation_MutateUsdProperty_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").GetAttribute("radius")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -151,7 +151,7 @@ final class Observation_MutateUsdProperty_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -191,7 +191,7 @@ final class Observation_MutateUsdProperty_ReadUsdStage: ObservationHelper {
         let attr = main.DefinePrim("/foo", "Sphere").CreateAttribute("myAttr", .Double, false, Overlay.SdfVariabilityVarying)
         let otherPrim = main.DefinePrim("/bar", "Sphere")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
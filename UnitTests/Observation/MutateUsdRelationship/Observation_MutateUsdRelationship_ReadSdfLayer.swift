@@ -30,7 +30,7 @@ final class Observation_MutateUsdRelationship_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.prototypes", "targetPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.prototypes", "targetPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], rel.AddTarget(".radius", Overlay.UsdListPositionBackOfPrependList))
@@ -45,7 +45,7 @@ final class Observation_MutateUsdRelationship_ReadSdfLayer: ObservationHelper {
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         rel.AddTarget(".radius", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(layer.GetField("/foo.prototypes", "targetPaths"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/foo.prototypes", "targetPaths"))
         XCTAssertEqual(value, pxr.VtValue(pxr.SdfPathListOp.Create(["/foo.radius"], [], [])))
         
         expectingSomeNotifications([token], rel.RemoveTarget(".radius"))
@@ -60,7 +60,7 @@ final class Observation_MutateUsdRelationship_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
-        let (token, value) = registerNotification(layer.HasField("/foo.prototypes", "targetPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.prototypes", "targetPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], rel.SetTargets([".radius"]))
@@ -75,7 +75,7 @@ final class Observation_MutateUsdRelationship_ReadSdfLayer: ObservationHelper {
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         rel.SetTargets([".radius"])
         
-        let (token, value) = registerNotification(layer.HasField("/foo.prototypes", "targetPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/foo.prototypes", "targetPaths", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], rel.ClearTargets(false))
@@ -29,7 +29,7 @@ final class Observation_MutateUsdRelationship_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
-        let (token, value) = registerNotification(Overlay.HasMetadata(rel, "targetPaths"))
+        let (token, value) = registerNotification(reading: [.of(rel)], Overlay.HasMetadata(rel, "targetPaths"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], rel.AddTarget(".radius", Overlay.UsdListPositionBackOfPrependList))
@@ -44,7 +44,7 @@ final class Observation_MutateUsdRelationship_ReadUsdObject: ObservationHelper {
         rel.AddTarget(".radius", Overlay.UsdListPositionBackOfPrependList)
         
         var vtValue = pxr.VtValue()
-        let (token, value) = registerNotification(Overlay.GetMetadata(rel, "targetPaths", &vtValue))
+        let (token, value) = registerNotification(reading: [.of(rel)], Overlay.GetMetadata(rel, "targetPaths", &vtValue))
         XCTAssertTrue(value)
         XCTAssertEqual(vtValue, pxr.VtValue(pxr.SdfPathListOp.Create(["/foo.radius"], [], [])))
         
@@ -59,7 +59,7 @@ final class Observation_MutateUsdRelationship_ReadUsdObject: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
-        let (token, value) = registerNotification(Overlay.HasAuthoredMetadata(rel, "targetPaths"))
+        let (token, value) = registerNotification(reading: [.of(rel)], Overlay.HasAuthoredMetadata(rel, "targetPaths"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], rel.SetTargets([".radius"]))
@@ -73,7 +73,7 @@ final class Observation_MutateUsdRelationship_ReadUsdObject: ObservationHelper {
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         rel.SetTargets([".radius"])
         
-        let (token, value) = registerNotification(Overlay.HasAuthoredMetadata(rel, "targetPaths"))
+        let (token, value) = registerNotification(reading: [.of(rel)], Overlay.HasAuthoredMetadata(rel, "targetPaths"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], rel.ClearTargets(false))
@@ -30,7 +30,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -44,7 +44,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -57,7 +57,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], rel.AddTarget(".radius", Overlay.UsdListPositionBackOfPrependList))
@@ -72,7 +72,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         rel.AddTarget(".radius", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.radius"])
         
@@ -87,7 +87,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         rel.AddTarget(".radius", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.radius"])
         
@@ -103,7 +103,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -117,7 +117,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
         
@@ -130,7 +130,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], rel.SetTargets([".radius"]))
@@ -145,7 +145,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         rel.SetTargets([".radius"])
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.radius"])
         
@@ -160,7 +160,7 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         rel.SetTargets([".radius"])
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rel)], rel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.radius"])
 
@@ -174,10 +174,26 @@ final class Observation_MutateUsdRelationship_ReadUsdRelationship: ObservationHe
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         rel.SetTargets([".radius"])
         
-        let (token, value) = registerNotification(rel.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.HasAuthoredTargets())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], rel.ClearTargets(false))
         XCTAssertFalse(rel.HasAuthoredTargets())
     }
+    
+    // MARK: Unrelated reads
+    
+    func test_AddTarget_unrelatedRelationshipsStaySilent() {
+        let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
+        let fooRel = main.DefinePrim("/foo", "Scope").CreateRelationship("myRel", true)
+        let barRel = main.DefinePrim("/bar", "Scope").CreateRelationship("myRel", true)
+        
+        var fooTargets = pxr.SdfPathVector()
+        var barTargets = pxr.SdfPathVector()
+        let (fooToken, _) = registerNotification(reading: [.of(fooRel)], fooRel.GetTargets(&fooTargets))
+        let (barToken, _) = registerNotification(reading: [.of(barRel)], barRel.GetTargets(&barTargets))
+        
+        expectingOnlyNotifications([fooToken], fooRel.AddTarget("/bar", Overlay.UsdListPositionBackOfPrependList))
+        withExtendedLifetime(barToken) {}
+    }
 }
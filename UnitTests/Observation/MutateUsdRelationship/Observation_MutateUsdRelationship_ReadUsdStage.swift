@@ -29,7 +29,7 @@ final class Observation_MutateUsdRelationship_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -68,7 +68,7 @@ final class Observation_MutateUsdRelationship_ReadUsdStage: ObservationHelper {
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         rel.AddTarget(".radius", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -107,7 +107,7 @@ final class Observation_MutateUsdRelationship_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -146,7 +146,7 @@ final class Observation_MutateUsdRelationship_ReadUsdStage: ObservationHelper {
         let rel = main.DefinePrim("/foo", "PointInstancer").GetRelationship("prototypes")
         rel.SetTargets([".radius"])
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -28,7 +28,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
     func test_Save_IsDirty() {
         let stage = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let rootLayer = Overlay.Dereference(stage.GetRootLayer())
-        let (token, value) = registerNotification(rootLayer.IsDirty())
+        let (token, value) = registerNotification(reading: [.of(rootLayer)], rootLayer.IsDirty())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], stage.DefinePrim("/hello", "Plane"))
@@ -41,7 +41,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
     func test_SaveSessionLayers_IsDirty() {
         let stage = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let sessionLayer = Overlay.Dereference(stage.GetSessionLayer())
-        let (token, value) = registerNotification(sessionLayer.IsDirty())
+        let (token, value) = registerNotification(reading: [.of(sessionLayer)], sessionLayer.IsDirty())
         XCTAssertFalse(value)
         
         Overlay.withUsdEditContext(stage, pxr.UsdEditTarget(Overlay.TfWeakPtr(sessionLayer), pxr.SdfLayerOffset(0, 1))) {
@@ -56,7 +56,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.IsDirty())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.IsDirty())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetMetadata("startTimeCode", 4.0))
@@ -70,7 +70,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         main.SetDefaultPrim(main.DefinePrim("/hi", "Cube"))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasDefaultPrim())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadata("defaultPrim"))
@@ -83,7 +83,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetFieldDictValueByKey("/", "expressionVariables", "VARIANT_CHOICE"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFieldDictValueByKey("/", "expressionVariables", "VARIANT_CHOICE"))
         XCTAssertTrue(value.IsEmpty())
         
         XCTAssertTrue(expectingSomeNotifications([token], main.SetMetadataByDictKey("expressionVariables", "VARIANT_CHOICE", "variantA" as std.string)))
@@ -100,7 +100,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         main.SetMetadataByDictKey("expressionVariables", "VARIANT_CHOICE", "variantA" as std.string)
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        var (token, value) = registerNotification(layer.GetFieldDictValueByKey("/", "expressionVariables", "VARIANT_CHOICE"))
+        var (token, value) = registerNotification(reading: [.of(layer)], layer.GetFieldDictValueByKey("/", "expressionVariables", "VARIANT_CHOICE"))
         XCTAssertTrue(value.IsHolding(T: std.string.self))
         XCTAssertEqual(value.Get() as std.string, "variantA")
         
@@ -116,7 +116,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasField("/", "startTimeCode", nil as UnsafeMutablePointer<pxr.VtValue>?))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasField("/", "startTimeCode", nil as UnsafeMutablePointer<pxr.VtValue>?))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetStartTimeCode(7))
@@ -127,7 +127,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetField("/", "startTimeCode"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetField("/", "startTimeCode"))
         XCTAssertTrue(value.IsEmpty())
         
         expectingSomeNotifications([token], main.SetStartTimeCode(7))
@@ -138,7 +138,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetStartTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], main.SetStartTimeCode(7))
@@ -151,7 +151,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetEndTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetEndTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], main.SetEndTimeCode(7))
@@ -164,7 +164,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
                 
-        let (token, value) = registerNotification(layer.GetTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetTimeCodesPerSecond())
         XCTAssertEqual(value, 24)
                 
         expectingSomeNotifications([token], main.SetTimeCodesPerSecond(7))
@@ -177,7 +177,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
                 
-        let (token, value) = registerNotification(layer.GetFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetFramesPerSecond())
         XCTAssertEqual(value, 24)
                 
         expectingSomeNotifications([token], main.SetFramesPerSecond(7))
@@ -192,7 +192,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         
         main.SetEndTimeCode(4)
         
-        let (token, value) = registerNotification(layer.GetEndTimeCode())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetEndTimeCode())
         XCTAssertEqual(value, 4)
         
         expectingSomeNotifications([token], main.Reload())
@@ -206,7 +206,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         
         main.SetColorConfiguration(pxr.SdfAssetPath("/foo/bar"))
-        let (token, value) = registerNotification(layer.GetColorConfiguration())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetColorConfiguration())
         XCTAssertEqual(value, pxr.SdfAssetPath("/foo/bar"))
         
         expectingSomeNotifications([token], main.SetColorConfiguration(pxr.SdfAssetPath("/bar/foo")))
@@ -220,7 +220,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let layer = Overlay.Dereference(main.GetRootLayer())
         
         main.SetColorManagementSystem("fizzbuzz")
-        let (token, value) = registerNotification(layer.GetColorManagementSystem())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetColorManagementSystem())
         XCTAssertEqual(value, "fizzbuzz")
         
         expectingSomeNotifications([token], main.SetColorManagementSystem("buzzfizz"))
@@ -236,7 +236,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let bar = main.DefinePrim("/bar", "Sphere")
         main.SetDefaultPrim(foo)
         
-        let (token, value) = registerNotification(layer.GetDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetDefaultPrim())
         XCTAssertEqual(value, "foo")
         
         expectingSomeNotifications([token], main.SetDefaultPrim(bar))
@@ -251,7 +251,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         main.SetDefaultPrim(foo)
         
-        let (token, value) = registerNotification(layer.HasDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasDefaultPrim())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearDefaultPrim())
@@ -264,7 +264,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.IsDirty())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.IsDirty())
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], main.OverridePrim("/foo"))
@@ -277,7 +277,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], main.DefinePrim("/foo", "Plane"))
@@ -288,7 +288,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetPrimAtPath("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetPrimAtPath("/foo"))
         XCTAssertFalse(Bool(value))
 
         expectingSomeNotifications([token], main.DefinePrim("/foo", "Plane"))
@@ -299,7 +299,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.IsDirty())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.IsDirty())
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], main.DefinePrim("/foo", "Plane"))
@@ -310,7 +310,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.IsEmpty())
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.IsEmpty())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], main.DefinePrim("/foo", "Plane"))
@@ -325,7 +325,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification {
+        let (token, value) = registerNotification(reading: [.of(layer)]) {
             var result = [pxr.SdfPath]()
             layer.Traverse("/", Overlay.SdfLayer.TraversalFunction({ path in result.append(path) }))
             return result
@@ -346,7 +346,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.GetSpecType("/_class_foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.GetSpecType("/_class_foo"))
         XCTAssertEqual(value, Overlay.SdfSpecTypeUnknown)
 
         expectingSomeNotifications([token], main.CreateClassPrim("/_class_foo"))
@@ -357,7 +357,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let layer = Overlay.Dereference(main.GetRootLayer())
         
-        let (token, value) = registerNotification(layer.HasSpec("/_class_foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/_class_foo"))
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], main.CreateClassPrim("/_class_foo"))
@@ -372,7 +372,7 @@ final class Observation_MutateUsdStage_ReadSdfLayer: ObservationHelper {
         
         main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(layer.HasSpec("/foo"))
+        let (token, value) = registerNotification(reading: [.of(layer)], layer.HasSpec("/foo"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.RemovePrim("/foo"))
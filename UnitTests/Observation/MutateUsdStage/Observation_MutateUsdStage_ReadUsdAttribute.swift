@@ -39,7 +39,7 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         }
         
         var radiusValue = 0.0
-        let (token, value) = registerNotification(radiusAttr.Get(&radiusValue, pxr.UsdTimeCode.Default()))
+        let (token, value) = registerNotification(reading: [.of(radiusAttr)], radiusAttr.Get(&radiusValue, pxr.UsdTimeCode.Default()))
         XCTAssertTrue(value)
         XCTAssertEqual(radiusValue, 3.1415)
         
@@ -65,7 +65,7 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         
         main.MuteLayer(pathForStage(named: "Model.usda"))
         var timeSamples = Overlay.Double_Vector()
-        let (token, value) = registerNotification(radiusAttr.GetTimeSamples(&timeSamples))
+        let (token, value) = registerNotification(reading: [.of(radiusAttr)], radiusAttr.GetTimeSamples(&timeSamples))
         XCTAssertTrue(value)
         #warning("assert commented out to avoid compiler crash")
         //XCTAssertEqual(Array(timeSamples), [])
@@ -92,7 +92,7 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
             radiusAttr.Set(3.1415 as Double, 2.718)
         }
         
-        let (token, value) = registerNotification(radiusAttr.HasAuthoredValue())
+        let (token, value) = registerNotification(reading: [.of(radiusAttr)], radiusAttr.HasAuthoredValue())
         XCTAssertTrue(value)
 
         
@@ -113,7 +113,7 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         sphereOver.CreateAttribute("radius", .Double, false, Overlay.SdfVariabilityVarying).Set(2.0, 5.0)
                         
         let attr = spherePrim.GetAttribute("radius")
-        let (token, value) = registerNotification(attr.HasAuthoredValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.SetMetadata("subLayers", pxr.VtValue([] as Overlay.String_Vector)))
@@ -133,7 +133,7 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         sphereOver.CreateAttribute("radius", .Double, false, Overlay.SdfVariabilityVarying).Set(2.0, 5.0)
                         
         let attr = spherePrim.GetAttribute("radius")
-        let (token, value) = registerNotification(attr.HasAuthoredValue())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredValue())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadata("subLayers"))
@@ -161,12 +161,12 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
         var radius = 0.0
-        let (token1, value1) = registerNotification(radiusAttr.Get(&radius, .Default()))
+        let (token1, value1) = registerNotification(reading: [.of(radiusAttr)], radiusAttr.Get(&radius, .Default()))
         XCTAssertTrue(value1)
         XCTAssertEqual(1, radius)
         
         var assetPath = pxr.SdfAssetPath()
-        let (token2, value2) = registerNotification(customAttr.Get(&assetPath, .Default()))
+        let (token2, value2) = registerNotification(reading: [.of(customAttr)], customAttr.Get(&assetPath, .Default()))
         XCTAssertTrue(value2)
         XCTAssertEqual(assetPath, pxr.SdfAssetPath(pxr.SdfAssetPathParams().Authored("`${EXPR_HAS_ATTR}`").Evaluated("noAttr")))
         
@@ -198,12 +198,12 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
         var radius = 0.0
-        let (token1, value1) = registerNotification(radiusAttr.Get(&radius, .Default()))
+        let (token1, value1) = registerNotification(reading: [.of(radiusAttr)], radiusAttr.Get(&radius, .Default()))
         XCTAssertTrue(value1)
         XCTAssertEqual(9, radius)
         
         var assetPath = pxr.SdfAssetPath()
-        let (token2, value2) = registerNotification(customAttr.Get(&assetPath, .Default()))
+        let (token2, value2) = registerNotification(reading: [.of(customAttr)], customAttr.Get(&assetPath, .Default()))
         XCTAssertTrue(value2)
         XCTAssertEqual(assetPath, pxr.SdfAssetPath(pxr.SdfAssetPathParams().Authored("`${EXPR_HAS_ATTR}`").Evaluated("hasAttr")))
         
@@ -224,7 +224,7 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         attr.Set(10.0, 10.0)
         
         var radius = 0.0
-        let (token, value) = registerNotification(attr.Get(&radius, 4))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.Get(&radius, 4))
         XCTAssertTrue(value)
         XCTAssertEqual(radius, 4)
                 
@@ -243,7 +243,7 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         main.Save()
         attr.SetVariability(Overlay.SdfVariabilityUniform)
         
-        let (token, value) = registerNotification(attr.GetVariability())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetVariability())
         XCTAssertEqual(value, Overlay.SdfVariabilityUniform)
         
         expectingSomeNotifications([token], main.Reload())
@@ -260,7 +260,7 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         inherits.AddInherit("/_class_bar", Overlay.UsdListPositionBackOfPrependList)
         
         var radius = 0.0
-        let (token, value) = registerNotification(defPrim.GetAttribute("radius").Get(&radius, 4.0))
+        let (token, value) = registerNotification(reading: [.of(defPrim)], defPrim.GetAttribute("radius").Get(&radius, 4.0))
         XCTAssertTrue(value)
         XCTAssertEqual(radius, 1)
         
@@ -288,7 +288,7 @@ final class Observation_MutateUsdStage_ReadUsdAttribute: ObservationHelper {
         
         
         var samples = Overlay.Double_Vector()
-        let (token, value) = registerNotification(attr.GetTimeSamples(&samples))
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetTimeSamples(&samples))
         XCTAssertTrue(value)
         //XCTAssertEqual(Array(samples), [7, 9])
         
@@ -36,7 +36,7 @@ final class Observation_MutateUsdStage_ReadUsdEditTarget: ObservationHelper {
         
         let editTarget = main.GetEditTarget()
 
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.Reload())
@@ -55,7 +55,7 @@ final class Observation_MutateUsdStage_ReadUsdEditTarget: ObservationHelper {
         
         let editTarget = main.GetEditTarget()
 
-        let (token, value) = registerNotification(Bool(editTarget.GetLayer()))
+        let (token, value) = registerNotification(reading: [.of(main)], Bool(editTarget.GetLayer()))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.Reload())
@@ -66,10 +66,12 @@ final class Observation_MutateUsdStage_ReadUsdEditTarget: ObservationHelper {
     // MARK: dtor
     
     func test_dtor_IsValid() {
+        expectingUnobservableMutation("USD doesn't send a notice when a stage or layer is destroyed")
+        
         var main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let editTarget = main.GetEditTarget()
         
-        let (token, value) = registerNotification(editTarget.IsValid())
+        let (token, value) = registerNotification(reading: [.of(main)], editTarget.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token]) { main = Overlay.Dereference(pxr.UsdStage.CreateInMemory(Overlay.UsdStage.LoadAll)) }
@@ -77,10 +79,12 @@ final class Observation_MutateUsdStage_ReadUsdEditTarget: ObservationHelper {
     }
 
     func test_dtor_GetLayer() {
+        expectingUnobservableMutation("USD doesn't send a notice when a stage or layer is destroyed")
+        
         var main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let editTarget = main.GetEditTarget()
         
-        let (token, value) = registerNotification(Bool(editTarget.GetLayer()))
+        let (token, value) = registerNotification(reading: [.of(main)], Bool(editTarget.GetLayer()))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token]) { main = Overlay.Dereference(pxr.UsdStage.CreateInMemory(Overlay.UsdStage.LoadAll)) }
@@ -36,7 +36,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], mainStage.Load("/smallModel", Overlay.UsdLoadWithDescendants))
@@ -57,7 +57,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], mainStage.Unload("/smallModel"))
@@ -77,7 +77,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], mainStage.LoadAndUnload([], ["/smallModel"], Overlay.UsdLoadWithDescendants))
@@ -97,7 +97,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], mainStage.SetLoadRules(pxr.UsdStageLoadRules.LoadAll()))
@@ -117,7 +117,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(mainStage.GetPrimAtPath("/smallModel/bigModel")))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], mainStage.SetPopulationMask(pxr.UsdStagePopulationMask()))
@@ -138,7 +138,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
             spherePrim.SetCustomDataByKey("myCustomKey", pxr.VtValue("myCustomValue" as pxr.TfToken))
         }
         
-        let (token, value) = registerNotification(spherePrim.HasCustomData())
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasCustomData())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.MuteLayer(pathForStage(named: "Model.usda")))
@@ -161,7 +161,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         
         main.MuteLayer(pathForStage(named: "Model.usda"))
         
-        let (token, value) = registerNotification(spherePrim.IsHidden())
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.IsHidden())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.UnmuteLayer(pathForStage(named: "Model.usda")))
@@ -182,7 +182,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
             spherePrim.SetActive(true)
         }
         
-        let (token, value) = registerNotification(spherePrim.HasAuthoredMetadata("active"))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasAuthoredMetadata("active"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.MuteAndUnmuteLayers([pathForStage(named: "Model.usda")], []))
@@ -201,7 +201,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         let sphereOver = model.OverridePrim("/hi")
         sphereOver.SetActive(false)
                         
-        let (token, value) = registerNotification(spherePrim.HasMetadata("active"))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasMetadata("active"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.SetMetadata("subLayers", pxr.VtValue([] as Overlay.String_Vector)))
@@ -220,7 +220,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         let sphereOver = model.OverridePrim("/hi")
         sphereOver.SetActive(false)
                         
-        let (token, value) = registerNotification(spherePrim.HasMetadata("active"))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasMetadata("active"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadata("subLayers"))
@@ -246,7 +246,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         
         
         var isActive = pxr.VtValue()
-        let (token, value) = registerNotification(spherePrim.GetMetadata("active", &isActive))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.GetMetadata("active", &isActive))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetMetadataByDictKey("expressionVariables", "EXPR_HAS_ATTR", pxr.VtValue("hasAttr" as std.string)))
@@ -273,7 +273,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         
         
         var isActive = pxr.VtValue()
-        let (token, value) = registerNotification(spherePrim.GetMetadata("active", &isActive))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.GetMetadata("active", &isActive))
         XCTAssertTrue(value)
         XCTAssertFalse(isActive.Get())
         
@@ -288,7 +288,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("startTimeCode"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("startTimeCode"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetStartTimeCode(7))
@@ -302,7 +302,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("endTimeCode"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("endTimeCode"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetEndTimeCode(7))
@@ -316,7 +316,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("timeCodesPerSecond"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("timeCodesPerSecond"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetTimeCodesPerSecond(7))
@@ -330,7 +330,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("framesPerSecond"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("framesPerSecond"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetFramesPerSecond(7))
@@ -348,7 +348,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         
         spherePrim.SetDisplayName("Bar")
         
-        let (token, value) = registerNotification(spherePrim.GetDisplayName())
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.GetDisplayName())
         XCTAssertEqual(value, "Bar")
         
         expectingSomeNotifications([token], main.Reload())
@@ -362,7 +362,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("colorConfiguration"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("colorConfiguration"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetColorConfiguration(pxr.SdfAssetPath("foo")))
@@ -376,7 +376,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         let p = main.GetPseudoRoot()
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("colorManagementSystem"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("colorManagementSystem"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetColorManagementSystem("foo"))
@@ -391,7 +391,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Cube")
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("defaultPrim"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("defaultPrim"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetDefaultPrim(foo))
@@ -407,7 +407,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         main.SetDefaultPrim(foo)
         
         
-        let (token, value) = registerNotification(p.HasAuthoredMetadata("defaultPrim"))
+        let (token, value) = registerNotification(reading: [.of(p)], p.HasAuthoredMetadata("defaultPrim"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearDefaultPrim())
@@ -421,7 +421,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         
         let foo = main.GetPrimAtPath("/foo")
         
-        let (token, value) = registerNotification(foo.IsValid())
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], foo.IsValid())
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], main.OverridePrim("/foo"))
@@ -435,7 +435,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         
         let foo = main.DefinePrim("/foo", "Plane")
         
-        let (token, value) = registerNotification(foo.GetObjectAtPath("bar").IsValid())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetObjectAtPath("bar").IsValid())
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], main.DefinePrim("/foo/bar", "Sphere"))
@@ -451,7 +451,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         var inherits = defPrim.GetInherits()
         inherits.AddInherit("/_class_bar", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(defPrim.GetObjectAtPath(".myAttr"))
+        let (token, value) = registerNotification(reading: [.of(defPrim)], defPrim.GetObjectAtPath(".myAttr"))
         XCTAssertFalse(value.IsValid())
         
         expectingSomeNotifications([token]) {
@@ -467,7 +467,7 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
         
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(p.IsValid())
+        let (token, value) = registerNotification(reading: [.of(p)], p.IsValid())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.RemovePrim("/foo"))
@@ -477,11 +477,13 @@ final class Observation_MutateUsdStage_ReadUsdObject: ObservationHelper {
     // MARK: dtor
     
     func test_dtor_IsValid() {
+        expectingUnobservableMutation("USD doesn't send a notice when a stage or layer is destroyed")
+        
         var main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
         let p = main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(Bool(p))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(p))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token]) { main = Overlay.Dereference(pxr.UsdStage.CreateInMemory(Overlay.UsdStage.LoadAll)) }
@@ -38,7 +38,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rootPrim.GetAllDescendants())
+        let (token, value) = registerNotification(reading: [.of(rootPrim)], rootPrim.GetAllDescendants())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/root/smallModel")])
         
         expectingSomeNotifications([token], mainStage.Load("/root/smallModel", Overlay.UsdLoadWithDescendants))
@@ -60,7 +60,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rootPrim.GetAllDescendants())
+        let (token, value) = registerNotification(reading: [.of(rootPrim)], rootPrim.GetAllDescendants())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/root/smallModel"), mainStage.GetPrimAtPath("/root/smallModel/bigModel")])
         
         expectingSomeNotifications([token], mainStage.Unload("/root/smallModel"))
@@ -82,7 +82,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rootPrim.GetAllDescendants())
+        let (token, value) = registerNotification(reading: [.of(rootPrim)], rootPrim.GetAllDescendants())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/root/smallModel"), mainStage.GetPrimAtPath("/root/smallModel/bigModel")])
         
         expectingSomeNotifications([token], mainStage.LoadAndUnload([], ["/root/smallModel"], Overlay.UsdLoadWithDescendants))
@@ -104,7 +104,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rootPrim.GetAllDescendants())
+        let (token, value) = registerNotification(reading: [.of(rootPrim)], rootPrim.GetAllDescendants())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/root/smallModel")])
         
         expectingSomeNotifications([token], mainStage.SetLoadRules(pxr.UsdStageLoadRules.LoadAll()))
@@ -126,7 +126,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(rootPrim.GetAllDescendants())
+        let (token, value) = registerNotification(reading: [.of(rootPrim)], rootPrim.GetAllDescendants())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/root/smallModel"), mainStage.GetPrimAtPath("/root/smallModel/bigModel")])
         
         expectingSomeNotifications([token], mainStage.SetPopulationMask(pxr.UsdStagePopulationMask()))
@@ -147,7 +147,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
             spherePrim.SetActive(false)
         }
         
-        let (token, value) = registerNotification(spherePrim.IsActive())
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.IsActive())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.MuteLayer(pathForStage(named: "Model.usda")))
@@ -166,7 +166,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
             spherePrim.CreateRelationship("myRel", true)
         }
         
-        let (token, value) = registerNotification(spherePrim.HasProperty("myRel"))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasProperty("myRel"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.MuteLayer(pathForStage(named: "Model.usda")))
@@ -189,7 +189,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         
         main.MuteLayer(pathForStage(named: "Model.usda"))
         
-        let (token, value) = registerNotification(spherePrim.HasAuthoredActive())
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasAuthoredActive())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.UnmuteLayer(pathForStage(named: "Model.usda")))
@@ -210,7 +210,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
             spherePrim.CreateAttribute("customAttr", .Bool, true, Overlay.SdfVariabilityVarying)
         }
         
-        let (token, value) = registerNotification(spherePrim.GetAuthoredPropertyNames(Overlay.DefaultPropertyPredicateFunc))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.GetAuthoredPropertyNames(Overlay.DefaultPropertyPredicateFunc))
         XCTAssertEqual(value, ["customAttr"])
         
         expectingSomeNotifications([token], main.MuteAndUnmuteLayers([pathForStage(named: "Model.usda")], []))
@@ -229,7 +229,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         let sphereOver = model.OverridePrim("/hi")
         sphereOver.CreateAttribute("myAttr", .Color3f, true, Overlay.SdfVariabilityVarying)
                         
-        let (token, value) = registerNotification(spherePrim.HasAttribute("myAttr"))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasAttribute("myAttr"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.SetMetadata("subLayers", pxr.VtValue([] as Overlay.String_Vector)))
@@ -249,7 +249,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         let sphereOver = model.OverridePrim("/hi")
         sphereOver.CreateAttribute("myAttr", .Color3f, true, Overlay.SdfVariabilityVarying)
                         
-        let (token, value) = registerNotification(spherePrim.HasAttribute("myAttr"))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasAttribute("myAttr"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadata("subLayers"))
@@ -275,7 +275,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
         
-        let (token, value) = registerNotification(spherePrim.HasAttribute("myAttr"))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasAttribute("myAttr"))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetMetadataByDictKey("expressionVariables", "EXPR_HAS_ATTR", pxr.VtValue("hasAttr" as std.string)))
@@ -300,7 +300,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
         
-        let (token, value) = registerNotification(spherePrim.HasAttribute("myAttr"))
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.HasAttribute("myAttr"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadataByDictKey("expressionVariables", "EXPR_HAS_ATTR"))
@@ -322,7 +322,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
             spherePrim.SetActive(false)
         }
         
-        let (token, value) = registerNotification(spherePrim.IsActive())
+        let (token, value) = registerNotification(reading: [.of(spherePrim)], spherePrim.IsActive())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.Reload())
@@ -336,7 +336,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         
         let foo = main.DefinePrim("/foo", "Plane")
         
-        let (token, value) = registerNotification(foo.GetAllChildren())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetAllChildren())
         XCTAssertEqual(Array(value), [])
 
         expectingSomeNotifications([token], main.OverridePrim("/foo/bar"))
@@ -350,7 +350,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         
         let foo = main.DefinePrim("/foo", "Plane")
         
-        let (token, value) = registerNotification(foo.GetChildren())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetChildren())
         XCTAssertEqual(Array(value), [])
 
         expectingSomeNotifications([token], main.DefinePrim("/foo/bar", "Sphere"))
@@ -362,7 +362,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         
         let foo = main.DefinePrim("/foo", "Plane")
         
-        let (token, value) = registerNotification(foo.GetPropertyAtPath("bar.radius").IsValid())
+        let (token, value) = registerNotification(reading: [.of(foo)], foo.GetPropertyAtPath("bar.radius").IsValid())
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], main.DefinePrim("/foo/bar", "Sphere"))
@@ -378,7 +378,7 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         var inherits = defPrim.GetInherits()
         inherits.AddInherit("/_class_bar", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(defPrim.GetTypeName())
+        let (token, value) = registerNotification(reading: [.of(defPrim)], defPrim.GetTypeName())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token]) {
@@ -396,10 +396,28 @@ final class Observation_MutateUsdStage_ReadUsdPrim: ObservationHelper {
         main.DefinePrim("/foo/bar", "Sphere")
         main.DefinePrim("/foo/baz", "Sphere")
         
-        let (token, value) = registerNotification(p.GetAllChildrenNames())
+        let (token, value) = registerNotification(reading: [.of(p)], p.GetAllChildrenNames())
         XCTAssertEqual(value, ["bar", "baz"])
         
         expectingSomeNotifications([token], main.RemovePrim("/foo/bar"))
         XCTAssertEqual(p.GetAllChildrenNames(), ["baz"])
     }
+    
+    // MARK: Unrelated reads
+    
+    func test_DefinePrim_unrelatedPrimsAndStagesStaySilent() {
+        let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
+        let other = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Other.usda"), Overlay.UsdStage.LoadAll))
+        let foo = main.DefinePrim("/foo", "Scope")
+        let bar = main.DefinePrim("/bar", "Scope")
+        let otherFoo = other.DefinePrim("/foo", "Scope")
+        
+        let (fooToken, _) = registerNotification(reading: [.of(foo)], Array(foo.GetChildren()))
+        let (barToken, _) = registerNotification(reading: [.of(bar)], Array(bar.GetChildren()))
+        let (otherFooToken, _) = registerNotification(reading: [.of(otherFoo)], Array(otherFoo.GetChildren()))
+        let (otherToken, _) = registerNotification(reading: [.of(other)], other.ExportToString())
+        
+        expectingOnlyNotifications([fooToken], main.DefinePrim("/foo/child", "Scope"))
+        withExtendedLifetime((barToken, otherFooToken, otherToken)) {}
+    }
 }
@@ -36,7 +36,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
+        let (token, value) = registerNotification(reading: [.object(mainStage, "/smallModel/bigModel.doubleSided")], mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], mainStage.Load("/smallModel", Overlay.UsdLoadWithDescendants))
@@ -57,7 +57,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
+        let (token, value) = registerNotification(reading: [.object(mainStage, "/smallModel/bigModel.doubleSided")], mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], mainStage.Unload("/smallModel"))
@@ -78,7 +78,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
+        let (token, value) = registerNotification(reading: [.object(mainStage, "/smallModel/bigModel.doubleSided")], mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], mainStage.LoadAndUnload([], ["/smallModel"], Overlay.UsdLoadWithDescendants))
@@ -99,7 +99,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
+        let (token, value) = registerNotification(reading: [.object(mainStage, "/smallModel/bigModel.doubleSided")], mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], mainStage.SetLoadRules(pxr.UsdStageLoadRules.LoadAll()))
@@ -120,7 +120,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
+        let (token, value) = registerNotification(reading: [.object(mainStage, "/smallModel/bigModel.doubleSided")], mainStage.GetPropertyAtPath("/smallModel/bigModel.doubleSided").IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], mainStage.SetPopulationMask(pxr.UsdStagePopulationMask()))
@@ -143,7 +143,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
             attr = spherePrim.CreateAttribute("myCustomAttr", .Float3, true, Overlay.SdfVariabilityVarying)
         }
         
-        let (token, value) = registerNotification(attr.IsDefined())
+        let (token, value) = registerNotification(reading: [.object(main, "/hi.myCustomAttr")], attr.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.MuteLayer(pathForStage(named: "Model.usda")))
@@ -167,7 +167,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         
         main.MuteLayer(pathForStage(named: "Model.usda"))
         
-        let (token, value) = registerNotification(radiusAttr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(radiusAttr)], radiusAttr.GetDisplayGroup())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], main.UnmuteLayer(pathForStage(named: "Model.usda")))
@@ -189,7 +189,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
             radiusAttr.SetDisplayGroup("myDisplayGroup")
         }
                 
-        let (token, value) = registerNotification(radiusAttr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(radiusAttr)], radiusAttr.HasAuthoredDisplayGroup())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.MuteAndUnmuteLayers([pathForStage(named: "Model.usda")], []))
@@ -209,7 +209,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         sphereOver.CreateAttribute("radius", .Double, false, Overlay.SdfVariabilityVarying).SetDisplayGroup("foo")
                         
         let attr = spherePrim.GetAttribute("radius")
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.SetMetadata("subLayers", pxr.VtValue([] as Overlay.String_Vector)))
@@ -229,7 +229,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         sphereOver.CreateAttribute("radius", .Double, false, Overlay.SdfVariabilityVarying).SetDisplayGroup("foo")
                         
         let attr = spherePrim.GetAttribute("radius")
-        let (token, value) = registerNotification(attr.HasAuthoredDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.HasAuthoredDisplayGroup())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadata("subLayers"))
@@ -255,7 +255,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         }
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
-        let (token, value) = registerNotification(radiusAttr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(radiusAttr)], radiusAttr.GetDisplayGroup())
         XCTAssertEqual(value, "")
         
         expectingSomeNotifications([token], main.SetMetadataByDictKey("expressionVariables", "EXPR_HAS_ATTR", pxr.VtValue("hasAttr" as std.string)))
@@ -280,7 +280,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         }
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
-        let (token, value) = registerNotification(radiusAttr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(radiusAttr)], radiusAttr.GetDisplayGroup())
         XCTAssertEqual(value, "myDisplayGroup")
         
         expectingSomeNotifications([token], main.ClearMetadataByDictKey("expressionVariables", "EXPR_HAS_ATTR"))
@@ -294,7 +294,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
                         
         _ = main.DefinePrim("/smallModel", "Plane")
         let prop = main.GetPropertyAtPath("/smallModel.doubleSided")
-        let (token, value) = registerNotification(prop.IsDefined())
+        let (token, value) = registerNotification(reading: [.object(main, "/smallModel.doubleSided")], prop.IsDefined())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.Reload())
@@ -316,7 +316,7 @@ final class Observation_MutateUsdStage_ReadUsdProperty: ObservationHelper {
         attr.SetDisplayGroup("hi")
         
         
-        let (token, value) = registerNotification(attr.GetDisplayGroup())
+        let (token, value) = registerNotification(reading: [.of(attr)], attr.GetDisplayGroup())
         XCTAssertEqual(value, "hi")
         
         expectingSomeNotifications([token], main.RemovePrim("/foo"))
@@ -42,7 +42,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         relationship.AddTarget("/smallModel/bigModel.otherRel", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(relationship.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: relationship)], relationship.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/smallModel/bigModel.otherRel"])
         
@@ -70,7 +70,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         relationship.AddTarget("/smallModel/bigModel.otherRel", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(relationship.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: relationship)], relationship.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/smallModel/bigModel.doubleSided"])
         
@@ -99,7 +99,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         relationship.AddTarget("/smallModel/bigModel.otherRel", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(relationship.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: relationship)], relationship.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/smallModel/bigModel.doubleSided"])
         
@@ -128,7 +128,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         relationship.AddTarget("/smallModel/bigModel.otherRel", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(relationship.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: relationship)], relationship.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/smallModel/bigModel.otherRel"])
         
@@ -156,7 +156,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         relationship.AddTarget("/smallModel/bigModel.otherRel", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(relationship.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: relationship)], relationship.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/smallModel/bigModel.doubleSided"])
         
@@ -188,7 +188,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rootRelationship.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: rootRelationship)], rootRelationship.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/bigModel.foobar", "/bigModel.doubleSided"])
 
@@ -217,7 +217,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         
         main.MuteLayer(pathForStage(named: "Model.usda"))
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(bigRelationship.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(bigRelationship)], bigRelationship.GetTargets(&targets))
         XCTAssertFalse(value)
         XCTAssertEqual(targets, [])
 
@@ -244,7 +244,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         }
         
         
-        let (token, value) = registerNotification(bigRelationship.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(bigRelationship)], bigRelationship.HasAuthoredTargets())
         XCTAssertTrue(value)
 
         
@@ -268,7 +268,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         }
         
         
-        let (token, value) = registerNotification(bigRelationship.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(bigRelationship)], bigRelationship.HasAuthoredTargets())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], main.SetMetadata("subLayers", pxr.VtValue([] as Overlay.String_Vector)))
@@ -291,7 +291,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         }
         
         
-        let (token, value) = registerNotification(bigRelationship.HasAuthoredTargets())
+        let (token, value) = registerNotification(reading: [.of(bigRelationship)], bigRelationship.HasAuthoredTargets())
         XCTAssertTrue(value)
 
         expectingSomeNotifications([token], main.ClearMetadata("subLayers"))
@@ -319,7 +319,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/hi.foo"])
         
@@ -350,7 +350,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/hi.foo", "/hi.bar"])
         
@@ -372,7 +372,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         rel.AddTarget(".bar", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/hi.foo", "/hi.bar"])
                 
@@ -394,7 +394,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
 
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(mainRel.GetForwardedTargets(&targets))
+        let (token, value) = registerNotification(reading: [.forwardedTargets(of: mainRel)], mainRel.GetForwardedTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/bigModel/child.prototypes"])
 
@@ -415,7 +415,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         defRel.AddTarget(".otherRel", Overlay.UsdListPositionBackOfPrependList)
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(defRel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(defRel)], defRel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.otherRel"])
 
@@ -444,7 +444,7 @@ final class Observation_MutateUsdStage_ReadUsdRelationship: ObservationHelper {
         
         
         var targets = pxr.SdfPathVector()
-        let (token, value) = registerNotification(rel.GetTargets(&targets))
+        let (token, value) = registerNotification(reading: [.of(rel)], rel.GetTargets(&targets))
         XCTAssertTrue(value)
         XCTAssertEqual(targets, ["/foo.bar", "/foo.baz"])
 
@@ -38,7 +38,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
                                            Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], mainStage.Load("/smallModel", Overlay.UsdLoadWithDescendants))
@@ -61,7 +61,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
                                            Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], mainStage.Unload("/smallModel"))
@@ -84,7 +84,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
                                            Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], mainStage.LoadAndUnload([], ["/smallModel"], Overlay.UsdLoadWithDescendants))
@@ -107,7 +107,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
                                            Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], mainStage.SetLoadRules(pxr.UsdStageLoadRules.LoadAll()))
@@ -130,7 +130,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
                                            Overlay.UsdListPositionBackOfPrependList)
         
         
-        let (token, value) = registerNotification(Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
+        let (token, value) = registerNotification(reading: [.prim(mainStage, "/smallModel/bigModel")], Bool(pxr.UsdGeomPlane.Get(mainStagePtr, "/smallModel/bigModel")))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], mainStage.SetPopulationMask(pxr.UsdStagePopulationMask()))
@@ -152,7 +152,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
             schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/hi")
         }
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.MuteLayer(pathForStage(named: "Model.usda")))
@@ -175,7 +175,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
         
         main.MuteLayer(pathForStage(named: "Model.usda"))
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi")], Bool(schema))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.UnmuteLayer(pathForStage(named: "Model.usda")))
@@ -196,7 +196,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
             schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/hi")
         }
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.MuteAndUnmuteLayers([pathForStage(named: "Model.usda")], []))
@@ -217,7 +217,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
             schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/hi")
         }
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.SetMetadata("subLayers", pxr.VtValue([] as Overlay.String_Vector)))
@@ -238,7 +238,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
             schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/hi")
         }
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadata("subLayers"))
@@ -264,7 +264,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
         }
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi/there")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.SetMetadataByDictKey("expressionVariables", "EXPR_HAS_ATTR", pxr.VtValue("hasAttr" as std.string)))
@@ -290,7 +290,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
         }
         vset.SetVariantSelection("`${EXPR_HAS_ATTR}`")
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi/there")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadataByDictKey("expressionVariables", "EXPR_HAS_ATTR"))
@@ -313,7 +313,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
             schema = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/hi")
         }
         
-        let (token, value) = registerNotification(Bool(schema))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi")], Bool(schema))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.Reload())
@@ -323,7 +323,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
     func test_DefinePrim_operatorBool() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
                 
-        let (token, value) = registerNotification(Bool(pxr.UsdGeomSphere(main.GetPrimAtPath("/foo"))))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(pxr.UsdGeomSphere(main.GetPrimAtPath("/foo"))))
         XCTAssertFalse(value)
 
         expectingSomeNotifications([token], main.DefinePrim("/foo", "Sphere"))
@@ -339,7 +339,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
         var inherits = defPrim.GetInherits()
         inherits.AddInherit("/_class_bar", Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(pxr.UsdPhysicsRigidBodyAPI(defPrim))
+        let (token, value) = registerNotification(reading: [.of(defPrim)], pxr.UsdPhysicsRigidBodyAPI(defPrim))
         XCTAssertFalse(Bool(value))
         
         expectingSomeNotifications([token]) {
@@ -363,7 +363,7 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
         let api = pxr.UsdPhysicsRigidBodyAPI(p)
         
                                 
-        let (token, value) = registerNotification(Bool(api))
+        let (token, value) = registerNotification(reading: [.of(p)], Bool(api))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.RemovePrim("/foo"))
@@ -373,10 +373,12 @@ final class Observation_MutateUsdStage_ReadUsdSchemaBase: ObservationHelper {
     // MARK: dtor
     
     func test_dtor_operatorBool() {
+        expectingUnobservableMutation("USD doesn't send a notice when a stage or layer is destroyed")
+        
         var main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         let p = pxr.UsdGeomSphere.Define(Overlay.TfWeakPtr(main), "/foo")
         
-        let (token, value) = registerNotification(Bool(p))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], Bool(p))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token]) { main = Overlay.Dereference(pxr.UsdStage.CreateInMemory(Overlay.UsdStage.LoadAll)) }
@@ -39,7 +39,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.Traverse())
+        let (token, value) = registerNotification(reading: [.of(mainStage)], mainStage.Traverse())
         // After AddPayload, the prim is loadable, so with LoadNone it isn't loaded and doesn't get caught by Traverse()
         XCTAssertEqual(Array(value), [])
         
@@ -60,7 +60,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.Traverse())
+        let (token, value) = registerNotification(reading: [.of(mainStage)], mainStage.Traverse())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/smallModel"), mainStage.GetPrimAtPath("/smallModel/bigModel")])
         
         expectingSomeNotifications([token], mainStage.Unload("/smallModel"))
@@ -80,7 +80,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         scopePrim.GetPayloads().AddPayload(pxr.SdfPayload(pathForStage(named: "Payload.usda"), "/scope", pxr.SdfLayerOffset(0, 1)),
                                            Overlay.UsdListPositionBackOfPrependList)
         
-        let (token, value) = registerNotification(mainStage.Traverse())
+        let (token, value) = registerNotification(reading: [.of(mainStage)], mainStage.Traverse())
         XCTAssertEqual(Array(value), [mainStage.GetPrimAtPath("/smallModel"), mainStage.GetPrimAtPath("/smallModel/bigModel")])
         
         expectingSomeNotifications([token], mainStage.LoadAndUnload([], ["/smallModel"], Overlay.UsdLoadWithDescendants))
@@ -94,7 +94,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     #else
     func test_SetLoadRules_GetLoadRules() {
         let stage = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
-        let (token, value) = registerNotification(stage.GetLoadRules())
+        let (token, value) = registerNotification(reading: [.of(stage)], stage.GetLoadRules())
         XCTAssertEqual(value, pxr.UsdStageLoadRules.LoadAll())
         
         expectingSomeNotifications([token], stage.SetLoadRules(pxr.UsdStageLoadRules.LoadNone()))
@@ -110,7 +110,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_SetPopulationMask_GetPopulationMask() {
         let stage = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(stage.GetPopulationMask())
+        let (token, value) = registerNotification(reading: [.of(stage)], stage.GetPopulationMask())
         XCTAssertEqual(value, pxr.UsdStagePopulationMask.All())
         
         expectingSomeNotifications([token], stage.SetPopulationMask(pxr.UsdStagePopulationMask()))
@@ -133,7 +133,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         
         Overlay.Dereference(higherMain.GetRootLayer()).InsertSubLayerPath(pathForStage(named: "Folder/Main.usda"), 0)
         
-        let (token, value) = registerNotification(higherMain.ResolveIdentifierToEditTarget("Model.usda"))
+        let (token, value) = registerNotification(reading: [.of(higherMain)], higherMain.ResolveIdentifierToEditTarget("Model.usda"))
         XCTAssertEqual(value, pathForStage(named: "Model.usda"))
         
         let lowerEditTarget = pxr.UsdEditTarget(lowerMain.GetRootLayer(), pxr.SdfLayerOffset(0, 1))
@@ -143,7 +143,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
 
     func test_SetEditTarget_GetEditTarget() {
         let stage = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
-        let token = registerNotification(stage.GetEditTarget()).token
+        let token = registerNotification(reading: [.stage(stage)], stage.GetEditTarget()).token
                 
         let rootPrim = stage.DefinePrim("/hello", "Plane")
         var vsets = rootPrim.GetVariantSets()
@@ -162,7 +162,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let model = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Model.usda"), Overlay.UsdStage.LoadAll))
         Overlay.Dereference(main.GetRootLayer()).InsertSubLayerPath(pathForStage(named: "Model.usda"), 0)
         
-        let (token, value) = registerNotification(main.GetMutedLayers())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMutedLayers())
         XCTAssertEqual(value, [])
         
         expectingSomeNotifications([token], main.MuteLayer(Overlay.Dereference(model.GetRootLayer()).GetIdentifier()))
@@ -176,7 +176,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         
         let modelPath = pathForStage(named: "Model.usda")
 
-        let (token, value) = registerNotification(main.IsLayerMuted(modelPath))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.IsLayerMuted(modelPath))
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.MuteLayer(modelPath))
@@ -195,7 +195,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         }
 
         let out1Path = pathForStage(named: "Out1.txt")
-        let (token, value) = registerNotification(main.Export(out1Path, true, pxr.SdfLayer.FileFormatArguments()))
+        let (token, value) = registerNotification(reading: [.of(main)], main.Export(out1Path, true, pxr.SdfLayer.FileFormatArguments()))
         XCTAssertTrue(value)
         XCTAssertEqual(try contentsOfStage(named: "Out1.txt"), #"""
         #usda 1.0
@@ -235,7 +235,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
             model.DefinePrim("/hi", "Sphere")
         }
 
-        let (token, value) = registerNotification(main.ExportToString(addSourceFileComment: true))
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString(addSourceFileComment: true))
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -272,7 +272,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
             model.DefinePrim("/hi", "Sphere")
         }
         
-        let (token, value) = registerNotification(main.Flatten(true))
+        let (token, value) = registerNotification(reading: [.of(main)], main.Flatten(true))
         var temp = std.string()
         XCTAssertTrue(Overlay.Dereference(value).ExportToString(&temp))
         XCTAssertEqual(temp, std.string(#"""
@@ -312,7 +312,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
             model.DefinePrim("/hi", "Sphere")
         }
         
-        let (token, value) = registerNotification(main.GetPrimAtPath("/hi"))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi")], main.GetPrimAtPath("/hi"))
         XCTAssertTrue(Bool(value))
         expectingSomeNotifications([token], main.MuteLayer(pathForStage(named: "Model.usda")))
         XCTAssertFalse(Bool(main.GetPrimAtPath("/hi")))
@@ -328,7 +328,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
             model.DefinePrim("/hi", "Sphere")
         }
         
-        let (token, value) = registerNotification(main.GetObjectAtPath("/hi"))
+        let (token, value) = registerNotification(reading: [.prim(main, "/hi")], main.GetObjectAtPath("/hi"))
         XCTAssertTrue(value.IsValid())
         expectingSomeNotifications([token], main.MuteLayer(pathForStage(named: "Model.usda")))
         XCTAssertFalse(main.GetObjectAtPath("/hi").IsValid())
@@ -348,7 +348,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
 
         main.MuteLayer(pathForStage(named: "Model.usda"))
         
-        let (token, value) = registerNotification(main.Traverse())
+        let (token, value) = registerNotification(reading: [.of(main)], main.Traverse())
         XCTAssertEqual(Array(value), [])
         
         expectingSomeNotifications([token], main.UnmuteLayer(pathForStage(named: "Model.usda")))
@@ -367,7 +367,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
             model.DefinePrim("/hi", "Sphere")
         }
         
-        let (token, value) = registerNotification(main.GetAttributeAtPath("/hi.radius"))
+        let (token, value) = registerNotification(reading: [.object(main, "/hi.radius")], main.GetAttributeAtPath("/hi.radius"))
         XCTAssertTrue(value.IsValid())
         expectingSomeNotifications([token], main.MuteAndUnmuteLayers([pathForStage(named: "Model.usda")], []))
         XCTAssertFalse(main.GetAttributeAtPath("/hi.radius").IsValid())
@@ -379,7 +379,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
         var startTimeCode = 7.0
-        let (token, value) = registerNotification(main.GetMetadata("startTimeCode", &startTimeCode))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMetadata("startTimeCode", &startTimeCode))
         XCTAssertTrue(value)
         XCTAssertEqual(startTimeCode, 0)
         
@@ -394,7 +394,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         main.SetStartTimeCode(5)
         
-        let (token, value) = registerNotification(main.HasAuthoredMetadata("startTimeCode"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredMetadata("startTimeCode"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadata("startTimeCode"))
@@ -407,7 +407,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
         var choice = std.string()
-        let (token, value) = registerNotification(main.GetMetadataByDictKey("expressionVariables", "VARIANT_CHOICE", &choice))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetMetadataByDictKey("expressionVariables", "VARIANT_CHOICE", &choice))
         XCTAssertFalse(value)
         
         XCTAssertTrue(expectingSomeNotifications([token], main.SetMetadataByDictKey("expressionVariables", "VARIANT_CHOICE", "variantA" as std.string)))
@@ -422,7 +422,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         main.SetMetadataByDictKey("expressionVariables", "VARIANT_CHOICE", "variantA" as std.string)
         
-        let (token, value) = registerNotification(main.HasMetadataDictKey("expressionVariables", "VARIANT_CHOICE"))
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasMetadataDictKey("expressionVariables", "VARIANT_CHOICE"))
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearMetadataByDictKey("expressionVariables", "VARIANT_CHOICE"))
@@ -434,7 +434,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_SetStartTimeCode_GetStartTimeCode() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetStartTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], main.SetStartTimeCode(7))
@@ -445,7 +445,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         main.SetEndTimeCode(17)
         
-        let (token, value) = registerNotification(main.HasAuthoredTimeCodeRange())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasAuthoredTimeCodeRange())
         XCTAssertFalse(value)
         
         expectingSomeNotifications([token], main.SetStartTimeCode(7))
@@ -457,7 +457,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_SetEndTimeCode_GetEndTimeCode() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.GetEndTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetEndTimeCode())
         XCTAssertEqual(value, 0)
         
         expectingSomeNotifications([token], main.SetEndTimeCode(7))
@@ -469,7 +469,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_SetTimeCodesPerSecond_GetTimeCodesPerSecond() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.GetTimeCodesPerSecond())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetTimeCodesPerSecond())
         XCTAssertEqual(value, 24)
         
         expectingSomeNotifications([token], main.SetTimeCodesPerSecond(7))
@@ -481,7 +481,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_SetFramesPerSecond_GetFramesPerSecond() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.GetFramesPerSecond())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetFramesPerSecond())
         XCTAssertEqual(value, 24)
         
         expectingSomeNotifications([token], main.SetFramesPerSecond(7))
@@ -493,7 +493,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_SetInterpolationType_GetInterpolationType() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.GetInterpolationType())
+        let (token, value) = registerNotification(reading: [.of(main)], main.GetInterpolationType())
         XCTAssertEqual(value, Overlay.UsdInterpolationTypeLinear)
         
         expectingSomeNotifications([token], main.SetInterpolationType(Overlay.UsdInterpolationTypeHeld))
@@ -506,7 +506,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         main.SetStartTimeCode(4)
         
-        let (token, value) = registerNotification(main.GetStartTimeCode())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetStartTimeCode())
         XCTAssertEqual(value, 4)
         
         expectingSomeNotifications([token], main.Reload())
@@ -516,13 +516,15 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     // MARK: SetColorConfigFallbacks
     
     func test_SetColorConfigFallbacks_GetColorConfigFallbacks() {
+        expectingUnobservableMutation("UsdStage.SetColorConfigFallbacks is global state, and USD doesn't send a notice when it changes")
+        
         // Note: These are static methods on UsdStage
         
         pxr.UsdStage.SetColorConfigFallbacks(pxr.SdfAssetPath("/foo/bar"), "fizzbuzz")
         
         var firstColorConfiguration = pxr.SdfAssetPath()
         var firstColorManagementSystem = pxr.TfToken()
-        let (token, value): (ObservationHelper.Token, Void) = registerNotification(pxr.UsdStage.GetColorConfigFallbacks(&firstColorConfiguration, &firstColorManagementSystem))
+        let (token, value): (ObservationHelper.Token, Void) = registerNotification(reading: [.anything], pxr.UsdStage.GetColorConfigFallbacks(&firstColorConfiguration, &firstColorManagementSystem))
         XCTAssertEqual(firstColorConfiguration, pxr.SdfAssetPath("/foo/bar"))
         XCTAssertEqual(firstColorManagementSystem, "fizzbuzz")
         
@@ -541,7 +543,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
         main.SetColorConfiguration(pxr.SdfAssetPath("/foo/bar"))
-        let (token, value) = registerNotification(main.GetColorConfiguration())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetColorConfiguration())
         XCTAssertEqual(value, pxr.SdfAssetPath("/foo/bar"))
         
         expectingSomeNotifications([token], main.SetColorConfiguration(pxr.SdfAssetPath("/bar/foo")))
@@ -554,7 +556,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
         main.SetColorManagementSystem("fizzbuzz")
-        let (token, value) = registerNotification(main.GetColorManagementSystem())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.GetColorManagementSystem())
         XCTAssertEqual(value, "fizzbuzz")
         
         expectingSomeNotifications([token], main.SetColorManagementSystem("buzzfizz"))
@@ -569,7 +571,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let bar = main.DefinePrim("/bar", "Sphere")
         main.SetDefaultPrim(foo)
         
-        let (token, value) = registerNotification(main.GetDefaultPrim())
+        let (token, value) = registerNotification(reading: [.of(main)], main.GetDefaultPrim())
         XCTAssertEqual(value, foo)
         
         expectingSomeNotifications([token], main.SetDefaultPrim(bar))
@@ -583,7 +585,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         let foo = main.DefinePrim("/foo", "Sphere")
         main.SetDefaultPrim(foo)
         
-        let (token, value) = registerNotification(main.HasDefaultPrim())
+        let (token, value) = registerNotification(reading: [.stage(main)], main.HasDefaultPrim())
         XCTAssertTrue(value)
         
         expectingSomeNotifications([token], main.ClearDefaultPrim())
@@ -595,7 +597,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_OverridePrim_ExportToString() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.ExportToString(addSourceFileComment: false))
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString(addSourceFileComment: false))
         XCTAssertEqual(value, #"""
         #usda 1.0
         
@@ -620,7 +622,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_DefinePrim_ExportToString() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -650,7 +652,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_DefinePrim_GetPrimAtPath() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.GetPrimAtPath("/foo"))
+        let (token, value) = registerNotification(reading: [.prim(main, "/foo")], main.GetPrimAtPath("/foo"))
         XCTAssertFalse(Bool(value))
         
         expectingSomeNotifications([token], main.DefinePrim("/foo", "Cube"))
@@ -660,7 +662,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_DefinePrim_GetObjectAtPath() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.GetObjectAtPath("/foo.size"))
+        let (token, value) = registerNotification(reading: [.object(main, "/foo.size")], main.GetObjectAtPath("/foo.size"))
         XCTAssertFalse(value.IsValid())
         
         expectingSomeNotifications([token], main.DefinePrim("/foo", "Cube"))
@@ -670,7 +672,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_DefinePrim_Traverse() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.Traverse())
+        let (token, value) = registerNotification(reading: [.of(main)], main.Traverse())
         XCTAssertEqual(Array(value), [])
         
         expectingSomeNotifications([token], main.DefinePrim("/foo", "Cube"))
@@ -680,7 +682,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_DefinePrim_TraverseAll() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.TraverseAll())
+        let (token, value) = registerNotification(reading: [.of(main)], main.TraverseAll())
         XCTAssertEqual(Array(value), [])
         
         expectingSomeNotifications([token], main.DefinePrim("/foo", "Cube"))
@@ -692,7 +694,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_CreateClassPrim_ExportToString() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.ExportToString())
+        let (token, value) = registerNotification(reading: [.of(main)], main.ExportToString())
         XCTAssertEqual(value, #"""
         #usda 1.0
         (
@@ -722,7 +724,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
     func test_CreateClassPrim_TraverseAll() {
         let main = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Main.usda"), Overlay.UsdStage.LoadAll))
         
-        let (token, value) = registerNotification(main.TraverseAll())
+        let (token, value) = registerNotification(reading: [.of(main)], main.TraverseAll())
         XCTAssertEqual(Array(value), [])
         
         expectingSomeNotifications([token], main.CreateClassPrim("/_class_foo"))
@@ -736,7 +738,7 @@ final class Observation_MutateUsdStage_ReadUsdStage: ObservationHelper {
         
         main.DefinePrim("/foo", "Sphere")
         
-        let (token, value) = registerNotification(main.TraverseAll())
+        let (token, value) = registerNotification(reading: [.of(main)], main.TraverseAll())
         XCTAssertEqual(Array(value), [main.GetPrimAtPath("/foo")])
         
         expectingSomeNotifications([token], main.RemovePrim("/foo"))
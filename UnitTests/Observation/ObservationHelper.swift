@@ -25,11 +25,15 @@ extension String: Error {}
 
 class ObservationHelper: TemporaryDirectoryHelper {
     // When `true`, Observation tests won't check for observation notifications.
-    // This is useful because we haven't fully implemented Observation, but we
-    // still want to enable the tests to help catch potential regressions.
-    // Though, it is fairly unlikely a regression would be caught by one of them,
-    // since they just check that properties have changed as expected.
+    // The Mutate*/Read* tests tell UsdPathObservation what they read by hand, through `reading:`,
+    // because SwiftUsd's own reads don't call into UsdPathObservation. With assertions on, those
+    // tests would only check that the hand-written reads overlap the notices a mutation sends,
+    // not that reading through SwiftUsd is observable. Keep this on until real reads are observed.
     static let DISABLE_NOTIFICATION_ASSERTIONS = true
+    
+    // Whether this test class checks for observation notifications. Tests of the observation
+    // machinery itself override this, because they check UsdPathObservation directly.
+    class var checksNotifications: Bool { !DISABLE_NOTIFICATION_ASSERTIONS }
 
     
     // MARK: private implementation
@@ -40,6 +44,20 @@ class ObservationHelper: TemporaryDirectoryHelper {
         var notifications = [Token]()
     }
     private var context = [Context]()
+    // Registrations re-register after each notification, so stop them
+    // once the test is over instead of waking them for every later test
+    private var isObserving = true
+    // The current tracking of each registration, ended when it's replaced or the test is over
+    private var trackings = [Token: UsdPathObservation.Tracking]()
+    
+    override func tearDownWithError() throws {
+        isObserving = false
+        for tracking in trackings.values {
+            tracking.end()
+        }
+        trackings = [:]
+        try super.tearDownWithError()
+    }
     
     private func _pushContext() {
         context.append(.init())
@@ -55,20 +73,22 @@ class ObservationHelper: TemporaryDirectoryHelper {
     }
     
     // Should not be autoclosure because this is the private implementation!
-    private func _registerNotification<T>(_ token: Token, _ code: @escaping () -> (T)) -> T {
-        if Self.DISABLE_NOTIFICATION_ASSERTIONS { return code() }
+    private func _registerNotification<T>(_ token: Token, _ reads: [UsdPathObservation.Read], _ code: @escaping () -> (T)) -> T {
+        if !Self.checksNotifications { return code() }
         
         
         return withObservationTracking {
-            code()
+            trackings.updateValue(UsdPathObservation.shared.access(reads), forKey: token)?.end()
+            return code()
         } onChange: {
+            guard self.isObserving else { return }
             self._gotNotification(token)
-            _ = self._registerNotification(token, code)
+            _ = self._registerNotification(token, reads, code)
         }
     }
         
     private func _catchNotification<T>(code: () -> (T), notificationsHandler: @escaping ([Token]) -> (Result<Void, String>)) -> T {
-        if Self.DISABLE_NOTIFICATION_ASSERTIONS { return code() }
+        if !Self.checksNotifications { return code() }
         
         let succeedExpectation = XCTestExpectation()
         succeedExpectation.expectationDescription = "Succeed expectation"
@@ -101,17 +121,27 @@ class ObservationHelper: TemporaryDirectoryHelper {
     
     // MARK: registerNotification
     
-    // Generic trailing and generic autoclosures, that return their return type
+    // Generic trailing and generic autoclosures, that return their return type.
+    // `reads` says what `code` reads, and only changes to those notify.
+    // Nothing checks that `code` really reads only those
     @discardableResult
-    func registerNotification<T>(_ code: @escaping () -> (T)) -> (token: Token, value: T) {
+    func registerNotification<T>(reading reads: [UsdPathObservation.Read], _ code: @escaping () -> (T)) -> (token: Token, value: T) {
         let result = Token()
-        return (result, _registerNotification(result, code))
+        return (result, _registerNotification(result, reads, code))
     }
     
     @discardableResult
-    func registerNotification<T>(_ code: @autoclosure @escaping () -> (T)) -> (token: Token, value: T) {
+    func registerNotification<T>(reading reads: [UsdPathObservation.Read], _ code: @autoclosure @escaping () -> (T)) -> (token: Token, value: T) {
         let result = Token()
-        return (result, _registerNotification(result, code))
+        return (result, _registerNotification(result, reads, code))
+    }
+    
+    // For mutations that USD doesn't send any notice for, so nothing can observe them
+    func expectingUnobservableMutation(_ reason: String) {
+        if !Self.checksNotifications { return }
+        #if canImport(Darwin)
+        XCTExpectFailure(reason, strict: true)
+        #endif // #if canImport(Darwin)
     }
     
     
@@ -166,6 +196,23 @@ class ObservationHelper: TemporaryDirectoryHelper {
         }
     }
     
+    // MARK: expectingOnlyNotifications
+    
+    // Expects a notification for each of `tokens`, and none for any other token
+    @discardableResult
+    func expectingOnlyNotifications<T>(_ tokens: [Token], _ code: () -> (T)) -> T {
+        _catchNotification(code: code) { notifications in
+            Set(notifications) == Set(tokens) ? .success(()) : .failure("Expecting only notifications in \(tokens) but got \(notifications)")
+        }
+    }
+    
+    @discardableResult
+    func expectingOnlyNotifications<T>(_ tokens: [Token], _ code: @autoclosure () -> (T)) -> T {
+        _catchNotification(code: code) { notifications in
+            Set(notifications) == Set(tokens) ? .success(()) : .failure("Expecting only notifications in \(tokens) but got \(notifications)")
+        }
+    }
+    
     // MARK: expectingAllNotifications
     
     @discardableResult
@@ -20,6 +20,8 @@
 
 import XCTest
 import Observation
+import OpenUSD
+import Synchronization
 
 @Observable fileprivate class MyClass {
     var x = 4
@@ -27,12 +29,19 @@ import Observation
 }
 
 final class TestingObservationTests: ObservationHelper {
+    // These tests check the testing system and UsdPathObservation themselves, so they don't depend
+    // on SwiftUsd's reads being observed. TfNotice registration from Swift isn't supported on Linux
+    #if os(Linux)
+    override class var checksNotifications: Bool { false }
+    #else
+    override class var checksNotifications: Bool { true }
+    #endif // #if os(Linux)
     
     // MARK: Tests of the testing system
         
     func test_receive_expectedNotification() {
         let c = MyClass()
-        let (token, value) = registerNotification(c.x)
+        let (token, value) = registerNotification(reading: [], c.x)
         XCTAssertEqual(value, 4)
         
         expectingSomeNotifications([token], c.x = 6)
@@ -41,10 +50,10 @@ final class TestingObservationTests: ObservationHelper {
     
     func test_receive_unexpectedNotification() {
         let c = MyClass()
-        let (token, value) = registerNotification(c.x)
+        let (token, value) = registerNotification(reading: [], c.x)
         XCTAssertEqual(value, 4)
 
-        if !ObservationHelper.DISABLE_NOTIFICATION_ASSERTIONS {
+        if Self.checksNotifications {
             #if canImport(Darwin)
             XCTExpectFailure("We do expect a notification, because we read c.x and now we're changing c.x")
             #endif // #if canImport(Darwin)
@@ -56,10 +65,10 @@ final class TestingObservationTests: ObservationHelper {
     
     func test_miss_expectedNotification() {
         let c = MyClass()
-        let (token, value) = registerNotification(c.x)
+        let (token, value) = registerNotification(reading: [], c.x)
         XCTAssertEqual(value, 4)
         
-        if !ObservationHelper.DISABLE_NOTIFICATION_ASSERTIONS {
+        if Self.checksNotifications {
             #if canImport(Darwin)
             XCTExpectFailure("We don't expect a notification, because we're changing c.y without anyone reading it")
             #endif // #if canImport(Darwin)
@@ -71,11 +80,219 @@ final class TestingObservationTests: ObservationHelper {
     
     func test_miss_unexpectedNotification() {
         let c = MyClass()
-        let (token, value) = registerNotification(c.x)
+        let (token, value) = registerNotification(reading: [], c.x)
         XCTAssertEqual(value, 4)
         
         notExpectingNotification(c.x)
         XCTAssertEqual(c.x, 4)
         withExtendedLifetime(token) {}
     }
+    
+    // MARK: Path-indexed USD observation
+    
+    #if !os(Linux)
+    func test_pathObservation_onlyIntersectingReadsNotify() {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        let foo = stage.DefinePrim("/foo", "Sphere")
+        let bar = stage.DefinePrim("/bar", "Sphere")
+        let fooRadius = foo.GetAttribute("radius")
+        let barRadius = bar.GetAttribute("radius")
+        // Author both radii up front, so that setting them later is an info-only change
+        fooRadius.Set(1.0 as Double, pxr.UsdTimeCode.Default())
+        barRadius.Set(1.0 as Double, pxr.UsdTimeCode.Default())
+        
+        let (stageToken, _) = registerNotification(reading: [.stage(stage)], stage.GetStartTimeCode())
+        let (fooToken, _) = registerNotification(reading: [.object(stage, "/foo")], foo.GetAllChildren())
+        let (fooRadiusToken, _) = registerNotification(reading: [.object(stage, "/foo.radius")], fooRadius.HasAuthoredValue())
+        let (barRadiusToken, _) = registerNotification(reading: [.object(stage, "/bar.radius")], barRadius.HasAuthoredValue())
+        
+        // Info-only changes only notify reads of the changed path
+        expectingOnlyNotifications([fooRadiusToken], fooRadius.Set(2.0 as Double, pxr.UsdTimeCode.Default()))
+        expectingOnlyNotifications([barRadiusToken], barRadius.Set(2.0 as Double, pxr.UsdTimeCode.Default()))
+        expectingOnlyNotifications([stageToken], stage.SetStartTimeCode(5))
+        
+        // Resyncs notify reads of ancestors, which see their children change...
+        expectingOnlyNotifications([stageToken, fooToken], stage.DefinePrim("/foo/child", "Xform"))
+        // ...and reads of descendants
+        expectingOnlyNotifications([stageToken, fooToken, fooRadiusToken], stage.RemovePrim("/foo"))
+    }
+    
+    func test_pathObservation_layerReads() {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        let rootLayer = Overlay.Dereference(stage.GetRootLayer())
+        let otherLayer = Overlay.Dereference(pxr.SdfLayer.CreateAnonymous("other", pxr.SdfLayer.FileFormatArguments()))
+        
+        let (rootToken, _) = registerNotification(reading: [.layer(rootLayer)], rootLayer.GetDocumentation())
+        let (otherToken, _) = registerNotification(reading: [.layer(otherLayer)], otherLayer.GetDocumentation())
+        
+        expectingOnlyNotifications([rootToken], rootLayer.SetDocumentation("root"))
+        expectingOnlyNotifications([otherToken], otherLayer.SetDocumentation("other"))
+    }
+    
+    func test_pathObservation_primReads() {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        let foo = stage.DefinePrim("/foo", "Sphere")
+        let bar = stage.DefinePrim("/bar", "Sphere")
+        let fooRadius = foo.GetAttribute("radius")
+        fooRadius.Set(1.0 as Double, pxr.UsdTimeCode.Default())
+        
+        let (fooToken, _) = registerNotification(reading: [.of(foo)], foo.IsActive())
+        let (barToken, _) = registerNotification(reading: [.of(bar)], bar.IsActive())
+        let (contentsToken, _) = registerNotification(reading: [.of(stage)], stage.ExportToString())
+        
+        // Prim reads see info-only changes to their properties, unlike object reads
+        expectingOnlyNotifications([fooToken, contentsToken], fooRadius.Set(2.0 as Double, pxr.UsdTimeCode.Default()))
+        expectingOnlyNotifications([barToken, contentsToken], bar.SetActive(false))
+    }
+    
+    func test_pathObservation_stagesSharingARootLayer() {
+        let first = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "Shared.usda"), .LoadAll))
+        first.DefinePrim("/foo", "Sphere")
+        // Opening without a stage cache makes a second stage, with the same root layer but its own session layer
+        let second = Overlay.Dereference(pxr.UsdStage.Open(pathForStage(named: "Shared.usda"), .LoadAll))
+        XCTAssertEqual(first.GetRootLayer(), second.GetRootLayer())
+        
+        let (firstToken, _) = registerNotification(reading: [.prim(first, "/foo")], first.GetPrimAtPath("/foo").IsActive())
+        let (secondToken, _) = registerNotification(reading: [.prim(second, "/foo")], second.GetPrimAtPath("/foo").IsActive())
+        
+        // Both stages see edits to the root layer...
+        expectingOnlyNotifications([firstToken, secondToken], first.GetPrimAtPath("/foo").SetActive(false))
+        // ...but only the second sees edits to its session layer
+        expectingOnlyNotifications([secondToken]) {
+            Overlay.withUsdEditContext(second, pxr.UsdEditTarget(second.GetSessionLayer(), pxr.SdfLayerOffset(0, 1))) {
+                second.GetPrimAtPath("/foo").SetActive(true)
+            }
+        }
+    }
+    
+    func test_pathObservation_endingTrackingDropsReads() {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        let layer = Overlay.Dereference(stage.GetRootLayer())
+        let baseline = UsdPathObservation.shared.trackedReadCount
+        
+        func track() -> UsdPathObservation.Tracking {
+            withObservationTracking {
+                UsdPathObservation.shared.access(.prim(stage, "/foo"), .object(stage, "/foo.radius"), .layer(layer))
+            } onChange: {}
+        }
+        
+        let first = track()
+        let second = track()
+        XCTAssertEqual(UsdPathObservation.shared.trackedReadCount, baseline + 3)
+        
+        // Reads stay while any tracking still uses them
+        first.end()
+        XCTAssertEqual(UsdPathObservation.shared.trackedReadCount, baseline + 3)
+        second.end()
+        XCTAssertEqual(UsdPathObservation.shared.trackedReadCount, baseline)
+        
+        // Ending twice is harmless
+        second.end()
+        XCTAssertEqual(UsdPathObservation.shared.trackedReadCount, baseline)
+    }
+    
+    func test_pathObservation_newStageAtAnExpiredStagesAddress() {
+        final class Flag: Sendable {
+            let value = Atomic<Bool>(false)
+        }
+        
+        func observe(_ read: UsdPathObservation.Read, _ flag: Flag) -> UsdPathObservation.Tracking {
+            withObservationTracking {
+                UsdPathObservation.shared.access(read)
+            } onChange: {
+                flag.value.store(true, ordering: .relaxed)
+            }
+        }
+        
+        let expiredFlag = Flag()
+        var expired: pxr.UsdStage? = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        expired!.DefinePrim("/foo", "Sphere")
+        let expiredAddress = unsafeBitCast(expired!, to: UnsafeRawPointer.self)
+        let expiredTracking = observe(.prim(expired!, "/foo"), expiredFlag)
+        expired = nil
+        
+        // The allocator usually hands the expired stage's address to the next stage
+        var stages = [pxr.UsdStage]()
+        repeat {
+            stages.append(Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll)))
+        } while stages.count < 10 && unsafeBitCast(stages.last!, to: UnsafeRawPointer.self) != expiredAddress
+        let stage = stages.last!
+        
+        let prim = stage.DefinePrim("/foo", "Sphere")
+        let flag = Flag()
+        let tracking = observe(.prim(stage, "/foo"), flag)
+        prim.SetActive(false)
+        
+        XCTAssertTrue(flag.value.load(ordering: .relaxed))
+        XCTAssertFalse(expiredFlag.value.load(ordering: .relaxed))
+        tracking.end()
+        expiredTracking.end()
+    }
+    
+    // Cost of handling a notice, against stage size and observer count.
+    // Path-indexed reads should only pay for the observers they wake up
+    func test_benchmark_pathObservation() {
+        final class Counter: Sendable {
+            let value = Atomic<Int>(0)
+        }
+        
+        func observe(_ reads: [UsdPathObservation.Read], _ counter: Counter) -> UsdPathObservation.Tracking {
+            withObservationTracking {
+                UsdPathObservation.shared.access(reads)
+            } onChange: {
+                counter.value.wrappingAdd(1, ordering: .relaxed)
+            }
+        }
+        
+        let editCount = 50
+        for primCount in [100, 10_000] {
+            let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+            var radii = [pxr.UsdAttribute]()
+            for i in 0..<primCount {
+                let attr = stage.DefinePrim(pxr.SdfPath(std.string("/root/prim\(i)")), "Sphere").GetAttribute("radius")
+                attr.Set(1.0 as Double, pxr.UsdTimeCode.Default())
+                radii.append(attr)
+            }
+            
+            for observerCount in [100, 10_000] {
+                for indexed in [true, false] {
+                    let counter = Counter()
+                    var trackings = [UsdPathObservation.Tracking]()
+                    for i in 0..<observerCount {
+                        let read: UsdPathObservation.Read = indexed ? .object(stage, radii[i % primCount].GetPath()) : .anything
+                        trackings.append(observe([read], counter))
+                    }
+                    
+                    UsdPathObservation.shared.resetStatistics()
+                    for edit in 0..<editCount {
+                        radii[edit % primCount].Set(Double(edit + 2), pxr.UsdTimeCode.Default())
+                        if !indexed && edit < editCount - 1 {
+                            // Coarse observers are all woken by every edit, so re-observe
+                            for _ in 0..<observerCount { trackings.append(observe([.anything], counter)) }
+                        }
+                    }
+                    let statistics = UsdPathObservation.shared.statistics
+                    for tracking in trackings {
+                        tracking.end()
+                    }
+                    
+                    let woken = counter.value.load(ordering: .relaxed)
+                    print("UsdPathObservation(prims=\(primCount), observers=\(observerCount), \(indexed ? "path-indexed" : "anything")): " +
+                          "\(String(format: "%.4f", milliseconds(statistics.duration / max(1, statistics.noticeCount)))) ms/notice, " +
+                          "\(String(format: "%.1f", Double(woken) / Double(editCount))) observers woken/edit")
+                    
+                    if indexed {
+                        // Each edit only wakes the observers of the prim it edited
+                        let expected = (0..<editCount).reduce(0) { total, edit in
+                            total + (0..<observerCount).filter { $0 % primCount == edit % primCount }.count
+                        }
+                        XCTAssertEqual(woken, expected)
+                    } else {
+                        XCTAssertEqual(woken, observerCount * editCount)
+                    }
+                }
+            }
+        }
+    }
+    #endif // #if !os(Linux)
 }
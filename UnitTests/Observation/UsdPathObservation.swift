@@ -0,0 +1,623 @@
+//===----------------------------------------------------------------------===//
+// This source file is part of github.com/apple/SwiftUsd-Tests
+//
+// Copyright © 2025 Apple Inc. and the SwiftUsd-Tests project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import Observation
+import OpenUSD
+import Synchronization
+
+// Observation backend for USD reads, driven by TfNotice.
+//
+// Inside `withObservationTracking`, call `access(_:)` with what the tracked code reads,
+// and end the returned tracking once the tracking scope is over.
+// When a notice arrives, only the reads it could affect get invalidated:
+// - A resync of path P invalidates reads of P, of P's descendants, and of P's ancestors,
+//   because ancestors can observe their children being added or removed
+// - An info-only change of path P invalidates object reads of exactly P,
+//   and prim reads of P or of the prim that owns property P
+// - Stage notices other than ObjectsChanged (edit target and layer muting changes)
+//   invalidate reads of the stage itself
+// - Sdf notices sent by a layer, and LayersDidChange notices naming it, invalidate reads of that layer.
+//   Layer muting is global, so LayerMutenessChanged invalidates reads of every layer and of the muted layer list
+// - Reads of a stage's contents are invalidated by any notice about that stage, or about a layer it uses
+// - `.anything` is invalidated by every notice
+//
+// Reads are indexed by path per stage, so handling a notice costs one lookup per changed path
+// and per ancestor of it, regardless of how big the stage is or how many observers there are.
+// Stages are told apart by identity, so stages that share a root layer don't see each other's notices,
+// and a new stage allocated where an expired one was doesn't inherit its reads.
+//
+// withObservationTracking calls onChange once and then stops tracking, so invalidated reads
+// are dropped from the index. Reads that are never invalidated are dropped when the last
+// tracking that accessed them ends, so the index only holds reads that are still being tracked.
+final class UsdPathObservation: @unchecked Sendable {
+    static let shared = UsdPathObservation()
+
+    enum Read {
+        // Any change to any stage or layer
+        case anything
+        // Stage-level state, like stage metadata, the edit target, and muted layers
+        case stage(pxr.UsdStage)
+        // A prim or property, as composed on the stage
+        case object(pxr.UsdStage, pxr.SdfPath)
+        // A prim and its properties, as composed on the stage
+        case prim(pxr.UsdStage, pxr.SdfPath)
+        // Everything on the stage, and the layers it uses
+        case contents(pxr.UsdStage)
+        // A layer's contents and state
+        case layer(pxr.SdfLayer)
+        // The global list of muted layers, like `SdfLayer.GetMutedLayers()`
+        case mutedLayers
+
+        static func of(_ stage: pxr.UsdStage) -> Read {
+            .contents(stage)
+        }
+
+        static func of(_ prim: pxr.UsdPrim) -> Read {
+            .prim(Overlay.Dereference(prim.GetStage()), prim.GetPath())
+        }
+
+        static func of(_ object: pxr.UsdObject) -> Read {
+            let path = object.GetPath()
+            let stage = Overlay.Dereference(object.GetStage())
+            return path.IsPrimPath() || path.IsAbsoluteRootPath() ? .prim(stage, path) : .object(stage, path)
+        }
+
+        static func of(_ property: pxr.UsdProperty) -> Read {
+            .object(Overlay.Dereference(property.GetStage()), property.GetPath())
+        }
+
+        static func of(_ attribute: pxr.UsdAttribute) -> Read {
+            .object(Overlay.Dereference(attribute.GetStage()), attribute.GetPath())
+        }
+
+        static func of(_ relationship: pxr.UsdRelationship) -> Read {
+            .object(Overlay.Dereference(relationship.GetStage()), relationship.GetPath())
+        }
+
+        // Forwarded targets depend on every relationship they're forwarded through
+        static func forwardedTargets(of relationship: pxr.UsdRelationship) -> Read {
+            .contents(Overlay.Dereference(relationship.GetStage()))
+        }
+
+        static func of(_ layer: pxr.SdfLayer) -> Read {
+            .layer(layer)
+        }
+
+        static func of(_ editTarget: pxr.UsdEditTarget) -> Read {
+            .layer(Overlay.Dereference(editTarget.GetLayer()))
+        }
+    }
+
+    // Returned by `access(_:)`. Ending it lets the index drop reads nothing else is tracking
+    final class Tracking: @unchecked Sendable {
+        fileprivate let slots: [Slot]
+        fileprivate var isEnded = false
+
+        fileprivate init(_ slots: [Slot]) {
+            self.slots = slots
+        }
+
+        func end() {
+            UsdPathObservation.shared.end(self)
+        }
+    }
+
+    struct Statistics {
+        var noticeCount = 0
+        var changedPathCount = 0
+        var invalidatedCount = 0
+        var duration = Duration.zero
+    }
+
+    // Each stage gets a key with a new id the first time it's read, and keeps it while it's alive.
+    // Keys are compared by id, not address, so once a stage expires, a new stage at the same address
+    // gets a different key instead of joining the expired stage's reads.
+    // The index doesn't keep stages alive
+    fileprivate struct StageKey: Hashable {
+        let id: UInt64
+        let address: UnsafeRawPointer
+        private let weak: Overlay.WeakReferenceHolder<pxr.UsdStage>
+
+        init(id: UInt64, _ stage: pxr.UsdStage) {
+            self.id = id
+            address = Self.address(of: stage)
+            weak = Overlay.WeakReferenceHolder(value: stage)
+        }
+
+        static func address(of stage: pxr.UsdStage) -> UnsafeRawPointer {
+            unsafeBitCast(stage, to: UnsafeRawPointer.self)
+        }
+
+        var stage: pxr.UsdStage? { weak.value }
+
+        static func ==(lhs: Self, rhs: Self) -> Bool {
+            lhs.id == rhs.id
+        }
+
+        func hash(into hasher: inout Hasher) {
+            hasher.combine(id)
+        }
+    }
+
+    fileprivate enum Location {
+        case anything
+        case object(StageKey, pxr.SdfPath)
+        case prim(StageKey, pxr.SdfPath)
+        case contents(StageKey)
+        case layer(String)
+        case mutedLayers
+    }
+
+    // One per tracked read. Its registrar is what withObservationTracking observes
+    fileprivate final class Slot: Observable, @unchecked Sendable {
+        let registrar = ObservationRegistrar()
+        var generation = 0
+        let location: Location
+        // Trackings that accessed this slot and haven't ended. Guarded by `state`
+        var trackingCount = 0
+        // Whether the slot was dropped from the index. Guarded by `state`
+        var isRemoved = false
+        #if !os(Linux)
+        // The listener for notices sent by a layer, for `.layer` slots. Guarded by `state`
+        var layerKey: pxr.TfNotice.SwiftKey?
+        #endif // #if !os(Linux)
+
+        init(_ location: Location) {
+            self.location = location
+        }
+
+        func access() {
+            registrar.access(self, keyPath: \.generation)
+        }
+
+        func invalidate() {
+            registrar.withMutation(of: self, keyPath: \.generation) {
+                generation &+= 1
+            }
+        }
+    }
+
+    private struct PathIndex {
+        var slots: [pxr.SdfPath: Slot] = [:]
+        // For each path, the tracked paths it is a prefix of, including itself
+        var descendants: [pxr.SdfPath: Set<pxr.SdfPath>] = [:]
+
+        var isEmpty: Bool { slots.isEmpty }
+
+        mutating func slot(for path: pxr.SdfPath, _ location: @autoclosure () -> Location) -> Slot {
+            if let result = slots[path] { return result }
+            let result = Slot(location())
+            slots[path] = result
+            forEachPrefix(of: path) { descendants[$0, default: []].insert(path) }
+            return result
+        }
+
+        mutating func remove(_ path: pxr.SdfPath) -> Slot? {
+            guard let result = slots.removeValue(forKey: path) else { return nil }
+            forEachPrefix(of: path) { prefix in
+                descendants[prefix]?.remove(path)
+                if descendants[prefix]?.isEmpty == true {
+                    descendants[prefix] = nil
+                }
+            }
+            return result
+        }
+
+        mutating func removeResynced(_ path: pxr.SdfPath, into result: inout [Slot]) {
+            for descendant in descendants[path] ?? [] {
+                if let slot = remove(descendant) { result.append(slot) }
+            }
+            forEachPrefix(of: path) {
+                if let slot = remove($0) { result.append(slot) }
+            }
+        }
+
+        mutating func removeChangedInfo(_ path: pxr.SdfPath, into result: inout [Slot]) {
+            if let slot = remove(path) { result.append(slot) }
+        }
+
+        private func forEachPrefix(of path: pxr.SdfPath, _ body: (pxr.SdfPath) -> ()) {
+            var prefix = path
+            while !prefix.IsEmpty() {
+                body(prefix)
+                if prefix == pxr.SdfPath.AbsoluteRootPath() { break }
+                prefix = prefix.GetParentPath()
+            }
+        }
+    }
+
+    private struct StageIndex {
+        // `.stage` reads are object reads of the absolute root path
+        var objects = PathIndex()
+        var prims = PathIndex()
+        var contents: Slot?
+
+        var isEmpty: Bool { objects.isEmpty && prims.isEmpty && contents == nil }
+
+        mutating func removeResynced(_ path: pxr.SdfPath, into result: inout [Slot]) {
+            objects.removeResynced(path, into: &result)
+            prims.removeResynced(path, into: &result)
+        }
+
+        mutating func removeChangedInfo(_ path: pxr.SdfPath, into result: inout [Slot]) {
+            objects.removeChangedInfo(path, into: &result)
+            prims.removeChangedInfo(path, into: &result)
+            if path.IsPropertyPath() {
+                prims.removeChangedInfo(path.GetPrimPath(), into: &result)
+            }
+        }
+
+        mutating func removeContents(into result: inout [Slot]) {
+            if let contents {
+                result.append(contents)
+                self.contents = nil
+            }
+        }
+    }
+
+    private struct State {
+        var anything: Slot?
+        var stages: [StageKey: StageIndex] = [:]
+        // The key of the live stage at each address that has reads
+        var stageKeys: [UnsafeRawPointer: StageKey] = [:]
+        var nextStageID: UInt64 = 0
+        var layers: [String: Slot] = [:]
+        var mutedLayers: Slot?
+        var statistics = Statistics()
+
+        // The key of `stage`, or `nil` if nothing reads it
+        func existingKey(for stage: pxr.UsdStage) -> StageKey? {
+            guard let key = stageKeys[StageKey.address(of: stage)], key.stage != nil else { return nil }
+            return key
+        }
+
+        mutating func key(for stage: pxr.UsdStage) -> StageKey {
+            if let key = existingKey(for: stage) { return key }
+            nextStageID += 1
+            let key = StageKey(id: nextStageID, stage)
+            stageKeys[key.address] = key
+            return key
+        }
+
+        // Drops the stage's index and key once nothing reads it anymore
+        mutating func update(_ key: StageKey, _ index: StageIndex) {
+            guard index.isEmpty else {
+                stages[key] = index
+                return
+            }
+            stages[key] = nil
+            if stageKeys[key.address] == key {
+                stageKeys[key.address] = nil
+            }
+        }
+    }
+
+    private let state = Mutex<State>(State())
+
+    #if !os(Linux)
+    private var keys = pxr.TfNotice.SwiftKeys()
+    #endif // #if !os(Linux)
+
+    private init() {
+        #if !os(Linux)
+        keys.push_back(pxr.TfNotice.Register(pxr.UsdNotice.StageNotice.self) { [unowned self] _, caster in
+            if let notice = caster(pxr.UsdNotice.ObjectsChanged.self) {
+                handle(notice)
+            } else if let notice = caster(pxr.UsdNotice.StageEditTargetChanged.self) {
+                handleStageStateChanged(Overlay.Dereference(notice.GetStage()))
+            } else if let notice = caster(pxr.UsdNotice.LayerMutingChanged.self) {
+                handleStageStateChanged(Overlay.Dereference(notice.GetStage()))
+            }
+        })
+        keys.push_back(pxr.TfNotice.Register(pxr.SdfNotice.Base.self) { [unowned self] _, caster in
+            if let notice = caster(pxr.SdfNotice.LayersDidChange.self) {
+                handleLayersChanged(notice.GetLayers().map { String(Overlay.Dereference($0).GetIdentifier()) })
+            } else if caster(pxr.SdfNotice.LayerMutenessChanged.self) != nil {
+                handleLayersChanged(nil)
+            }
+        })
+        #endif // #if !os(Linux)
+    }
+
+    // MARK: Reading
+
+    // Call inside `withObservationTracking` to track the given reads.
+    // End the result when the tracking scope is over, whether or not it was invalidated
+    @discardableResult
+    func access(_ reads: [Read]) -> Tracking {
+        var newLayers = [(Slot, pxr.SdfLayer)]()
+        let slots = state.withLock { state in
+            reads.map { read -> Slot in
+                let result: Slot
+                switch read {
+                case .anything:
+                    if let anything = state.anything {
+                        result = anything
+                    } else {
+                        result = Slot(.anything)
+                        state.anything = result
+                    }
+
+                case let .stage(stage):
+                    let key = state.key(for: stage)
+                    let path = pxr.SdfPath.AbsoluteRootPath()
+                    result = state.stages[key, default: .init()].objects.slot(for: path, .object(key, path))
+
+                case let .object(stage, path):
+                    let key = state.key(for: stage)
+                    result = state.stages[key, default: .init()].objects.slot(for: path, .object(key, path))
+
+                case let .prim(stage, path):
+                    let key = state.key(for: stage)
+                    result = state.stages[key, default: .init()].prims.slot(for: path, .prim(key, path))
+
+                case let .contents(stage):
+                    let key = state.key(for: stage)
+                    if let contents = state.stages[key]?.contents {
+                        result = contents
+                    } else {
+                        result = Slot(.contents(key))
+                        state.stages[key, default: .init()].contents = result
+                    }
+
+                case let .layer(layer):
+                    let key = String(layer.GetIdentifier())
+                    if let slot = state.layers[key] {
+                        result = slot
+                    } else {
+                        result = Slot(.layer(key))
+                        state.layers[key] = result
+                        newLayers.append((result, layer))
+                    }
+
+                case .mutedLayers:
+                    if let mutedLayers = state.mutedLayers {
+                        result = mutedLayers
+                    } else {
+                        result = Slot(.mutedLayers)
+                        state.mutedLayers = result
+                    }
+                }
+                result.trackingCount += 1
+                return result
+            }
+        }
+        for (slot, layer) in newLayers {
+            listen(to: layer, for: slot)
+        }
+        for slot in slots {
+            slot.access()
+        }
+        return Tracking(slots)
+    }
+
+    @discardableResult
+    func access(_ reads: Read...) -> Tracking {
+        access(reads)
+    }
+
+    var statistics: Statistics {
+        state.withLock { $0.statistics }
+    }
+
+    func resetStatistics() {
+        state.withLock { $0.statistics = Statistics() }
+    }
+
+    // How many distinct reads are in the index
+    var trackedReadCount: Int {
+        state.withLock { state in
+            let stageReads = state.stages.values.reduce(0) { total, index in
+                total + index.objects.slots.count + index.prims.slots.count + (index.contents == nil ? 0 : 1)
+            }
+            return stageReads + state.layers.count + (state.anything == nil ? 0 : 1) + (state.mutedLayers == nil ? 0 : 1)
+        }
+    }
+
+    // Drops the tracking's slots that no other tracking is using.
+    // Slots that were already invalidated aren't in the index anymore, and are left alone
+    fileprivate func end(_ tracking: Tracking) {
+        let removed = state.withLock { state in
+            var result = [Slot]()
+            guard !tracking.isEnded else { return result }
+            tracking.isEnded = true
+            for slot in tracking.slots {
+                slot.trackingCount -= 1
+                if slot.trackingCount == 0, Self.remove(slot, from: &state) {
+                    result.append(slot)
+                }
+            }
+            Self.markRemoved(result)
+            return result
+        }
+        revokeLayerKeys(of: removed)
+    }
+
+    // Returns whether `slot` was still in the index
+    private static func remove(_ slot: Slot, from state: inout State) -> Bool {
+        switch slot.location {
+        case .anything:
+            guard state.anything === slot else { return false }
+            state.anything = nil
+
+        case let .object(key, path):
+            guard var index = state.stages[key], index.objects.slots[path] === slot else { return false }
+            _ = index.objects.remove(path)
+            state.update(key, index)
+
+        case let .prim(key, path):
+            guard var index = state.stages[key], index.prims.slots[path] === slot else { return false }
+            _ = index.prims.remove(path)
+            state.update(key, index)
+
+        case let .contents(key):
+            guard var index = state.stages[key], index.contents === slot else { return false }
+            index.contents = nil
+            state.update(key, index)
+
+        case let .layer(identifier):
+            guard state.layers[identifier] === slot else { return false }
+            state.layers[identifier] = nil
+
+        case .mutedLayers:
+            guard state.mutedLayers === slot else { return false }
+            state.mutedLayers = nil
+        }
+        return true
+    }
+
+    private static func markRemoved(_ slots: [Slot]) {
+        for slot in slots {
+            slot.isRemoved = true
+        }
+    }
+
+    // MARK: Layers
+
+    // Notices like LayerInfoDidChange and LayerDirtinessChanged only say which layer
+    // they're about through their sender, so each tracked layer gets its own listener
+    private func listen(to layer: pxr.SdfLayer, for slot: Slot) {
+        #if !os(Linux)
+        let key = pxr.TfNotice.Register(layer, pxr.SdfNotice.Base.self) { [unowned self, weak slot] _ in
+            guard let slot else { return }
+            invalidate(changedPathCount: 1) { state, slots in
+                if Self.remove(slot, from: &state) {
+                    slots.append(slot)
+                }
+            }
+        }
+        let isStale = state.withLock { _ in
+            if slot.isRemoved { return true }
+            slot.layerKey = key
+            return false
+        }
+        if isStale {
+            pxr.TfNotice.Revoke(key)
+        }
+        #endif // #if !os(Linux)
+    }
+
+    // Call after unlocking, so the lock is never held while talking to the notice registry
+    private func revokeLayerKeys(of slots: [Slot]) {
+        #if !os(Linux)
+        let keys = state.withLock { _ in
+            slots.compactMap { slot in
+                defer { slot.layerKey = nil }
+                return slot.layerKey
+            }
+        }
+        for key in keys {
+            pxr.TfNotice.Revoke(key)
+        }
+        #endif // #if !os(Linux)
+    }
+
+    // MARK: Invalidation
+
+    // Runs `body` under the lock to collect invalidated slots,
+    // then invalidates them after unlocking, because onChange handlers may read again
+    private func invalidate(changedPathCount: Int, _ body: (inout State, inout [Slot]) -> ()) {
+        let start = ContinuousClock.now
+        var slots = [Slot]()
+        state.withLock { state in
+            if let anything = state.anything {
+                slots.append(anything)
+                state.anything = nil
+            }
+            body(&state, &slots)
+            Self.markRemoved(slots)
+        }
+        revokeLayerKeys(of: slots)
+        for slot in slots {
+            slot.invalidate()
+        }
+        let duration = ContinuousClock.now - start
+        state.withLock {
+            $0.statistics.noticeCount += 1
+            $0.statistics.changedPathCount += changedPathCount
+            $0.statistics.invalidatedCount += slots.count
+            $0.statistics.duration += duration
+        }
+    }
+
+    private func handle(_ notice: pxr.UsdNotice.ObjectsChanged) {
+        let stage = Overlay.Dereference(notice.GetStage())
+        let resynced = Array(notice.GetResyncedPaths())
+        let changedInfo = Array(notice.GetChangedInfoOnlyPaths())
+        invalidate(changedPathCount: resynced.count + changedInfo.count) { state, slots in
+            guard let key = state.existingKey(for: stage), var index = state.stages[key] else { return }
+            index.removeContents(into: &slots)
+            for path in resynced {
+                index.removeResynced(path, into: &slots)
+            }
+            for path in changedInfo {
+                index.removeChangedInfo(path, into: &slots)
+            }
+            state.update(key, index)
+        }
+    }
+
+    private func handleStageStateChanged(_ stage: pxr.UsdStage) {
+        invalidate(changedPathCount: 1) { state, slots in
+            guard let key = state.existingKey(for: stage), var index = state.stages[key] else { return }
+            index.removeContents(into: &slots)
+            index.objects.removeChangedInfo(pxr.SdfPath.AbsoluteRootPath(), into: &slots)
+            state.update(key, index)
+        }
+    }
+
+    // `nil` means every layer might have changed, like when layer muting changes
+    private func handleLayersChanged(_ identifiers: [String]?) {
+        // Contents reads see every layer their stage uses. There are only as many of these
+        // as stages being read as a whole, so check each one's layers. Composing the used layers
+        // can be slow, so do it without holding the lock. A contents read that starts after this
+        // already sees the changed layers, so it doesn't need to be invalidated
+        let affectedStages = identifiers.map { identifiers in
+            let candidates = state.withLock { state in
+                state.stages.compactMap { key, index in index.contents == nil ? nil : key.stage.map { (key, $0) } }
+            }
+            return Set(candidates.filter { _, stage in
+                stage.GetUsedLayers(true).contains { identifiers.contains(String(Overlay.Dereference($0).GetIdentifier())) }
+            }.map { $0.0 })
+        }
+        invalidate(changedPathCount: identifiers?.count ?? 1) { state, slots in
+            if let identifiers {
+                for identifier in identifiers {
+                    if let slot = state.layers.removeValue(forKey: identifier) { slots.append(slot) }
+                }
+            } else {
+                slots.append(contentsOf: state.layers.values)
+                state.layers = [:]
+                if let mutedLayers = state.mutedLayers {
+                    slots.append(mutedLayers)
+                    state.mutedLayers = nil
+                }
+            }
+
+            for (key, var index) in state.stages where index.contents != nil {
+                if affectedStages?.contains(key) ?? true {
+                    index.removeContents(into: &slots)
+                    state.update(key, index)
+                }
+            }
+        }
+    }
+}
@@ -143,6 +143,105 @@ extension pxr.GfVec4h: NanAwareEquatable {
 
 
 
+// MARK: Binary coding helpers
+
+// Shaped like the attribute snapshots the cache layer writes
+fileprivate struct AttributeSnapshot: Codable, Equatable {
+    var time: pxr.UsdTimeCode
+    var bounds: pxr.GfBBox3d
+    var points: pxr.VtVec3fArray
+    var normals: pxr.VtVec3fArray
+    var faceVertexCounts: pxr.VtIntArray
+    var primvarNames: pxr.VtTokenArray
+    var transforms: [pxr.GfMatrix4d]
+    var comment: String?
+    
+    init(pointCount: Int) {
+        time = 24.0
+        bounds = .init(.init(.init(-1, -1, -1), .init(1, 1, 1)))
+        points = .init(count: pointCount) {
+            for i in $0.indices {
+                let t = Float(i) / Float(max(1, pointCount))
+                $0[i] = .init(sin(t * 100), cos(t * 100), t)
+            }
+        }
+        normals = .init(count: pointCount) {
+            for i in $0.indices { $0[i] = .init(0, Float(i % 2), Float((i + 1) % 2)) }
+        }
+        faceVertexCounts = .init(count: pointCount / 4) {
+            for i in $0.indices { $0[i] = 4 }
+        }
+        primvarNames = [.UsdGeomTokens.points, .UsdGeomTokens.normals]
+        transforms = (0..<16).map { pxr.GfMatrix4d(Double($0 + 1)) }
+        comment = nil
+    }
+}
+
+// Writes through several nested containers, filling each one before its parent writes again,
+// which is the order BinaryEncoder requires
+fileprivate struct NestedContainers: Codable, Equatable {
+    var values: [Int]
+    var scales: [Double]
+    var rows: [[String]]
+    var name: String
+    
+    enum CodingKeys: String, CodingKey {
+        case first, second, name
+    }
+    
+    enum InnerKeys: String, CodingKey {
+        case values, scales
+    }
+    
+    init(values: [Int], scales: [Double], rows: [[String]], name: String) {
+        self.values = values
+        self.scales = scales
+        self.rows = rows
+        self.name = name
+    }
+    
+    func encode(to encoder: Encoder) throws {
+        var container = encoder.container(keyedBy: CodingKeys.self)
+        var first = container.nestedContainer(keyedBy: InnerKeys.self, forKey: .first)
+        try first.encode(values, forKey: .values)
+        var scaleList = first.nestedUnkeyedContainer(forKey: .scales)
+        for scale in scales {
+            try scaleList.encode(scale)
+        }
+        // Opening `second` closes `first` and `scaleList`
+        var second = container.nestedUnkeyedContainer(forKey: .second)
+        for row in rows {
+            var rowList = second.nestedUnkeyedContainer()
+            for element in row {
+                try rowList.encode(element)
+            }
+        }
+        try container.encode(name, forKey: .name)
+    }
+    
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        let first = try container.nestedContainer(keyedBy: InnerKeys.self, forKey: .first)
+        values = try first.decode([Int].self, forKey: .values)
+        var scaleList = try first.nestedUnkeyedContainer(forKey: .scales)
+        scales = []
+        while !scaleList.isAtEnd {
+            scales.append(try scaleList.decode(Double.self))
+        }
+        var second = try container.nestedUnkeyedContainer(forKey: .second)
+        rows = []
+        while !second.isAtEnd {
+            var rowList = try second.nestedUnkeyedContainer()
+            var row = [String]()
+            while !rowList.isAtEnd {
+                row.append(try rowList.decode(String.self))
+            }
+            rows.append(row)
+        }
+        name = try container.decode(String.self, forKey: .name)
+    }
+}
+
 // MARK: CodableTests
 
 final class CodableTests: TemporaryDirectoryHelper {
@@ -165,11 +264,23 @@ final class CodableTests: TemporaryDirectoryHelper {
         XCTAssertTrue(T.self is any Decodable.Type, file: file, line: line)
     }
     
+    var binaryEncoder: BinaryEncoder { BinaryEncoder() }
+    var binaryDecoder: BinaryDecoder { BinaryDecoder() }
+    
+    // Round trips through both JSON and the binary format
     func assertRoundTripsEqual<T: Codable & Equatable>(_ value: T,
                                                        file: StaticString = #filePath, line: UInt = #line) throws {
         let encoded = try encoder.encode(value)
         let decoded = try decoder.decode(T.self, from: encoded)
+        assertDecodedEqual(value, decoded, file: file, line: line)
         
+        let binaryEncoded = try binaryEncoder.encode(value)
+        let binaryDecoded = try binaryDecoder.decode(T.self, from: binaryEncoded)
+        assertDecodedEqual(value, binaryDecoded, file: file, line: line)
+    }
+    
+    private func assertDecodedEqual<T: Equatable>(_ value: T, _ decoded: T,
+                                                  file: StaticString = #filePath, line: UInt = #line) {
         // Casting `value` and `decoded` to the same `NanAwareEquatable` non-existential is tricky
         if let nanAwareValue = value as? any NanAwareEquatable {
             // f implicitly uses open existentials. Returned bool indicates if
@@ -1279,4 +1390,152 @@ final class CodableTests: TemporaryDirectoryHelper {
         assertDecodingFails(pxr.UsdTimeCode.self, #"[4]"#)
         assertDecodingFails(pxr.UsdTimeCode.self, #"[4, ]"#)
     }
+    
+    // MARK: Binary coding
+    
+    func test_BinaryCoding_rawBlocksAreBitExact() throws {
+        let signalingNaN = Float(bitPattern: 0x7fa0_1234)
+        let x: pxr.VtVec3fArray = [.init(-0.0, .nan, signalingNaN), .init(.infinity, -.infinity, .leastNonzeroMagnitude)]
+        let encoded = try binaryEncoder.encode(x)
+        // Header, tag, one byte varint, then the elements
+        XCTAssertEqual(encoded.count, 5 + 1 + 1 + 2 * MemoryLayout<pxr.GfVec3f>.size)
+        
+        let decoded = try binaryDecoder.decode(pxr.VtVec3fArray.self, from: encoded)
+        XCTAssertEqual(x.withUnsafeBufferPointer { Data(buffer: $0) }, decoded.withUnsafeBufferPointer { Data(buffer: $0) })
+        
+        let y = pxr.GfMatrix4d(1, -0.0, .nan, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, .greatestFiniteMagnitude)
+        let decodedY = try binaryDecoder.decode(pxr.GfMatrix4d.self, from: binaryEncoder.encode(y))
+        XCTAssertEqual(withUnsafeBytes(of: y) { Data($0) }, withUnsafeBytes(of: decodedY) { Data($0) })
+        
+        let empty = pxr.VtIntArray()
+        XCTAssertEqual(try binaryDecoder.decode(pxr.VtIntArray.self, from: binaryEncoder.encode(empty)), empty)
+    }
+    
+    func test_BinaryCoding_intervalsArePacked() throws {
+        let x = pxr.GfInterval(2.718, 3.14, true, false)
+        let encoded = try binaryEncoder.encode(x)
+        // Header, tag, one byte varint, then two doubles and two flags, without GfInterval's padding
+        XCTAssertEqual(encoded.count, 5 + 1 + 1 + 18)
+        XCTAssertEqual(encoded.suffix(2), Data([1, 0]))
+        XCTAssertEqual(try binaryDecoder.decode(pxr.GfInterval.self, from: encoded), x)
+        
+        let a: pxr.VtIntervalArray = [x, .init(-1, 1, false, true), .init()]
+        let encodedA = try binaryEncoder.encode(a)
+        XCTAssertEqual(encodedA.count, 5 + 1 + 1 + 3 * 18)
+        XCTAssertEqual(try binaryDecoder.decode(pxr.VtIntervalArray.self, from: encodedA), a)
+        XCTAssertEqual(try binaryEncoder.encode(a), encodedA)
+        
+        var invalid = encoded
+        invalid[invalid.endIndex - 1] = 2
+        XCTAssertThrowsError(try binaryDecoder.decode(pxr.GfInterval.self, from: invalid))
+    }
+    
+    func test_BinaryCoding_invalidBoolsFail() throws {
+        let a: pxr.VtBoolArray = [true, false, true]
+        let encoded = try binaryEncoder.encode(a)
+        XCTAssertEqual(encoded.suffix(3), Data([1, 0, 1]))
+        XCTAssertEqual(try binaryDecoder.decode(pxr.VtBoolArray.self, from: encoded), a)
+        
+        var invalid = encoded
+        invalid[invalid.endIndex - 2] = 2
+        XCTAssertThrowsError(try binaryDecoder.decode(pxr.VtBoolArray.self, from: invalid))
+    }
+    
+    func test_BinaryCoding_deeplyNested() throws {
+        var nested: [[[[[[[[Int]]]]]]]] = [[[[[[[[1, 2]]]]]]]]
+        nested.append(nested[0])
+        try assertRoundTripsEqual(nested)
+        XCTAssertThrowsError(try binaryDecoder.decode(type(of: nested), from: binaryEncoder.encode(nested).dropLast()))
+    }
+    
+    func test_BinaryCoding_nestedCodable() throws {
+        let snapshot = AttributeSnapshot(pointCount: 100)
+        try assertRoundTripsEqual(snapshot)
+        
+        var withComment = snapshot
+        withComment.comment = "fizz buzz"
+        try assertRoundTripsEqual(withComment)
+        
+        try assertRoundTripsEqual([pxr.TfToken("a"), pxr.TfToken("b")])
+        try assertRoundTripsEqual(["x": pxr.GfVec2i(1, 2), "y": pxr.GfVec2i(3, 4)])
+        try assertRoundTripsEqual([Int64.min, -1, 0, 1, Int64.max])
+        try assertRoundTripsEqual([UInt64.max])
+    }
+    
+    func test_BinaryCoding_nestedContainersFilledInOrder() throws {
+        try assertRoundTripsEqual(NestedContainers(values: [1, 2, 3], scales: [0.5, 2], rows: [["a", "b"], [], ["c"]], name: "fizz"))
+        try assertRoundTripsEqual(NestedContainers(values: [], scales: [], rows: [], name: ""))
+        
+        // Writing to `first` after `second` was opened would be a precondition failure,
+        // so that can't be checked here without stopping the test process
+    }
+    
+    func test_BinaryCoding_streamingToFileHandle() throws {
+        let snapshot = AttributeSnapshot(pointCount: 10_000)
+        let url = urlForStage(named: "snapshot.bin")
+        XCTAssertTrue(FileManager.default.createFile(atPath: url.path(percentEncoded: false), contents: nil))
+        
+        // A tiny buffer, so the encoder flushes often and writes the arrays directly
+        var streamingEncoder = binaryEncoder
+        streamingEncoder.bufferSize = 64
+        let handle = try FileHandle(forWritingTo: url)
+        try streamingEncoder.encode(snapshot, to: handle)
+        try handle.close()
+        
+        XCTAssertEqual(try dataContentsOfFile(at: url), try binaryEncoder.encode(snapshot))
+        XCTAssertEqual(try binaryDecoder.decode(AttributeSnapshot.self, contentsOf: url), snapshot)
+    }
+    
+    func test_BinaryCoding_decodingFails() throws {
+        let encoded = try binaryEncoder.encode(AttributeSnapshot(pointCount: 10))
+        XCTAssertThrowsError(try binaryDecoder.decode(AttributeSnapshot.self, from: encoded.prefix(encoded.count - 1)))
+        XCTAssertThrowsError(try binaryDecoder.decode(AttributeSnapshot.self, from: encoded + [0]))
+        XCTAssertThrowsError(try binaryDecoder.decode(AttributeSnapshot.self, from: Data("not binary".utf8)))
+        XCTAssertThrowsError(try binaryDecoder.decode(pxr.GfCamera.self, from: encoded))
+        XCTAssertThrowsError(try binaryDecoder.decode(pxr.GfVec3f.self, from: binaryEncoder.encode(pxr.GfVec3d(1, 2, 3))))
+        XCTAssertThrowsError(try binaryDecoder.decode(Int8.self, from: binaryEncoder.encode(300)))
+        XCTAssertThrowsError(try binaryDecoder.decode(String.self, from: binaryEncoder.encode(3.5)))
+    }
+    
+    func test_benchmark_BinaryCoding() throws {
+        func megabytes(_ bytes: Int) -> Double {
+            Double(bytes) / 1_000_000
+        }
+        func measure<T>(_ name: String, bytes: Int, _ body: () throws -> T) rethrows -> T {
+            let start = ContinuousClock.now
+            let (result, peak) = try peakFootprintIncrease(body)
+            let elapsed = milliseconds(ContinuousClock.now - start)
+            print(String(format: "BinaryCoding.\(name): %.1f ms, %.1f MB/s, peak +%.1f MB",
+                         elapsed, megabytes(bytes) / (elapsed / 1000), megabytes(peak)))
+            return result
+        }
+        
+        #if DEBUG
+        let pointCount = 100_000
+        #else
+        let pointCount = 1_000_000
+        #endif
+        let snapshot = AttributeSnapshot(pointCount: pointCount)
+        let payloadBytes = (snapshot.points.size() + snapshot.normals.size()) * MemoryLayout<pxr.GfVec3f>.size
+        
+        let json = try measure("JSONEncoder", bytes: payloadBytes) { try encoder.encode(snapshot) }
+        let binary = try measure("BinaryEncoder", bytes: payloadBytes) { try binaryEncoder.encode(snapshot) }
+        
+        let url = urlForStage(named: "snapshot.bin")
+        XCTAssertTrue(FileManager.default.createFile(atPath: url.path(percentEncoded: false), contents: nil))
+        let handle = try FileHandle(forWritingTo: url)
+        try measure("BinaryEncoder(streaming)", bytes: payloadBytes) { try binaryEncoder.encode(snapshot, to: handle) }
+        try handle.close()
+        
+        let fromJSON = try measure("JSONDecoder", bytes: payloadBytes) { try decoder.decode(AttributeSnapshot.self, from: json) }
+        let fromBinary = try measure("BinaryDecoder", bytes: payloadBytes) { try binaryDecoder.decode(AttributeSnapshot.self, from: binary) }
+        let fromFile = try measure("BinaryDecoder(mapped)", bytes: payloadBytes) { try binaryDecoder.decode(AttributeSnapshot.self, contentsOf: url) }
+        
+        print(String(format: "BinaryCoding(points=%d): JSON %.1f MB, binary %.1f MB (%.1fx smaller)",
+                     pointCount, megabytes(json.count), megabytes(binary.count), Double(json.count) / Double(binary.count)))
+        XCTAssertEqual(fromBinary, snapshot)
+        XCTAssertEqual(fromFile, snapshot)
+        XCTAssertEqual(fromJSON.points.size(), snapshot.points.size())
+        XCTAssertLessThan(binary.count, json.count / 2)
+    }
 }
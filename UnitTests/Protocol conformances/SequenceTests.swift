@@ -464,6 +464,122 @@ final class SequenceTests: TemporaryDirectoryHelper {
         assertConforms(Overlay.SdfAssetPath_VtArray.self)
     }
     
+    // MARK: VtArray contiguous storage
+    
+    func test_VtArray_withUnsafeBufferPointer() {
+        let x: pxr.VtVec3fArray = [pxr.GfVec3f(1, 2, 3), pxr.GfVec3f(4, 5, 6)]
+        XCTAssertEqual(x.withUnsafeBufferPointer { Array($0) }, Array(x))
+        XCTAssertEqual(x.withContiguousStorageIfAvailable { $0.count }, 2)
+        
+        let empty = pxr.VtVec3fArray()
+        XCTAssertEqual(empty.withUnsafeBufferPointer { $0.count }, 0)
+        
+        let tokens: pxr.VtTokenArray = ["foo", "bar"]
+        XCTAssertEqual(tokens.withUnsafeBufferPointer { Array($0) }, ["foo", "bar"])
+    }
+    
+    func test_VtArray_withUnsafeMutableBufferPointer_detachesOnce() {
+        var x: pxr.VtFloatArray = [3, 1, 4]
+        let y = x
+        XCTAssertEqual(x.__cdataUnsafe(), y.__cdataUnsafe())
+        
+        let first = x.withUnsafeMutableBufferPointer {
+            $0[0] = 10
+            return UnsafePointer($0.baseAddress)
+        }
+        // Shared storage was copied before writing, so `y` is unchanged
+        XCTAssertNotEqual(first, y.__cdataUnsafe())
+        XCTAssertEqual(Array(x), [10, 1, 4])
+        XCTAssertEqual(Array(y), [3, 1, 4])
+        
+        // Now `x` is the only owner, so it doesn't copy again
+        let second = x.withContiguousMutableStorageIfAvailable {
+            $0[1] = 20
+            return UnsafePointer($0.baseAddress)
+        }
+        XCTAssertEqual(second, first)
+        XCTAssertEqual(Array(x), [10, 20, 4])
+    }
+    
+    func test_VtArray_bulkInit() {
+        let points = (0..<100).map { pxr.GfVec3f(Float($0), Float($0 * 2), Float($0 * 3)) }
+        XCTAssertEqual(Array(pxr.VtVec3fArray(contiguous: points)), points)
+        XCTAssertEqual(Array(points.withUnsafeBufferPointer { pxr.VtVec3fArray($0) }), points)
+        XCTAssertEqual(Array(pxr.VtVec3fArray(contiguous: points.lazy.filter { $0[0] < 10 })), Array(points.prefix(10)))
+        
+        let strings: pxr.VtStringArray = .init(contiguous: [std.string("foo"), std.string("bar")])
+        XCTAssertEqual(Array(strings), ["foo", "bar"])
+        
+        let squares = pxr.VtIntArray(count: 5) {
+            for i in $0.indices { $0[i] = Int32(i * i) }
+        }
+        XCTAssertEqual(Array(squares), [0, 1, 4, 9, 16])
+        XCTAssertEqual(Array(pxr.VtIntArray(count: 0) { _ in }), [])
+        // Elements the body doesn't update keep their value-initialized value
+        XCTAssertEqual(Array(pxr.VtIntArray(count: 3) { $0[1] = 7 }), [0, 7, 0])
+    }
+    
+    func test_benchmark_VtArray_contiguous() {
+        func measure<T>(_ name: String, _ body: () -> T) -> (Duration, T) {
+            var result = body()
+            var samples = [Duration]()
+            for _ in 0..<3 {
+                let start = ContinuousClock.now
+                result = body()
+                samples.append(ContinuousClock.now - start)
+            }
+            let median = samples.sorted()[samples.count / 2]
+            print(String(format: "VtVec3fArray.\(name): %.1f ms", milliseconds(median)))
+            return (median, result)
+        }
+        
+        #if DEBUG
+        let count = 1_000_000
+        #else
+        let count = 10_000_000
+        #endif
+        let points = pxr.VtVec3fArray(count: count) {
+            for i in $0.indices { $0[i] = pxr.GfVec3f(Float(i % 7), Float(i % 11), Float(i % 13)) }
+        }
+        
+        let (genericSum, expectedSum) = measure("sum(generic)") {
+            var sum: Double = 0
+            for p in points { sum += Double(p[0]) + Double(p[1]) + Double(p[2]) }
+            return sum
+        }
+        let (contiguousSum, sum) = measure("sum(contiguous)") {
+            points.withUnsafeBufferPointer { buffer in
+                var sum: Double = 0
+                for p in buffer { sum += Double(p[0]) + Double(p[1]) + Double(p[2]) }
+                return sum
+            }
+        }
+        XCTAssertEqual(sum, expectedSum)
+        
+        let (genericTransform, expectedScaled) = measure("transform(generic)") {
+            var result = pxr.VtVec3fArray()
+            result.reserve(count)
+            for p in points { result.push_back(pxr.GfVec3f(p[0] * 2, p[1] * 2, p[2] * 2)) }
+            return result
+        }
+        let (contiguousTransform, scaled) = measure("transform(contiguous)") {
+            points.withUnsafeBufferPointer { source in
+                pxr.VtVec3fArray(count: source.count) { destination in
+                    for i in source.indices {
+                        let p = source[i]
+                        destination[i] = pxr.GfVec3f(p[0] * 2, p[1] * 2, p[2] * 2)
+                    }
+                }
+            }
+        }
+        XCTAssertEqual(scaled, expectedScaled)
+        
+        print(String(format: "VtVec3fArray(count=%d): contiguous sum %.1fx, contiguous transform %.1fx faster than generic",
+                     count,
+                     milliseconds(genericSum) / milliseconds(contiguousSum),
+                     milliseconds(genericTransform) / milliseconds(contiguousTransform)))
+    }
+    
     // MARK: std::vector specializations
         
     func test_StringVector() {
@@ -62,18 +62,14 @@ struct RenderConfig {
         self.projMatrix = Self.toGfMatrix4d(projMatrix)
     }
     
-    func render(to dest: URL) {
+    @discardableResult
+    @MainActor func render(to dest: URL, pool: HydraEnginePool = .shared) -> HydraEnginePool.Timing {
+        let clock = ContinuousClock()
+        let setupStart = clock.now
         let drawableSize = pxr.GfVec2i(Int32(size.width), Int32(size.height))
         
         // Hydra init
-        let stage = Overlay.Dereference(pxr.UsdStage.Open(std.string(model.absoluteURL.relativePath), .LoadAll))
-        var hgi: Overlay.HgiWrapper! = Overlay.HgiWrapper.CreatePlatformDefaultHgi()
-        var driver = pxr.HdDriver()
-        driver.name = .HgiTokens.renderDriver
-        driver.driver = hgi.VtValueWrappingHgiRawPtr()
-        var engine: Overlay.UsdImagingGLEngineWrapper! = Overlay.UsdImagingGLEngineWrapper("/", [], [], "/", driver, "", true, false, false, true)
-        engine.SetEnablePresentation(false)
-        engine.SetRendererAov(.HdAovTokens.color)
+        let (stage, engine, isWarm) = pool.checkOut(model: model)
         
         // Prepare to render
         let viewPort = pxr.GfVec4d(0, 0, Double(drawableSize[0]), Double(drawableSize[1]))
@@ -123,6 +119,7 @@ struct RenderConfig {
         renderParams.drawMode = drawMode
         
         // Render
+        let renderStart = clock.now
         var convergeCount = 0
         repeat {
             engine.Render(stage.GetPseudoRoot(), renderParams)
@@ -130,20 +127,46 @@ struct RenderConfig {
         } while (!engine.IsConverged() && convergeCount < 10)
         engine.GetAovTexture(.HdAovTokens.color)
         
+        let writeStart = clock.now
         var writer: TextureBufferWriter! = TextureBufferWriter(engine)
-        writer.Write(dest, hgi: hgi)
+        writer.Write(dest, hgi: pool.hgi)
         // Important: The writer holds on to the engine, but the engine
-        // has to not outlive the hgi.
+        // has to not outlive the hgi. The pool only releases its Hgi
+        // once nothing else is holding on to its engines.
         writer = nil
+        let writeEnd = clock.now
+        
+        let timing = HydraEnginePool.Timing(isWarm: isWarm,
+                                            setup: renderStart - setupStart,
+                                            render: writeStart - renderStart,
+                                            write: writeEnd - writeStart)
+        pool.record(timing)
+        return timing
+    }
+    
+    // Writes `storage` to `path` with HioImage. HioImage widens half pixels to float before quantizing
+    // them for 8-bit formats, so Float16Vec4 readbacks are widened here first with ConvertHalfToFloat,
+    // which uses the vector kernels and splits large images across threads. Every half is exactly
+    // representable as a float, so the written image doesn't change. `floats` is reused across frames
+    static func writeImage(_ storage: Overlay.HioImageWrapper.StorageSpec, to path: String,
+                           metadata: pxr.VtDictionary = .init(), floats: inout [Float]) -> Bool {
+        var storage = storage
+        var image = Overlay.HioImageWrapper.OpenForWriting(std.string(path))
+        guard Bool(image) else { return false }
+        guard storage.format == .HioFormatFloat16Vec4, let halves = storage.data else {
+            return image.Write(storage, metadata)
+        }
         
-        // Important: TextureBufferWriter.Write() requires
-        // the Hgi to be alive
-        withExtendedLifetime(hgi) {}
-        // Important: UsdImagingGLEngine requires its Hgi to
-        // be alive for the engine's lifetime
-        engine = nil
-        withExtendedLifetime(hgi) {}
-        hgi = nil
+        let count = Int(storage.width) * Int(storage.height) * 4
+        if floats.count < count {
+            floats = [Float](repeating: 0, count: count)
+        }
+        return floats.withUnsafeMutableBufferPointer {
+            Overlay.ConvertHalfToFloat(halves.assumingMemoryBound(to: pxr.GfHalf.self), $0.baseAddress!, count)
+            storage.format = .HioFormatFloat32Vec4
+            storage.data = UnsafeMutableRawPointer($0.baseAddress!)
+            return image.Write(storage, metadata)
+        }
     }
     
     // Adapted from pxr/usdImaging/usdAppUtils/frameRecorder.cpp
@@ -152,6 +175,7 @@ struct RenderConfig {
         
         var colorTextureHandle: pxr.HgiTextureHandle = .init()
         var buffer: Overlay.GfHalf_Vector = .init()
+        var floats: [Float] = []
         
         init(_ engine: Overlay.UsdImagingGLEngineWrapper) {
             self.engine = engine
@@ -177,8 +201,7 @@ struct RenderConfig {
             do {
                 // writing image
                 
-                var image = Overlay.HioImageWrapper.OpenForWriting(std.string(dest.absoluteURL.relativePath))
-                let writeSuccess = Bool(image) && image.Write(storage, .init())
+                let writeSuccess = RenderConfig.writeImage(storage, to: dest.absoluteURL.relativePath, floats: &floats)
                 
                 if !writeSuccess {
                     TF_RUNTIME_ERROR(std.string("Failed to write image to \(dest)"))
@@ -222,9 +245,9 @@ struct RenderConfig {
                 var size = 0
                 // Readback into an aligned buffer
                 let alignedBuffer = pxr.HdStTextureUtils.HgiTextureReadback(hgi.__getUnsafe(), colorTextureHandle, &size)
-                // Copy from aligned buffer into vector<GfHalf>
+                // Copy from aligned buffer into GfHalf_Vector
                 let dataByteSize = _GetWidth() * _GetHeight() * pxr.HioGetDataSizeOfFormat(_GetFormat())
-                buffer.resize(dataByteSize)
+                buffer.resizeBytes(dataByteSize)
                 let copyDest = UnsafeMutableRawPointer(buffer.__dataMutatingUnsafe()!)
                 let copySrc = UnsafeRawPointer(alignedBuffer.__getUnsafe()!)
                 copyDest.copyMemory(from: copySrc, byteCount: dataByteSize)
@@ -236,6 +259,104 @@ struct RenderConfig {
     }
 }
 
+// Keeps one Hgi and a warm UsdImagingGLEngine per model alive across renders.
+//
+// Creating the Hgi, creating the engine, opening the stage and populating Hydra
+// dominate the cost of a single RenderConfig render, so RenderConfigs for the same
+// model share a stage and engine, and only swap camera, lights, draw mode and time code.
+// Engines aren't shared across models, because an engine populates Hydra from the first
+// stage it renders and won't repopulate from a different one.
+//
+// All engines share the pool's Hgi. UsdImagingGLEngine requires its Hgi to be alive
+// for the engine's lifetime, so `drain()` releases the engines before the Hgi.
+@MainActor
+final class HydraEnginePool {
+    static let shared = HydraEnginePool()
+    
+    struct Timing {
+        // Whether the engine and stage were reused from an earlier render
+        var isWarm: Bool
+        // Getting the engine and stage, and setting up camera, lights, and render params
+        var setup: Duration
+        // Rendering until converged
+        var render: Duration
+        // Reading back the color AOV and writing it to disk
+        var write: Duration
+        
+        var description: String {
+            func ms(_ d: Duration) -> String {
+                String(format: "%.1f", milliseconds(d))
+            }
+            return "\(isWarm ? "warm" : "cold") setup \(ms(setup)) ms, render \(ms(render)) ms, write \(ms(write)) ms"
+        }
+    }
+    
+    private struct Entry {
+        var stage: pxr.UsdStage
+        var engine: Overlay.UsdImagingGLEngineWrapper
+    }
+    
+    private var _hgi: Overlay.HgiWrapper?
+    private var entries: [URL: Entry] = [:]
+    private var timings: [Timing] = []
+    
+    deinit {
+        // Swift does not guarantee the deinitialization order
+        // of stored properties, so release the engines first
+        entries.removeAll()
+        _hgi = nil
+    }
+    
+    var hgi: Overlay.HgiWrapper {
+        if let _hgi { return _hgi }
+        let result = Overlay.HgiWrapper.CreatePlatformDefaultHgi()
+        _hgi = result
+        return result
+    }
+    
+    func checkOut(model: URL) -> (stage: pxr.UsdStage, engine: Overlay.UsdImagingGLEngineWrapper, isWarm: Bool) {
+        let model = model.absoluteURL
+        if let entry = entries[model] {
+            return (entry.stage, entry.engine, true)
+        }
+        
+        let stage = Overlay.Dereference(pxr.UsdStage.Open(std.string(model.relativePath), .LoadAll))
+        var driver = pxr.HdDriver()
+        driver.name = .HgiTokens.renderDriver
+        driver.driver = hgi.VtValueWrappingHgiRawPtr()
+        let engine = Overlay.UsdImagingGLEngineWrapper("/", [], [], "/", driver, "", true, false, false, true)
+        engine.SetEnablePresentation(false)
+        engine.SetRendererAov(.HdAovTokens.color)
+        
+        entries[model] = Entry(stage: stage, engine: engine)
+        return (stage, engine, false)
+    }
+    
+    func record(_ timing: Timing) {
+        timings.append(timing)
+    }
+    
+    // Releases every engine, then the Hgi, and prints how much time the pool saved
+    func drain() {
+        entries.removeAll()
+        // Important: UsdImagingGLEngine requires its Hgi to
+        // be alive for the engine's lifetime
+        withExtendedLifetime(_hgi) {}
+        _hgi = nil
+        
+        guard !timings.isEmpty else { return }
+        func total(_ timings: [Timing], _ keyPath: KeyPath<Timing, Duration>) -> Duration {
+            timings.reduce(.zero) { $0 + $1[keyPath: keyPath] }
+        }
+        let cold = timings.filter { !$0.isWarm }
+        let warm = timings.filter { $0.isWarm }
+        print("HydraEnginePool: \(timings.count) renders (\(cold.count) cold, \(warm.count) warm), " +
+              "setup \(total(cold, \.setup)) cold + \(total(warm, \.setup)) warm, " +
+              "render \(total(timings, \.render)), write \(total(timings, \.write))")
+        timings.removeAll()
+    }
+}
+
 class HydraHelper: TemporaryDirectoryHelper {
     @discardableResult
     @MainActor func assertRendersEqual(subPath: String, config: RenderConfig, file: StaticString = #filePath, line: UInt = #line) -> URL {
@@ -243,7 +364,8 @@ class HydraHelper: TemporaryDirectoryHelper {
         print("subPath: \(subPath)")
         
         let otherUrl = tempDirectory.appending(path: UUID().uuidString + ".png")
-        config.render(to: otherUrl)
+        let timing = config.render(to: otherUrl)
+        print("timing: \(timing.description)")
         
         assertImagesEqual(urlForResource(subPath: subPath), otherUrl, file: file, line: line)
         return otherUrl
@@ -286,23 +408,7 @@ class HydraHelper: TemporaryDirectoryHelper {
         }
         
         // Create the difference image...
-        var context = CGContext(data: nil, width: lhsCgImage.width, height: lhsCgImage.height,
-                                bitsPerComponent: lhsCgImage.bitsPerComponent, bytesPerRow: lhsCgImage.bytesPerRow,
-                                space: lhsCgImage.colorSpace ?? CGColorSpaceCreateDeviceRGB(), bitmapInfo: lhsCgImage.bitmapInfo.rawValue)
-        if context == nil {
-            // Embree images have no bitmapInfo, so the first CGContext init fails
-            context = CGContext(data: nil, width: lhsCgImage.width, height: lhsCgImage.height,
-                                bitsPerComponent: lhsCgImage.bitsPerComponent, bytesPerRow: lhsCgImage.bytesPerRow,
-                                space: lhsCgImage.colorSpace ?? CGColorSpaceCreateDeviceRGB(), bitmapInfo: CGBitmapInfo(rawValue: CGBitmapInfo.byteOrder32Little.rawValue | CGImageAlphaInfo.noneSkipFirst.rawValue).rawValue)
-            
-        }
-        guard let context else { fatalError() }
-        
-
-        context.setBlendMode(.copy)
-        context.draw(lhsCgImage, in: CGRect(origin: .zero, size: CGSize(width: lhsCgImage.width, height: lhsCgImage.height)), byTiling: false)
-        context.setBlendMode(.difference)
-        context.draw(rhsCgImage, in: CGRect(origin: .zero, size: CGSize(width: lhsCgImage.width, height: lhsCgImage.height)), byTiling: false)
+        let (context, diff) = Self.differenceImage(lhsCgImage, rhsCgImage)
         
         // Save the difference image to disk...
         let differenceImage = context.makeImage()!
@@ -314,51 +420,120 @@ class HydraHelper: TemporaryDirectoryHelper {
         try! differencePngData.write(to: differenceUrl)
 
         
-        let differencePixelData: UnsafeMutableRawPointer = context.data!
-        
-        var badPixelCount = 0
-        var maxBadComponent: UInt8 = 0
-        for x in 0..<lhsCgImage.width {
-            for y in 0..<lhsCgImage.height {
-                let pixelAddress = differencePixelData.advanced(by: y * lhsCgImage.bytesPerRow + 4 * x * lhsCgImage.bitsPerPixel / 8).assumingMemoryBound(to: UInt8.self)
-                let r = pixelAddress.pointee
-                let g = pixelAddress.advanced(by: 1).pointee
-                let b = pixelAddress.advanced(by: 2).pointee
-                let a = pixelAddress.advanced(by: 3).pointee
-                
-                let badPixel = if a != 255 && a != 0 { true }
-                               else if r >= 8 || g >= 8 || b >= 8 { true }
-                               else { false }
-                
-                if badPixel {
-                    badPixelCount += 1
-                    maxBadComponent = max(maxBadComponent, r, g, b)
-                    if !isEmbreeRender {
-                        XCTFail("Found bad pixel at (\(x), \(y)): (\(r), \(g), \(b), \(a))", file: file, line: line)
-                        print(differenceUrl)
-                        print(lhs)
-                        print(rhs)
-                        print("")
-                        return
-                    }
-                }
-            }
+        let badPixelCount = diff.badPixelCount
+        let maxBadComponent = max(diff.maxBadDifference.0, diff.maxBadDifference.1, diff.maxBadDifference.2)
+        
+        if badPixelCount > 0 && !isEmbreeRender {
+            let (x, y) = (Int(diff.firstBadX), Int(diff.firstBadY))
+            let pixelAddress = context.data!.advanced(by: y * context.bytesPerRow + x * Self.differencePixelStride(lhsCgImage)).assumingMemoryBound(to: UInt8.self)
+            let (r, g, b, a) = (pixelAddress[0], pixelAddress[1], pixelAddress[2], pixelAddress[3])
+            XCTFail("Found bad pixel at (\(x), \(y)): (\(r), \(g), \(b), \(a)), \(badPixelCount) bad pixels total. " +
+                    describeDifference(lhsCgImage, rhsCgImage), file: file, line: line)
+            print(differenceUrl)
+            print(lhs)
+            print(rhs)
+            print("")
+            return
         }
         
         if isEmbreeRender {
             let fractionBadPixels = Double(badPixelCount) / (Double(lhsCgImage.width) * Double(lhsCgImage.height))
-            if fractionBadPixels > 0.01 {
-                XCTFail("\(fractionBadPixels * 100)% Embree render pixels were bad")
+            if fractionBadPixels > Self.embreeMaxBadFraction {
+                XCTFail("\(fractionBadPixels * 100)% Embree render pixels were bad. " + describeDifference(lhsCgImage, rhsCgImage))
             }
-            if maxBadComponent > 108 {
-                XCTFail("Embree had maximum bad color component \(maxBadComponent)")
+            if maxBadComponent > Self.embreeMaxBadComponent {
+                XCTFail("Embree had maximum bad color component \(maxBadComponent). " + describeDifference(lhsCgImage, rhsCgImage))
             }
         }
     }
+    
+    // Compares the two images themselves, as 8-bit RGBA, for the failure message.
+    // The difference image check samples with a stride, so its coordinates aren't pixel coordinates
+    // and it only sees the difference, not the two colors
+    private func describeDifference(_ lhs: CGImage, _ rhs: CGImage) -> String {
+        let width = min(lhs.width, rhs.width)
+        let height = min(lhs.height, rhs.height)
+        let lhsPixels = rgba8Pixels(lhs, width: width, height: height)
+        let rhsPixels = rgba8Pixels(rhs, width: width, height: height)
+        let diff = Overlay.DiffImagesRGBA8(lhsPixels, width * 4, rhsPixels, width * 4, Int32(width), Int32(height),
+                                           Overlay.ImageDiffTolerance(r: 7, g: 7, b: 7, a: 7))
+        guard diff.badPixelCount > 0 else {
+            return "As 8-bit RGBA, no pixel differs by more than 7"
+        }
+        let i = 4 * (Int(diff.firstBadY) * width + Int(diff.firstBadX))
+        let d = diff.maxBadDifference
+        return "As 8-bit RGBA, \(diff.badPixelCount) pixels differ by more than 7, " +
+               "first at (\(diff.firstBadX), \(diff.firstBadY)): " +
+               "(\(lhsPixels[i]), \(lhsPixels[i + 1]), \(lhsPixels[i + 2]), \(lhsPixels[i + 3])) vs " +
+               "(\(rhsPixels[i]), \(rhsPixels[i + 1]), \(rhsPixels[i + 2]), \(rhsPixels[i + 3])), " +
+               "largest difference (\(d.0), \(d.1), \(d.2), \(d.3))"
+    }
+    
+    // Embree renders are noisy, so they pass as long as few pixels are bad and none are very far off
+    static let embreeMaxBadFraction = 0.01
+    static let embreeMaxBadComponent: UInt8 = 108
+    
+    // The goldens were validated by sampling the difference image every `4 * bitsPerPixel / 8` bytes
+    // along each row, so the check keeps that stride instead of visiting every pixel
+    static func differencePixelStride(_ image: CGImage) -> Int {
+        4 * image.bitsPerPixel / 8
+    }
+    
+    // Draws `rhs` over `lhs` with the difference blend mode, and checks the result:
+    // a pixel of the difference image is bad if its alpha isn't 0 or 255, or any color channel is 8 or more
+    static func differenceImage(_ lhs: CGImage, _ rhs: CGImage) -> (context: CGContext, diff: Overlay.ImageDiffResult) {
+        var context = CGContext(data: nil, width: lhs.width, height: lhs.height,
+                                bitsPerComponent: lhs.bitsPerComponent, bytesPerRow: lhs.bytesPerRow,
+                                space: lhs.colorSpace ?? CGColorSpaceCreateDeviceRGB(), bitmapInfo: lhs.bitmapInfo.rawValue)
+        if context == nil {
+            // Embree images have no bitmapInfo, so the first CGContext init fails
+            context = CGContext(data: nil, width: lhs.width, height: lhs.height,
+                                bitsPerComponent: lhs.bitsPerComponent, bytesPerRow: lhs.bytesPerRow,
+                                space: lhs.colorSpace ?? CGColorSpaceCreateDeviceRGB(), bitmapInfo: CGBitmapInfo(rawValue: CGBitmapInfo.byteOrder32Little.rawValue | CGImageAlphaInfo.noneSkipFirst.rawValue).rawValue)
+            
+        }
+        guard let context else { fatalError() }
+        
+        context.setBlendMode(.copy)
+        context.draw(lhs, in: CGRect(origin: .zero, size: CGSize(width: lhs.width, height: lhs.height)), byTiling: false)
+        context.setBlendMode(.difference)
+        context.draw(rhs, in: CGRect(origin: .zero, size: CGSize(width: lhs.width, height: lhs.height)), byTiling: false)
+        
+        let diff = Overlay.CheckDifferenceImage(context.data!.assumingMemoryBound(to: UInt8.self), context.bytesPerRow * context.height,
+                                                context.bytesPerRow, differencePixelStride(lhs), Int32(lhs.width), Int32(lhs.height))
+        return (context, diff)
+    }
+    
+    // Decodes the image at `url` as 8-bit premultiplied RGBA in device RGB
+    func rgba8Pixels(contentsOf url: URL) -> (pixels: [UInt8], width: Int, height: Int)? {
+        guard let image = NSImage(contentsOf: url)?.cgImage(forProposedRect: nil, context: nil, hints: nil) else {
+            return nil
+        }
+        return (rgba8Pixels(image, width: image.width, height: image.height), image.width, image.height)
+    }
+    
+    func rgba8Pixels(_ image: CGImage, width: Int, height: Int) -> [UInt8] {
+        var pixels = [UInt8](repeating: 0, count: width * height * 4)
+        pixels.withUnsafeMutableBytes {
+            let context = CGContext(data: $0.baseAddress, width: width, height: height,
+                                    bitsPerComponent: 8, bytesPerRow: width * 4,
+                                    space: CGColorSpaceCreateDeviceRGB(), bitmapInfo: CGImageAlphaInfo.premultipliedLast.rawValue)!
+            context.setBlendMode(.copy)
+            context.draw(image, in: CGRect(origin: .zero, size: CGSize(width: width, height: height)), byTiling: false)
+        }
+        return pixels
+    }
 }
 
 // Storm may be non-deterministic, so these tests may sometimes fail. In that case, manually compare the images and decide if the test should pass or not
 final class RenderingTests: HydraHelper {
+    override class func tearDown() {
+        MainActor.assumeIsolated {
+            HydraEnginePool.shared.drain()
+        }
+        super.tearDown()
+    }
+    
     @MainActor func test_rendering_noArguments() {
         let config = RenderConfig(model: urlForResource(subPath: "Rendering/spinning_top.usdz"), frame: .EarliestTime(), drawMode: .DRAW_SHADED_SMOOTH,
                                   lights: [(false, (0, -2.7226517, -0.004380574, 1), ( (1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0), (0, 0, 0, 1) )), (true, (0, 0, 0, 1), ( (1, 0, 0, 0), (0, 2.220446049250313e-16, 1, 0), (0, -1, 2.220446049250313e-16, 0), (0, 0, 0, 1) ))],
@@ -612,4 +787,153 @@ final class RenderingTests: HydraHelper {
     #endif // #if canImport(SwiftUsd_PXR_ENABLE_OPENIMAGEIO_SUPPORT) || canImport(SwiftUsd_PXR_ENABLE_ALEMBIC_SUPPORT) || canImport(SwiftUsd_PXR_ENABLE_OPENVDB_SUPPORT)
 }
 
+final class ImageBufferTests: XCTestCase {
+    func test_GfHalf_Vector() {
+        var buffer = Overlay.GfHalf_Vector()
+        XCTAssertEqual(buffer.size(), 0)
+        
+        buffer.resizeBytes(4095)
+        XCTAssertEqual(buffer.size(), 2048)
+        XCTAssertEqual(buffer.byteSize(), 4096)
+        XCTAssertEqual(Int(bitPattern: buffer.__dataUnsafe()) % Overlay.GfHalf_Vector.Alignment, 0)
+        
+        // Shrinking keeps the allocation around for the next frame
+        let data = buffer.__dataUnsafe()
+        buffer.resize(16)
+        XCTAssertEqual(buffer.capacity(), 2048)
+        buffer.resize(2048)
+        XCTAssertEqual(buffer.__dataUnsafe(), data)
+        
+        // Multiples of 0.25 in [-100, 412) are exactly representable as halves
+        var floats: [Float] = (0..<2048).map { Float($0) * 0.25 - 100 }
+        Overlay.ConvertFloatToHalf(floats, buffer.__dataMutatingUnsafe(), 2048)
+        var roundTripped = [Float](repeating: 0, count: 2048)
+        Overlay.ConvertHalfToFloat(buffer.__dataUnsafe(), &roundTripped, 2048)
+        XCTAssertEqual(roundTripped, floats)
+        
+        let copy = buffer
+        buffer.resize(0)
+        floats = [Float](repeating: 0, count: 2048)
+        Overlay.ConvertHalfToFloat(copy.__dataUnsafe(), &floats, 2048)
+        XCTAssertEqual(floats, roundTripped)
+    }
+    
+    func test_DiffImagesRGBA8() {
+        let width = 67
+        let height = 33
+        let lhs = [UInt8](repeating: 100, count: width * height * 4)
+        var rhs = lhs
+        rhs[4 * (5 * width + 9) + 1] = 107
+        rhs[4 * (20 * width + 3) + 2] = 120
+        rhs[4 * (30 * width + 60) + 3] = 90
+        
+        let diff = Overlay.DiffImagesRGBA8(lhs, width * 4, rhs, width * 4, Int32(width), Int32(height),
+                                           Overlay.ImageDiffTolerance(r: 7, g: 7, b: 7, a: 7))
+        XCTAssertEqual(diff.badPixelCount, 2)
+        XCTAssertEqual(diff.firstBadX, 3)
+        XCTAssertEqual(diff.firstBadY, 20)
+        XCTAssertEqual(diff.maxBadDifference.0, 0)
+        XCTAssertEqual(diff.maxBadDifference.1, 0)
+        XCTAssertEqual(diff.maxBadDifference.2, 20)
+        XCTAssertEqual(diff.maxBadDifference.3, 10)
+        
+        let same = Overlay.DiffImagesRGBA8(lhs, width * 4, lhs, width * 4, Int32(width), Int32(height),
+                                           Overlay.ImageDiffTolerance(r: 0, g: 0, b: 0, a: 0))
+        XCTAssertEqual(same.badPixelCount, 0)
+        XCTAssertEqual(same.firstBadX, -1)
+        XCTAssertEqual(same.firstBadY, -1)
+    }
+    
+    func test_CheckDifferenceImage() {
+        let width = 19
+        let height = 7
+        let bytesPerPixel = 4
+        let rowBytes = width * bytesPerPixel + 12
+        var difference = [UInt8](repeating: 0, count: rowBytes * height)
+        for y in 0..<height {
+            for x in 0..<width {
+                difference[y * rowBytes + x * bytesPerPixel + 3] = (x + y) % 2 == 0 ? 255 : 0
+            }
+        }
+        // Color differences below 8 and an alpha of 0 or 255 are fine
+        difference[1 * rowBytes + 2 * bytesPerPixel + 0] = 7
+        difference[2 * rowBytes + 4 * bytesPerPixel + 2] = 8
+        difference[5 * rowBytes + 1 * bytesPerPixel + 3] = 128
+        difference[6 * rowBytes + 18 * bytesPerPixel + 1] = 40
+        // Padding past the end of a row is never read
+        difference[3 * rowBytes + width * bytesPerPixel + 3] = 1
+        
+        let result = Overlay.CheckDifferenceImage(difference, difference.count, rowBytes, bytesPerPixel, Int32(width), Int32(height))
+        XCTAssertEqual(result.badPixelCount, 3)
+        XCTAssertEqual(result.firstBadX, 4)
+        XCTAssertEqual(result.firstBadY, 2)
+        XCTAssertEqual(result.maxBadDifference.0, 0)
+        XCTAssertEqual(result.maxBadDifference.1, 40)
+        XCTAssertEqual(result.maxBadDifference.2, 8)
+        XCTAssertEqual(result.maxBadDifference.3, 255)
+    }
+    
+    func test_CheckDifferenceImage_goldenStride() {
+        let width = 8
+        let height = 4
+        let bytesPerPixel = 4
+        let rowBytes = width * bytesPerPixel
+        var difference = [UInt8](repeating: 0, count: rowBytes * height)
+        // With a stride of four pixels, sample (x, y) reads pixel 4x of row y, running into the next rows.
+        // Pixel (1, 0) is never sampled, and pixel (0, 1) is sampled both as (0, 1) and as (2, 0).
+        // Samples in the last rows that start past the end of the image are skipped
+        difference[1 * bytesPerPixel + 0] = 50
+        difference[1 * rowBytes + 0 * bytesPerPixel + 1] = 60
+        
+        let result = Overlay.CheckDifferenceImage(difference, difference.count, rowBytes, 4 * bytesPerPixel,
+                                                  Int32(width), Int32(height))
+        XCTAssertEqual(result.badPixelCount, 2)
+        XCTAssertEqual(result.firstBadX, 2)
+        XCTAssertEqual(result.firstBadY, 0)
+        XCTAssertEqual(result.maxBadDifference.0, 0)
+        XCTAssertEqual(result.maxBadDifference.1, 60)
+    }
+    
+    func test_benchmark_4K() {
+        let width = 3840
+        let height = 2160
+        let count = width * height * 4
+        let iterations = 10
+        
+        func measure(_ name: String, bytes: Int, _ body: () -> ()) {
+            let elapsed = ContinuousClock().measure {
+                for _ in 0..<iterations {
+                    body()
+                }
+            }
+            let seconds = milliseconds(elapsed) / 1e3 / Double(iterations)
+            print("ImageBuffer.\(name)(4K): \(String(format: "%.2f", seconds * 1000)) ms, \(String(format: "%.1f", Double(bytes) / seconds / 1e9)) GB/s")
+        }
+        
+        var buffer = Overlay.GfHalf_Vector()
+        var floats: [Float] = (0..<count).map { Float($0 % 4096) / 4096 }
+        measure("resize(reused)", bytes: count * 2) {
+            buffer.resizeBytes(count * 2)
+        }
+        measure("ConvertFloatToHalf", bytes: count * 4) {
+            Overlay.ConvertFloatToHalf(floats, buffer.__dataMutatingUnsafe(), count)
+        }
+        measure("ConvertHalfToFloat", bytes: count * 2) {
+            Overlay.ConvertHalfToFloat(buffer.__dataUnsafe(), &floats, count)
+        }
+        
+        let lhs = [UInt8](repeating: 128, count: count)
+        var rhs = lhs
+        for i in stride(from: 0, to: count, by: 4099) {
+            rhs[i] = 140
+        }
+        var diff = Overlay.ImageDiffResult()
+        measure("DiffImagesRGBA8", bytes: count * 2) {
+            diff = Overlay.DiffImagesRGBA8(lhs, width * 4, rhs, width * 4, Int32(width), Int32(height),
+                                           Overlay.ImageDiffTolerance(r: 7, g: 7, b: 7, a: 7))
+        }
+        XCTAssertEqual(diff.badPixelCount, (count + 4098) / 4099)
+    }
+}
+
 #endif // #if canImport(SwiftUsd_PXR_ENABLE_USD_IMAGING_SUPPORT)
@@ -20,6 +20,7 @@
 
 import XCTest
 import OpenUSD
+import Synchronization
 public typealias pxr = OpenUSD.pxr
 
 class TemporaryDirectoryHelper: XCTestCase {
@@ -107,3 +108,55 @@ class TemporaryDirectoryHelper: XCTestCase {
     }
 
 }
+
+// For benchmark output
+func milliseconds(_ duration: Duration) -> Double {
+    Double(duration.components.seconds) * 1e3 + Double(duration.components.attoseconds) / 1e15
+}
+
+// Bytes of memory this process is using, as the OS counts it
+fileprivate func currentFootprint() -> Int {
+    #if canImport(Darwin)
+    var info = task_vm_info_data_t()
+    var count = mach_msg_type_number_t(MemoryLayout<task_vm_info_data_t>.size / MemoryLayout<integer_t>.size)
+    let result = withUnsafeMutablePointer(to: &info) {
+        $0.withMemoryRebound(to: integer_t.self, capacity: Int(count)) {
+            task_info(mach_task_self_, task_flavor_t(TASK_VM_INFO), $0, &count)
+        }
+    }
+    return result == KERN_SUCCESS ? Int(info.phys_footprint) : 0
+    #else
+    guard let statm = try? String(contentsOfFile: "/proc/self/statm", encoding: .utf8),
+          let residentPages = statm.split(separator: " ").dropFirst().first.flatMap({ Int($0) }) else { return 0 }
+    return residentPages * sysconf(Int32(_SC_PAGESIZE))
+    #endif
+}
+
+fileprivate final class FootprintSampler: Sendable {
+    let peak = Atomic<Int>(currentFootprint())
+    let isDone = Atomic<Bool>(false)
+    let finished = DispatchSemaphore(value: 0)
+}
+
+// Samples the footprint on a background thread while `body` runs,
+// and returns how far it rose above where it started
+func peakFootprintIncrease<T>(_ body: () throws -> T) rethrows -> (T, Int) {
+    let sampler = FootprintSampler()
+    let baseline = sampler.peak.load(ordering: .relaxed)
+    Thread.detachNewThread {
+        while !sampler.isDone.load(ordering: .acquiring) {
+            let footprint = currentFootprint()
+            if footprint > sampler.peak.load(ordering: .relaxed) {
+                sampler.peak.store(footprint, ordering: .relaxed)
+            }
+            usleep(200)
+        }
+        sampler.finished.signal()
+    }
+    
+    let result = try body()
+    let footprint = currentFootprint()
+    sampler.isDone.store(true, ordering: .releasing)
+    sampler.finished.wait()
+    return (result, max(sampler.peak.load(ordering: .relaxed), footprint) - baseline)
+}
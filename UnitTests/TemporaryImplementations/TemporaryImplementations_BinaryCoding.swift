@@ -0,0 +1,1109 @@
+//===----------------------------------------------------------------------===//
+// This source file is part of github.com/apple/SwiftUsd-Tests
+//
+// Copyright © 2025 Apple Inc. and the SwiftUsd-Tests project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import OpenUSD
+
+// Compact binary encoder and decoder for the existing Codable conformances.
+//
+// Any Codable value round trips, but values that conform to BinaryCodingRawBlock
+// (Gf vectors, matrices, quaternions, ranges, and VtArrays of those and of scalars)
+// skip their Codable conformance and are written as one block of raw little-endian bytes,
+// so a million points is one memcpy instead of three million JSON numbers.
+// Floating point values are stored as their bit patterns, so round trips are bit-exact,
+// including NaN payloads and signed zeros.
+//
+// `BinaryEncoder.encode(_:to:)` streams to a FileHandle through a fixed-size buffer,
+// and writes large raw blocks straight from the value's storage, so the encoded payload
+// is never held in memory. `BinaryDecoder.decode(_:contentsOf:)` memory-maps its input.
+//
+// Format, after a 5 byte header ("SUBC" and a version byte), each value is a tag byte followed by:
+// - null, false, true: nothing
+// - int, uint: a LEB128 varint, zigzag-encoded for int
+// - float32, float64: the little-endian bit pattern
+// - string: a varint byte count, then UTF-8
+// - rawBlock: a varint byte count, then the bytes
+// - unkeyed: values until an end tag
+// - keyed: (varint byte count, UTF-8 key, value) entries until an end tag
+
+#if _endian(big)
+#error("Raw blocks are written in host byte order, so BinaryEncoder requires a little-endian host")
+#endif
+
+// MARK: Raw blocks
+
+// Values whose bytes are their whole state, without padding, so arrays of them can be copied as one block
+protocol BinaryCodingBitwise {
+    init()
+    // Whether `rawBytes`, a whole number of values, are all valid bit patterns
+    static func isValid(rawBytes: UnsafeRawBufferPointer) -> Bool
+}
+
+extension BinaryCodingBitwise {
+    static func isValid(rawBytes: UnsafeRawBufferPointer) -> Bool { true }
+}
+
+// Values encoded as one block of raw bytes instead of through their Codable conformance
+protocol BinaryCodingRawBlock {
+    func withRawBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R
+    // Returns nil if `rawBytes` isn't a valid encoding of this type
+    init?(rawBytes: UnsafeRawBufferPointer)
+}
+
+extension BinaryCodingRawBlock where Self: BinaryCodingBitwise {
+    func withRawBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try withUnsafeBytes(of: self, body)
+    }
+
+    init?(rawBytes: UnsafeRawBufferPointer) {
+        guard rawBytes.count == MemoryLayout<Self>.size, Self.isValid(rawBytes: rawBytes) else { return nil }
+        self.init()
+        withUnsafeMutableBytes(of: &self) { $0.copyMemory(from: rawBytes) }
+    }
+}
+
+extension BinaryCodingRawBlock where Self: VtArrayContiguousStorage, Element: BinaryCodingBitwise {
+    func withRawBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try withUnsafeBufferPointer { try body(UnsafeRawBufferPointer($0)) }
+    }
+
+    init?(rawBytes: UnsafeRawBufferPointer) {
+        let stride = MemoryLayout<Element>.stride
+        guard rawBytes.count % stride == 0, Element.isValid(rawBytes: rawBytes) else { return nil }
+        self.init(count: rawBytes.count / stride) {
+            UnsafeMutableRawBufferPointer($0).copyMemory(from: rawBytes)
+        }
+    }
+}
+
+// Any byte other than 0 and 1 isn't a Bool
+extension Bool: BinaryCodingBitwise {
+    static func isValid(rawBytes: UnsafeRawBufferPointer) -> Bool {
+        rawBytes.allSatisfy { $0 <= 1 }
+    }
+}
+extension Int: BinaryCodingBitwise {}
+extension UInt: BinaryCodingBitwise {}
+extension Int8: BinaryCodingBitwise {}
+extension UInt8: BinaryCodingBitwise {}
+extension Int16: BinaryCodingBitwise {}
+extension UInt16: BinaryCodingBitwise {}
+extension Int32: BinaryCodingBitwise {}
+extension UInt32: BinaryCodingBitwise {}
+extension Int64: BinaryCodingBitwise {}
+extension UInt64: BinaryCodingBitwise {}
+extension Float: BinaryCodingBitwise {}
+extension Double: BinaryCodingBitwise {}
+
+extension pxr.GfHalf: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec2d: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec2f: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec2h: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec2i: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec3d: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec3f: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec3h: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec3i: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec4d: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec4f: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec4h: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfVec4i: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfMatrix2d: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfMatrix2f: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfMatrix3d: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfMatrix3f: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfMatrix4d: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfMatrix4f: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfQuatd: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfQuatf: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfQuath: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfQuaternion: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfRange1d: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfRange1f: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfRange2d: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfRange2f: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfRange3d: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfRange3f: BinaryCodingBitwise, BinaryCodingRawBlock {}
+extension pxr.GfRect2i: BinaryCodingBitwise, BinaryCodingRawBlock {}
+
+extension pxr.VtBoolArray: BinaryCodingRawBlock {}
+extension pxr.VtCharArray: BinaryCodingRawBlock {}
+extension pxr.VtUCharArray: BinaryCodingRawBlock {}
+extension pxr.VtShortArray: BinaryCodingRawBlock {}
+extension pxr.VtUShortArray: BinaryCodingRawBlock {}
+extension pxr.VtIntArray: BinaryCodingRawBlock {}
+extension pxr.VtUIntArray: BinaryCodingRawBlock {}
+extension pxr.VtInt64Array: BinaryCodingRawBlock {}
+extension pxr.VtUInt64Array: BinaryCodingRawBlock {}
+extension pxr.VtHalfArray: BinaryCodingRawBlock {}
+extension pxr.VtFloatArray: BinaryCodingRawBlock {}
+extension pxr.VtDoubleArray: BinaryCodingRawBlock {}
+extension pxr.VtMatrix2dArray: BinaryCodingRawBlock {}
+extension pxr.VtMatrix2fArray: BinaryCodingRawBlock {}
+extension pxr.VtMatrix3dArray: BinaryCodingRawBlock {}
+extension pxr.VtMatrix3fArray: BinaryCodingRawBlock {}
+extension pxr.VtMatrix4dArray: BinaryCodingRawBlock {}
+extension pxr.VtMatrix4fArray: BinaryCodingRawBlock {}
+extension pxr.VtQuatdArray: BinaryCodingRawBlock {}
+extension pxr.VtQuatfArray: BinaryCodingRawBlock {}
+extension pxr.VtQuathArray: BinaryCodingRawBlock {}
+extension pxr.VtQuaternionArray: BinaryCodingRawBlock {}
+extension pxr.VtVec2dArray: BinaryCodingRawBlock {}
+extension pxr.VtVec2fArray: BinaryCodingRawBlock {}
+extension pxr.VtVec2hArray: BinaryCodingRawBlock {}
+extension pxr.VtVec2iArray: BinaryCodingRawBlock {}
+extension pxr.VtVec3dArray: BinaryCodingRawBlock {}
+extension pxr.VtVec3fArray: BinaryCodingRawBlock {}
+extension pxr.VtVec3hArray: BinaryCodingRawBlock {}
+extension pxr.VtVec3iArray: BinaryCodingRawBlock {}
+extension pxr.VtVec4dArray: BinaryCodingRawBlock {}
+extension pxr.VtVec4fArray: BinaryCodingRawBlock {}
+extension pxr.VtVec4hArray: BinaryCodingRawBlock {}
+extension pxr.VtVec4iArray: BinaryCodingRawBlock {}
+extension pxr.VtIntervalArray: BinaryCodingRawBlock {}
+
+extension pxr.VtRange1dArray: BinaryCodingRawBlock {}
+extension pxr.VtRange1fArray: BinaryCodingRawBlock {}
+extension pxr.VtRange2dArray: BinaryCodingRawBlock {}
+extension pxr.VtRange2fArray: BinaryCodingRawBlock {}
+extension pxr.VtRange3dArray: BinaryCodingRawBlock {}
+extension pxr.VtRange3fArray: BinaryCodingRawBlock {}
+extension pxr.VtRect2iArray: BinaryCodingRawBlock {}
+
+// GfInterval has padding after each bound's `closed` flag, so it's written field by field:
+// the min and max as little-endian doubles, then the two flags as one byte each
+extension pxr.GfInterval: BinaryCodingRawBlock {
+    fileprivate static let packedSize = 2 * MemoryLayout<Double>.size + 2
+
+    fileprivate func pack(into bytes: UnsafeMutableRawBufferPointer) {
+        bytes.storeBytes(of: GetMin().bitPattern.littleEndian, toByteOffset: 0, as: UInt64.self)
+        bytes.storeBytes(of: GetMax().bitPattern.littleEndian, toByteOffset: 8, as: UInt64.self)
+        bytes[16] = IsMinClosed() ? 1 : 0
+        bytes[17] = IsMaxClosed() ? 1 : 0
+    }
+
+    fileprivate init?(packed bytes: UnsafeRawBufferPointer) {
+        guard bytes[16] <= 1, bytes[17] <= 1 else { return nil }
+        self.init(Double(bitPattern: UInt64(littleEndian: bytes.loadUnaligned(fromByteOffset: 0, as: UInt64.self))),
+                  Double(bitPattern: UInt64(littleEndian: bytes.loadUnaligned(fromByteOffset: 8, as: UInt64.self))),
+                  bytes[16] == 1, bytes[17] == 1)
+    }
+
+    func withRawBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        try withUnsafeTemporaryAllocation(byteCount: Self.packedSize, alignment: 1) {
+            pack(into: $0)
+            return try body(UnsafeRawBufferPointer($0))
+        }
+    }
+
+    init?(rawBytes: UnsafeRawBufferPointer) {
+        guard rawBytes.count == Self.packedSize else { return nil }
+        self.init(packed: rawBytes)
+    }
+}
+
+extension pxr.VtIntervalArray {
+    func withRawBytes<R>(_ body: (UnsafeRawBufferPointer) throws -> R) rethrows -> R {
+        let size = pxr.GfInterval.packedSize
+        return try withUnsafeBufferPointer { intervals in
+            try withUnsafeTemporaryAllocation(byteCount: intervals.count * size, alignment: 1) { bytes in
+                for (i, interval) in intervals.enumerated() {
+                    interval.pack(into: UnsafeMutableRawBufferPointer(rebasing: bytes[(i * size)..<((i + 1) * size)]))
+                }
+                return try body(UnsafeRawBufferPointer(bytes))
+            }
+        }
+    }
+
+    init?(rawBytes: UnsafeRawBufferPointer) {
+        let size = pxr.GfInterval.packedSize
+        guard rawBytes.count % size == 0 else { return nil }
+        var isValid = true
+        self.init(count: rawBytes.count / size) { intervals in
+            for i in intervals.indices {
+                guard let interval = pxr.GfInterval(packed: UnsafeRawBufferPointer(rebasing: rawBytes[(i * size)..<((i + 1) * size)])) else {
+                    isValid = false
+                    return
+                }
+                intervals[i] = interval
+            }
+        }
+        guard isValid else { return nil }
+    }
+}
+
+// MARK: Public API
+
+// Nested containers must be filled in order, like a stream: once a container writes again,
+// every container nested in it so far is closed, and writing to a closed container is a precondition failure.
+// JSONEncoder builds a tree in memory, so it lets you go back to an earlier nested container
+struct BinaryEncoder {
+    var userInfo: [CodingUserInfoKey: Any] = [:]
+    // How many bytes `encode(_:to:)` buffers before writing to the file handle
+    var bufferSize = 1 << 20
+
+    func encode<T: Encodable>(_ value: T) throws -> Data {
+        let writer = _BinaryWriter(handle: nil, bufferSize: bufferSize)
+        try encode(value, with: writer)
+        return writer.buffer
+    }
+
+    // Writes `value` to `handle` as it's encoded, without building the whole payload in memory
+    func encode<T: Encodable>(_ value: T, to handle: FileHandle) throws {
+        try encode(value, with: _BinaryWriter(handle: handle, bufferSize: bufferSize))
+    }
+
+    private func encode<T: Encodable>(_ value: T, with writer: _BinaryWriter) throws {
+        writer.writeHeader()
+        try writer.encodeValue(value, parent: .root, codingPath: [], userInfo: userInfo)
+        writer.unwind(to: .root)
+        try writer.finish()
+    }
+}
+
+struct BinaryDecoder {
+    var userInfo: [CodingUserInfoKey: Any] = [:]
+
+    func decode<T: Decodable>(_ type: T.Type, from data: Data) throws -> T {
+        let reader = _BinaryReader(data: data)
+        let start = try reader.checkHeader()
+        let result = try reader.decodeValue(T.self, at: start, codingPath: [], userInfo: userInfo)
+        guard try reader.skipValue(at: start, codingPath: []) == data.endIndex else {
+            throw DecodingError.dataCorrupted(.init(codingPath: [], debugDescription: "Trailing bytes after the top-level value"))
+        }
+        return result
+    }
+
+    // Memory-maps the file, so raw blocks are copied straight from the page cache into their values
+    func decode<T: Decodable>(_ type: T.Type, contentsOf url: URL) throws -> T {
+        try decode(type, from: Data(contentsOf: url, options: .alwaysMapped))
+    }
+}
+
+// MARK: Format
+
+private enum _BinaryTag: UInt8 {
+    case null = 0
+    case falseValue
+    case trueValue
+    case int
+    case uint
+    case float32
+    case float64
+    case string
+    case rawBlock
+    case unkeyed
+    case keyed
+    case end
+}
+
+private let _binaryHeader: [UInt8] = Array("SUBC".utf8) + [1]
+
+private struct _BinaryKey: CodingKey {
+    var stringValue: String
+    var intValue: Int?
+
+    init(stringValue: String) {
+        self.stringValue = stringValue
+    }
+
+    init(intValue: Int) {
+        self.stringValue = "\(intValue)"
+        self.intValue = intValue
+    }
+
+    static let `super` = _BinaryKey(stringValue: "super")
+}
+
+// MARK: Writing
+
+private final class _BinaryWriter {
+    // What the value in a frame has written so far
+    enum Content {
+        case empty
+        case primitive
+        case keyed
+        case unkeyed
+    }
+
+    // A frame as seen by the encoder and containers writing into it. Frames at the same depth
+    // reuse the same slot, so `id` tells whether the slot still holds this frame
+    struct Frame {
+        let depth: Int
+        let id: Int
+
+        // Stands for the output itself, above the top-level value. It's never closed
+        static let root = Frame(depth: -1, id: -1)
+    }
+
+    private let handle: FileHandle?
+    private let bufferSize: Int
+    // All output when encoding to memory, otherwise bytes not yet written to `handle`
+    private(set) var buffer = Data()
+    // The first I/O error. Encoding keeps going without writing, and `finish` throws it
+    private var error: Error?
+    // One frame per value being encoded, from the top-level value down.
+    // A frame is closed when a value above it writes, or when its value finishes encoding
+    private var frames = [(id: Int, content: Content)]()
+    private var nextFrameID = 0
+
+    init(handle: FileHandle?, bufferSize: Int) {
+        self.handle = handle
+        self.bufferSize = bufferSize
+        if handle != nil {
+            buffer.reserveCapacity(bufferSize)
+        }
+    }
+
+    // MARK: Bytes
+
+    private func flush() {
+        guard let handle, !buffer.isEmpty else { return }
+        if error == nil {
+            do {
+                try handle.write(contentsOf: buffer)
+            } catch {
+                self.error = error
+            }
+        }
+        buffer.removeAll(keepingCapacity: true)
+    }
+
+    private func flushIfNeeded() {
+        if handle != nil && buffer.count >= bufferSize {
+            flush()
+        }
+    }
+
+    private func append(_ byte: UInt8) {
+        buffer.append(byte)
+        flushIfNeeded()
+    }
+
+    private func append(_ bytes: UnsafeRawBufferPointer) {
+        guard let baseAddress = bytes.baseAddress, bytes.count > 0 else { return }
+        if let handle, bytes.count >= bufferSize {
+            // Large blocks skip the buffer and are written from the value's own storage
+            flush()
+            guard error == nil else { return }
+            do {
+                try handle.write(contentsOf: Data(bytesNoCopy: UnsafeMutableRawPointer(mutating: baseAddress),
+                                                  count: bytes.count, deallocator: .none))
+            } catch {
+                self.error = error
+            }
+            return
+        }
+        buffer.append(baseAddress.assumingMemoryBound(to: UInt8.self), count: bytes.count)
+        flushIfNeeded()
+    }
+
+    private func append(_ tag: _BinaryTag) {
+        append(tag.rawValue)
+    }
+
+    private func appendVarint(_ value: UInt64) {
+        var value = value
+        while value >= 0x80 {
+            buffer.append(UInt8(truncatingIfNeeded: value) | 0x80)
+            value >>= 7
+        }
+        append(UInt8(value))
+    }
+
+    private func appendFixed<T: FixedWidthInteger>(_ value: T) {
+        withUnsafeBytes(of: value.littleEndian) { append($0) }
+    }
+
+    func writeHeader() {
+        _binaryHeader.withUnsafeBytes { append($0) }
+    }
+
+    func finish() throws {
+        flush()
+        if let error { throw error }
+    }
+
+    // MARK: Primitives
+
+    func writeNil() { append(.null) }
+    func write(_ value: Bool) { append(value ? .trueValue : .falseValue) }
+    func write(_ value: Float) { append(.float32); appendFixed(value.bitPattern) }
+    func write(_ value: Double) { append(.float64); appendFixed(value.bitPattern) }
+
+    func write<T: FixedWidthInteger & SignedInteger>(_ value: T) {
+        let value = Int64(value)
+        append(.int)
+        appendVarint(UInt64(bitPattern: (value << 1) ^ (value >> 63)))
+    }
+
+    func write<T: FixedWidthInteger & UnsignedInteger>(_ value: T) {
+        append(.uint)
+        appendVarint(UInt64(value))
+    }
+
+    func write(_ value: String) {
+        append(.string)
+        writeKey(value)
+    }
+
+    // Keys are strings without a tag
+    func writeKey(_ key: String) {
+        var key = key
+        key.withUTF8 {
+            appendVarint(UInt64($0.count))
+            append(UnsafeRawBufferPointer($0))
+        }
+    }
+
+    func writeRawBlock(_ value: some BinaryCodingRawBlock) {
+        value.withRawBytes {
+            append(.rawBlock)
+            appendVarint(UInt64($0.count))
+            append($0)
+        }
+    }
+
+    // MARK: Frames
+
+    private func isOpen(_ frame: Frame) -> Bool {
+        frame.depth == -1 || (frame.depth < frames.count && frames[frame.depth].id == frame.id)
+    }
+
+    // Closes every frame above `frame`, which has to still be open
+    func unwind(to frame: Frame) {
+        precondition(isOpen(frame), "Wrote to a closed container. Nested containers must be filled in order, " +
+                                    "before the container they're nested in writes again")
+        while frames.count > frame.depth + 1 {
+            switch frames.removeLast().content {
+            case .empty:
+                // The value didn't encode anything, so write what JSONEncoder would: an empty keyed container
+                append(.keyed)
+                append(.end)
+            case .primitive:
+                break
+            case .keyed, .unkeyed:
+                append(.end)
+            }
+        }
+    }
+
+    func pushFrame() -> Frame {
+        nextFrameID += 1
+        frames.append((nextFrameID, .empty))
+        return Frame(depth: frames.count - 1, id: nextFrameID)
+    }
+
+    // Called before the value in `frame` writes a primitive
+    func beginPrimitive(in frame: Frame) {
+        unwind(to: frame)
+        precondition(frames[frame.depth].content == .empty, "A single value container can only encode one value")
+        frames[frame.depth].content = .primitive
+    }
+
+    // Opens a container for the value in `frame`, or reuses it if it's already open
+    func open(_ content: Content, in frame: Frame) {
+        unwind(to: frame)
+        switch frames[frame.depth].content {
+        case .empty:
+            append(content == .keyed ? .keyed : .unkeyed)
+            frames[frame.depth].content = content
+        case content:
+            break
+        default:
+            preconditionFailure("A value can only encode one kind of container")
+        }
+    }
+
+    // Encodes `value` as a new element of the container in `parent`
+    func encodeValue<T: Encodable>(_ value: T, parent: Frame, codingPath: [CodingKey], userInfo: [CodingUserInfoKey: Any]) throws {
+        unwind(to: parent)
+        if let value = value as? any BinaryCodingRawBlock {
+            writeRawBlock(value)
+            return
+        }
+        let frame = pushFrame()
+        try value.encode(to: _BinaryEncoder(writer: self, frame: frame, codingPath: codingPath, userInfo: userInfo))
+        unwind(to: parent)
+    }
+}
+
+private struct _BinaryEncoder: Encoder, SingleValueEncodingContainer {
+    let writer: _BinaryWriter
+    let frame: _BinaryWriter.Frame
+    var codingPath: [CodingKey]
+    var userInfo: [CodingUserInfoKey: Any]
+
+    func container<Key: CodingKey>(keyedBy type: Key.Type) -> KeyedEncodingContainer<Key> {
+        writer.open(.keyed, in: frame)
+        return KeyedEncodingContainer(_BinaryKeyedEncodingContainer<Key>(writer: writer, frame: frame, codingPath: codingPath, userInfo: userInfo))
+    }
+
+    func unkeyedContainer() -> UnkeyedEncodingContainer {
+        writer.open(.unkeyed, in: frame)
+        return _BinaryUnkeyedEncodingContainer(writer: writer, frame: frame, codingPath: codingPath, userInfo: userInfo)
+    }
+
+    func singleValueContainer() -> SingleValueEncodingContainer {
+        self
+    }
+
+    // MARK: SingleValueEncodingContainer
+
+    func encodeNil() throws { writer.beginPrimitive(in: frame); writer.writeNil() }
+    func encode(_ value: Bool) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: String) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: Double) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: Float) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: Int) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: Int8) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: Int16) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: Int32) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: Int64) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: UInt) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: UInt8) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: UInt16) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: UInt32) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+    func encode(_ value: UInt64) throws { writer.beginPrimitive(in: frame); writer.write(value) }
+
+    func encode<T: Encodable>(_ value: T) throws {
+        if let value = value as? any BinaryCodingRawBlock {
+            writer.beginPrimitive(in: frame)
+            writer.writeRawBlock(value)
+        } else {
+            // The value is this frame's value, so it encodes into the same frame
+            try value.encode(to: self)
+        }
+    }
+}
+
+private struct _BinaryKeyedEncodingContainer<Key: CodingKey>: KeyedEncodingContainerProtocol {
+    let writer: _BinaryWriter
+    let frame: _BinaryWriter.Frame
+    var codingPath: [CodingKey]
+    let userInfo: [CodingUserInfoKey: Any]
+
+    private func begin(_ key: Key) {
+        writer.unwind(to: frame)
+        writer.writeKey(key.stringValue)
+    }
+
+    mutating func encodeNil(forKey key: Key) throws { begin(key); writer.writeNil() }
+    mutating func encode(_ value: Bool, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: String, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: Double, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: Float, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: Int, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: Int8, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: Int16, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: Int32, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: Int64, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: UInt, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: UInt8, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: UInt16, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: UInt32, forKey key: Key) throws { begin(key); writer.write(value) }
+    mutating func encode(_ value: UInt64, forKey key: Key) throws { begin(key); writer.write(value) }
+
+    mutating func encode<T: Encodable>(_ value: T, forKey key: Key) throws {
+        begin(key)
+        try writer.encodeValue(value, parent: frame, codingPath: codingPath + [key], userInfo: userInfo)
+    }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy keyType: NestedKey.Type, forKey key: Key) -> KeyedEncodingContainer<NestedKey> {
+        superEncoder(forKey: key).container(keyedBy: keyType)
+    }
+
+    mutating func nestedUnkeyedContainer(forKey key: Key) -> UnkeyedEncodingContainer {
+        superEncoder(forKey: key).unkeyedContainer()
+    }
+
+    mutating func superEncoder() -> Encoder {
+        writer.unwind(to: frame)
+        writer.writeKey(_BinaryKey.super.stringValue)
+        return _BinaryEncoder(writer: writer, frame: writer.pushFrame(), codingPath: codingPath + [_BinaryKey.super], userInfo: userInfo)
+    }
+
+    mutating func superEncoder(forKey key: Key) -> Encoder {
+        begin(key)
+        return _BinaryEncoder(writer: writer, frame: writer.pushFrame(), codingPath: codingPath + [key], userInfo: userInfo)
+    }
+}
+
+private struct _BinaryUnkeyedEncodingContainer: UnkeyedEncodingContainer {
+    let writer: _BinaryWriter
+    let frame: _BinaryWriter.Frame
+    var codingPath: [CodingKey]
+    let userInfo: [CodingUserInfoKey: Any]
+    private(set) var count = 0
+
+    init(writer: _BinaryWriter, frame: _BinaryWriter.Frame, codingPath: [CodingKey], userInfo: [CodingUserInfoKey: Any]) {
+        self.writer = writer
+        self.frame = frame
+        self.codingPath = codingPath
+        self.userInfo = userInfo
+    }
+
+    private mutating func begin() {
+        writer.unwind(to: frame)
+        count += 1
+    }
+
+    mutating func encodeNil() throws { begin(); writer.writeNil() }
+    mutating func encode(_ value: Bool) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: String) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: Double) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: Float) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: Int) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: Int8) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: Int16) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: Int32) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: Int64) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: UInt) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: UInt8) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: UInt16) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: UInt32) throws { begin(); writer.write(value) }
+    mutating func encode(_ value: UInt64) throws { begin(); writer.write(value) }
+
+    mutating func encode<T: Encodable>(_ value: T) throws {
+        let key = _BinaryKey(intValue: count)
+        begin()
+        try writer.encodeValue(value, parent: frame, codingPath: codingPath + [key], userInfo: userInfo)
+    }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy keyType: NestedKey.Type) -> KeyedEncodingContainer<NestedKey> {
+        superEncoder().container(keyedBy: keyType)
+    }
+
+    mutating func nestedUnkeyedContainer() -> UnkeyedEncodingContainer {
+        superEncoder().unkeyedContainer()
+    }
+
+    mutating func superEncoder() -> Encoder {
+        let key = _BinaryKey(intValue: count)
+        begin()
+        return _BinaryEncoder(writer: writer, frame: writer.pushFrame(), codingPath: codingPath + [key], userInfo: userInfo)
+    }
+}
+
+// MARK: Reading
+
+private final class _BinaryReader {
+    let data: Data
+    // Where each container that has been skipped over ends, so that decoding a container
+    // doesn't skip its nested containers again, and the whole input is scanned once
+    private var containerEnds = [Int: Int]()
+
+    init(data: Data) {
+        self.data = data
+    }
+
+    private func corrupted(_ codingPath: [CodingKey], _ description: String) -> DecodingError {
+        .dataCorrupted(.init(codingPath: codingPath, debugDescription: description))
+    }
+
+    func checkHeader() throws -> Int {
+        guard data.count >= _binaryHeader.count, data.prefix(_binaryHeader.count).elementsEqual(_binaryHeader) else {
+            throw corrupted([], "Not a binary coded value, or an unsupported version")
+        }
+        return data.startIndex + _binaryHeader.count
+    }
+
+    // MARK: Bytes
+
+    private func byte(at offset: Int, _ codingPath: [CodingKey]) throws -> UInt8 {
+        guard offset < data.endIndex else { throw corrupted(codingPath, "Unexpected end of data") }
+        return data[offset]
+    }
+
+    func tag(at offset: Int, _ codingPath: [CodingKey]) throws -> _BinaryTag {
+        guard let result = _BinaryTag(rawValue: try byte(at: offset, codingPath)) else {
+            throw corrupted(codingPath, "Unknown tag at byte \(offset)")
+        }
+        return result
+    }
+
+    private func varint(at offset: inout Int, _ codingPath: [CodingKey]) throws -> UInt64 {
+        var result: UInt64 = 0
+        var shift: UInt64 = 0
+        while true {
+            let byte = try byte(at: offset, codingPath)
+            offset += 1
+            guard shift < 64 else { throw corrupted(codingPath, "Varint is too long") }
+            result |= UInt64(byte & 0x7f) << shift
+            if byte < 0x80 { return result }
+            shift += 7
+        }
+    }
+
+    private func fixed<T: FixedWidthInteger>(_ type: T.Type, at offset: inout Int, _ codingPath: [CodingKey]) throws -> T {
+        let size = MemoryLayout<T>.size
+        guard offset + size <= data.endIndex else { throw corrupted(codingPath, "Unexpected end of data") }
+        let result = data.withUnsafeBytes {
+            $0.loadUnaligned(fromByteOffset: offset - data.startIndex, as: T.self)
+        }
+        offset += size
+        return T(littleEndian: result)
+    }
+
+    // The range of a length-prefixed run of bytes starting at `offset`
+    private func block(at offset: inout Int, _ codingPath: [CodingKey]) throws -> Range<Int> {
+        let count = try varint(at: &offset, codingPath)
+        guard count <= UInt64(data.endIndex - offset) else { throw corrupted(codingPath, "Unexpected end of data") }
+        let result = offset..<(offset + Int(count))
+        offset = result.upperBound
+        return result
+    }
+
+    func key(at offset: inout Int, _ codingPath: [CodingKey]) throws -> String {
+        let range = try block(at: &offset, codingPath)
+        return String(decoding: data[range], as: UTF8.self)
+    }
+
+    // Returns the offset just past the value at `offset`
+    func skipValue(at offset: Int, codingPath: [CodingKey]) throws -> Int {
+        if let end = containerEnds[offset] { return end }
+        let start = offset
+        var offset = offset
+        let tag = try tag(at: offset, codingPath)
+        offset += 1
+        switch tag {
+        case .null, .falseValue, .trueValue:
+            return offset
+        case .int, .uint:
+            _ = try varint(at: &offset, codingPath)
+            return offset
+        case .float32:
+            return offset + 4
+        case .float64:
+            return offset + 8
+        case .string, .rawBlock:
+            return try block(at: &offset, codingPath).upperBound
+        case .unkeyed:
+            return try forEachElement(at: start, codingPath) { _ in }
+        case .keyed:
+            return try forEachEntry(at: start, codingPath) { _, _ in }
+        case .end:
+            throw corrupted(codingPath, "Unexpected end tag at byte \(offset - 1)")
+        }
+    }
+
+    // Calls `body` with the offset of each element of the unkeyed container at `offset`,
+    // and returns the offset just past the container
+    func forEachElement(at offset: Int, _ codingPath: [CodingKey], _ body: (Int) -> ()) throws -> Int {
+        let start = offset
+        var offset = offset + 1
+        while try tag(at: offset, codingPath) != .end {
+            body(offset)
+            offset = try skipValue(at: offset, codingPath: codingPath)
+        }
+        containerEnds[start] = offset + 1
+        return offset + 1
+    }
+
+    // Calls `body` with the key and value offset of each entry of the keyed container at `offset`,
+    // and returns the offset just past the container
+    func forEachEntry(at offset: Int, _ codingPath: [CodingKey], _ body: (String, Int) -> ()) throws -> Int {
+        let start = offset
+        var offset = offset + 1
+        while try tag(at: offset, codingPath) != .end {
+            let key = try self.key(at: &offset, codingPath)
+            body(key, offset)
+            offset = try skipValue(at: offset, codingPath: codingPath)
+        }
+        containerEnds[start] = offset + 1
+        return offset + 1
+    }
+
+    // MARK: Primitives
+
+    private func typeMismatch<T>(_ type: T.Type, _ tag: _BinaryTag, _ codingPath: [CodingKey]) -> DecodingError {
+        .typeMismatch(type, .init(codingPath: codingPath, debugDescription: "Expected \(type), found \(tag)"))
+    }
+
+    func decodeNil(at offset: Int, _ codingPath: [CodingKey]) throws -> Bool {
+        try tag(at: offset, codingPath) == .null
+    }
+
+    func decode(_ type: Bool.Type, at offset: Int, _ codingPath: [CodingKey]) throws -> Bool {
+        switch try tag(at: offset, codingPath) {
+        case .trueValue: return true
+        case .falseValue: return false
+        case let tag: throw typeMismatch(type, tag, codingPath)
+        }
+    }
+
+    func decode(_ type: Float.Type, at offset: Int, _ codingPath: [CodingKey]) throws -> Float {
+        let tag = try tag(at: offset, codingPath)
+        guard tag == .float32 else { throw typeMismatch(type, tag, codingPath) }
+        var offset = offset + 1
+        return Float(bitPattern: try fixed(UInt32.self, at: &offset, codingPath))
+    }
+
+    func decode(_ type: Double.Type, at offset: Int, _ codingPath: [CodingKey]) throws -> Double {
+        let tag = try tag(at: offset, codingPath)
+        guard tag == .float64 else { throw typeMismatch(type, tag, codingPath) }
+        var offset = offset + 1
+        return Double(bitPattern: try fixed(UInt64.self, at: &offset, codingPath))
+    }
+
+    func decode<T: FixedWidthInteger>(_ type: T.Type, at offset: Int, _ codingPath: [CodingKey]) throws -> T {
+        let tag = try tag(at: offset, codingPath)
+        var offset = offset + 1
+        let result: T?
+        switch tag {
+        case .int:
+            let zigzag = try varint(at: &offset, codingPath)
+            result = T(exactly: Int64(bitPattern: zigzag >> 1) ^ -Int64(bitPattern: zigzag & 1))
+        case .uint:
+            result = T(exactly: try varint(at: &offset, codingPath))
+        default:
+            throw typeMismatch(type, tag, codingPath)
+        }
+        guard let result else { throw corrupted(codingPath, "Integer doesn't fit in \(type)") }
+        return result
+    }
+
+    func decode(_ type: String.Type, at offset: Int, _ codingPath: [CodingKey]) throws -> String {
+        let tag = try tag(at: offset, codingPath)
+        guard tag == .string else { throw typeMismatch(type, tag, codingPath) }
+        var offset = offset + 1
+        return try key(at: &offset, codingPath)
+    }
+
+    func decodeRawBlock<T: BinaryCodingRawBlock>(_ type: T.Type, at offset: Int, _ codingPath: [CodingKey]) throws -> T {
+        let tag = try tag(at: offset, codingPath)
+        guard tag == .rawBlock else { throw typeMismatch(type, tag, codingPath) }
+        var offset = offset + 1
+        let range = try block(at: &offset, codingPath)
+        let result = data.withUnsafeBytes {
+            T(rawBytes: UnsafeRawBufferPointer(rebasing: $0[(range.lowerBound - data.startIndex)..<(range.upperBound - data.startIndex)]))
+        }
+        guard let result else { throw corrupted(codingPath, "\(range.count) bytes aren't a valid \(type)") }
+        return result
+    }
+
+    func decodeValue<T: Decodable>(_ type: T.Type, at offset: Int, codingPath: [CodingKey], userInfo: [CodingUserInfoKey: Any]) throws -> T {
+        if let rawType = T.self as? any BinaryCodingRawBlock.Type {
+            return try decodeRawBlock(rawType, at: offset, codingPath) as! T
+        }
+        return try T(from: _BinaryDecoder(reader: self, offset: offset, codingPath: codingPath, userInfo: userInfo))
+    }
+}
+
+private struct _BinaryDecoder: Decoder, SingleValueDecodingContainer {
+    let reader: _BinaryReader
+    let offset: Int
+    var codingPath: [CodingKey]
+    var userInfo: [CodingUserInfoKey: Any]
+
+    func container<Key: CodingKey>(keyedBy type: Key.Type) throws -> KeyedDecodingContainer<Key> {
+        KeyedDecodingContainer(try _BinaryKeyedDecodingContainer<Key>(decoder: self))
+    }
+
+    func unkeyedContainer() throws -> UnkeyedDecodingContainer {
+        try _BinaryUnkeyedDecodingContainer(decoder: self)
+    }
+
+    func singleValueContainer() throws -> SingleValueDecodingContainer {
+        self
+    }
+
+    // MARK: SingleValueDecodingContainer
+
+    func decodeNil() -> Bool { (try? reader.decodeNil(at: offset, codingPath)) ?? false }
+    func decode(_ type: Bool.Type) throws -> Bool { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: String.Type) throws -> String { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: Double.Type) throws -> Double { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: Float.Type) throws -> Float { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: Int.Type) throws -> Int { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: Int8.Type) throws -> Int8 { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: Int16.Type) throws -> Int16 { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: Int32.Type) throws -> Int32 { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: Int64.Type) throws -> Int64 { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: UInt.Type) throws -> UInt { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: UInt8.Type) throws -> UInt8 { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: UInt16.Type) throws -> UInt16 { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: UInt32.Type) throws -> UInt32 { try reader.decode(type, at: offset, codingPath) }
+    func decode(_ type: UInt64.Type) throws -> UInt64 { try reader.decode(type, at: offset, codingPath) }
+
+    func decode<T: Decodable>(_ type: T.Type) throws -> T {
+        try reader.decodeValue(type, at: offset, codingPath: codingPath, userInfo: userInfo)
+    }
+}
+
+private struct _BinaryKeyedDecodingContainer<Key: CodingKey>: KeyedDecodingContainerProtocol {
+    let reader: _BinaryReader
+    let codingPath: [CodingKey]
+    let userInfo: [CodingUserInfoKey: Any]
+    // Offset of each entry's value
+    private let entries: [String: Int]
+
+    init(decoder: _BinaryDecoder) throws {
+        reader = decoder.reader
+        codingPath = decoder.codingPath
+        userInfo = decoder.userInfo
+
+        let tag = try reader.tag(at: decoder.offset, codingPath)
+        guard tag == .keyed else {
+            throw DecodingError.typeMismatch([String: Any].self, .init(codingPath: codingPath, debugDescription: "Expected a keyed container, found \(tag)"))
+        }
+        var entries = [String: Int]()
+        _ = try reader.forEachEntry(at: decoder.offset, codingPath) { entries[$0] = $1 }
+        self.entries = entries
+    }
+
+    var allKeys: [Key] { entries.keys.compactMap { Key(stringValue: $0) } }
+
+    func contains(_ key: Key) -> Bool { entries[key.stringValue] != nil }
+
+    private func offset(_ key: Key) throws -> Int {
+        guard let result = entries[key.stringValue] else {
+            throw DecodingError.keyNotFound(key, .init(codingPath: codingPath, debugDescription: "No value for key \(key.stringValue)"))
+        }
+        return result
+    }
+
+    func decodeNil(forKey key: Key) throws -> Bool { try reader.decodeNil(at: offset(key), codingPath + [key]) }
+    func decode(_ type: Bool.Type, forKey key: Key) throws -> Bool { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: String.Type, forKey key: Key) throws -> String { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: Double.Type, forKey key: Key) throws -> Double { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: Float.Type, forKey key: Key) throws -> Float { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: Int.Type, forKey key: Key) throws -> Int { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: Int8.Type, forKey key: Key) throws -> Int8 { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: Int16.Type, forKey key: Key) throws -> Int16 { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: Int32.Type, forKey key: Key) throws -> Int32 { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: Int64.Type, forKey key: Key) throws -> Int64 { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: UInt.Type, forKey key: Key) throws -> UInt { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: UInt8.Type, forKey key: Key) throws -> UInt8 { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: UInt16.Type, forKey key: Key) throws -> UInt16 { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: UInt32.Type, forKey key: Key) throws -> UInt32 { try reader.decode(type, at: offset(key), codingPath + [key]) }
+    func decode(_ type: UInt64.Type, forKey key: Key) throws -> UInt64 { try reader.decode(type, at: offset(key), codingPath + [key]) }
+
+    func decode<T: Decodable>(_ type: T.Type, forKey key: Key) throws -> T {
+        try reader.decodeValue(type, at: offset(key), codingPath: codingPath + [key], userInfo: userInfo)
+    }
+
+    func nestedContainer<NestedKey: CodingKey>(keyedBy type: NestedKey.Type, forKey key: Key) throws -> KeyedDecodingContainer<NestedKey> {
+        try superDecoder(forKey: key).container(keyedBy: type)
+    }
+
+    func nestedUnkeyedContainer(forKey key: Key) throws -> UnkeyedDecodingContainer {
+        try superDecoder(forKey: key).unkeyedContainer()
+    }
+
+    func superDecoder() throws -> Decoder {
+        guard let offset = entries[_BinaryKey.super.stringValue] else {
+            throw DecodingError.keyNotFound(_BinaryKey.super, .init(codingPath: codingPath, debugDescription: "No value for key super"))
+        }
+        return _BinaryDecoder(reader: reader, offset: offset, codingPath: codingPath + [_BinaryKey.super], userInfo: userInfo)
+    }
+
+    func superDecoder(forKey key: Key) throws -> Decoder {
+        _BinaryDecoder(reader: reader, offset: try offset(key), codingPath: codingPath + [key], userInfo: userInfo)
+    }
+}
+
+private struct _BinaryUnkeyedDecodingContainer: UnkeyedDecodingContainer {
+    let reader: _BinaryReader
+    let codingPath: [CodingKey]
+    let userInfo: [CodingUserInfoKey: Any]
+    // Offset of each element
+    private let elements: [Int]
+    private(set) var currentIndex = 0
+
+    init(decoder: _BinaryDecoder) throws {
+        reader = decoder.reader
+        codingPath = decoder.codingPath
+        userInfo = decoder.userInfo
+
+        let tag = try reader.tag(at: decoder.offset, codingPath)
+        guard tag == .unkeyed else {
+            throw DecodingError.typeMismatch([Any].self, .init(codingPath: codingPath, debugDescription: "Expected an unkeyed container, found \(tag)"))
+        }
+        var elements = [Int]()
+        _ = try reader.forEachElement(at: decoder.offset, codingPath) { elements.append($0) }
+        self.elements = elements
+    }
+
+    var count: Int? { elements.count }
+    var isAtEnd: Bool { currentIndex >= elements.count }
+
+    // Returns the next element's offset and coding path, and moves past it
+    private mutating func next<T>(_ type: T.Type) throws -> (Int, [CodingKey]) {
+        let path = codingPath + [_BinaryKey(intValue: currentIndex)]
+        guard !isAtEnd else {
+            throw DecodingError.valueNotFound(type, .init(codingPath: path, debugDescription: "Unkeyed container is at end"))
+        }
+        currentIndex += 1
+        return (elements[currentIndex - 1], path)
+    }
+
+    mutating func decodeNil() throws -> Bool {
+        guard !isAtEnd, try reader.decodeNil(at: elements[currentIndex], codingPath) else { return false }
+        currentIndex += 1
+        return true
+    }
+
+    private mutating func decodePrimitive<T>(_ type: T.Type, _ decode: (_BinaryReader, Int, [CodingKey]) throws -> T) throws -> T {
+        let (offset, path) = try next(type)
+        do {
+            return try decode(reader, offset, path)
+        } catch {
+            // Like JSONDecoder, a failed decode doesn't consume the element
+            currentIndex -= 1
+            throw error
+        }
+    }
+
+    mutating func decode(_ type: Bool.Type) throws -> Bool { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: String.Type) throws -> String { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: Double.Type) throws -> Double { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: Float.Type) throws -> Float { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: Int.Type) throws -> Int { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: Int8.Type) throws -> Int8 { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: Int16.Type) throws -> Int16 { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: Int32.Type) throws -> Int32 { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: Int64.Type) throws -> Int64 { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: UInt.Type) throws -> UInt { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: UInt8.Type) throws -> UInt8 { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: UInt16.Type) throws -> UInt16 { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: UInt32.Type) throws -> UInt32 { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+    mutating func decode(_ type: UInt64.Type) throws -> UInt64 { try decodePrimitive(type) { try $0.decode(type, at: $1, $2) } }
+
+    mutating func decode<T: Decodable>(_ type: T.Type) throws -> T {
+        let userInfo = userInfo
+        return try decodePrimitive(type) {
+            try $0.decodeValue(type, at: $1, codingPath: $2, userInfo: userInfo)
+        }
+    }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy type: NestedKey.Type) throws -> KeyedDecodingContainer<NestedKey> {
+        try superDecoder().container(keyedBy: type)
+    }
+
+    mutating func nestedUnkeyedContainer() throws -> UnkeyedDecodingContainer {
+        try superDecoder().unkeyedContainer()
+    }
+
+    mutating func superDecoder() throws -> Decoder {
+        let (offset, path) = try next(Decoder.self)
+        return _BinaryDecoder(reader: reader, offset: offset, codingPath: path, userInfo: userInfo)
+    }
+}
@@ -0,0 +1,168 @@
+//===----------------------------------------------------------------------===//
+// This source file is part of github.com/apple/SwiftUsd-Tests
+//
+// Copyright © 2025 Apple Inc. and the SwiftUsd-Tests project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import OpenUSD
+import Synchronization
+
+// ArResolverWrapper with a concurrent cache of Resolve and CreateIdentifier results.
+//
+// - The cache is split into shards by key hash, each behind its own lock, so threads resolving
+//   different paths rarely contend. One instance can be shared by every Work thread
+// - Keys include the resolver context bound on the calling thread, because Ar context bindings
+//   are per-thread and the same asset path can resolve differently under different contexts
+// - ArNotice::ResolverChanged clears every entry. A resolve that was already in flight when
+//   the notice arrived doesn't store its result, so a stale answer never gets cached
+//
+// `shared` lives for the whole process. `withScopedCache` makes a cache that only lives for
+// the duration of `body`, like ArResolverScopedCache, except that it can be handed to other threads.
+final class CachingArResolver: @unchecked Sendable {
+    static let shared = CachingArResolver()
+
+    struct Statistics {
+        var hits = 0
+        var misses = 0
+        var invalidations = 0
+    }
+
+    private enum Operation: UInt8 {
+        case resolve
+        case createIdentifier
+    }
+
+    private struct Key: Hashable {
+        let operation: Operation
+        let assetPath: String
+        let anchor: String
+        let context: pxr.ArResolverContext
+    }
+
+    // Hits and misses are counted per shard, under the lock the lookup takes anyway,
+    // so threads resolving different paths don't contend on shared counters
+    private struct ShardState {
+        var entries: [Key: String] = [:]
+        var hits = 0
+        var misses = 0
+    }
+
+    private final class Shard: Sendable {
+        let state = Mutex<ShardState>(ShardState())
+    }
+
+    private let resolver: Overlay.ArResolverWrapper
+    private let shards: [Shard]
+    // Bumped by every invalidation, so in-flight misses can tell their result may be stale
+    private let generation = Atomic<Int>(0)
+    private let invalidations = Atomic<Int>(0)
+
+    #if !os(Linux)
+    private var keys = pxr.TfNotice.SwiftKeys()
+    #endif // #if !os(Linux)
+
+    init(resolver: Overlay.ArResolverWrapper = Overlay.ArGetResolver(), shardCount: Int = 64) {
+        precondition(shardCount > 0, "Shard count must be positive")
+        self.resolver = resolver
+        self.shards = (0..<shardCount).map { _ in Shard() }
+
+        #if !os(Linux)
+        keys.push_back(pxr.TfNotice.Register(pxr.ArNotice.ResolverChanged.self) { [weak self] _ in
+            self?.invalidateAll()
+        })
+        #endif // #if !os(Linux)
+    }
+
+    deinit {
+        #if !os(Linux)
+        pxr.TfNotice.Revoke(&keys)
+        #endif // #if !os(Linux)
+    }
+
+    static func withScopedCache<T>(_ body: (CachingArResolver) throws -> T) rethrows -> T {
+        try body(CachingArResolver())
+    }
+
+    var statistics: Statistics {
+        var result = Statistics(invalidations: invalidations.load(ordering: .relaxed))
+        for shard in shards {
+            shard.state.withLock { state in
+                result.hits += state.hits
+                result.misses += state.misses
+            }
+        }
+        return result
+    }
+
+    var count: Int {
+        shards.reduce(0) { result, shard in result + shard.state.withLock { $0.entries.count } }
+    }
+
+    // MARK: Resolving
+
+    func Resolve(_ assetPath: String) -> pxr.ArResolvedPath {
+        let result = cached(Key(operation: .resolve, assetPath: assetPath, anchor: "", context: currentContext())) {
+            String(resolver.Resolve(std.string(assetPath)).GetPathString())
+        }
+        return pxr.ArResolvedPath(std.string(result))
+    }
+
+    func CreateIdentifier(_ assetPath: String, _ anchorAssetPath: pxr.ArResolvedPath) -> String {
+        let anchor = String(anchorAssetPath.GetPathString())
+        return cached(Key(operation: .createIdentifier, assetPath: assetPath, anchor: anchor, context: currentContext())) {
+            String(resolver.CreateIdentifier(std.string(assetPath), anchorAssetPath))
+        }
+    }
+
+    // Drops every cached result. Called for ArNotice::ResolverChanged
+    func invalidateAll() {
+        generation.add(1, ordering: .sequentiallyConsistent)
+        for shard in shards {
+            shard.state.withLock { $0.entries.removeAll() }
+        }
+        invalidations.add(1, ordering: .relaxed)
+    }
+
+    private func currentContext() -> pxr.ArResolverContext {
+        resolver.GetCurrentContext()
+    }
+
+    private func cached(_ key: Key, _ compute: () -> String) -> String {
+        let shard = shards[Int(UInt(bitPattern: key.hashValue) % UInt(shards.count))]
+        let cachedResult = shard.state.withLock { state -> String? in
+            guard let result = state.entries[key] else {
+                state.misses += 1
+                return nil
+            }
+            state.hits += 1
+            return result
+        }
+        if let cachedResult { return cachedResult }
+
+        let startGeneration = generation.load(ordering: .sequentiallyConsistent)
+        let result = compute()
+        shard.state.withLock { state in
+            // Checked under the shard lock: an invalidation either bumped the generation already,
+            // or hasn't cleared this shard yet and will remove the entry when it does
+            if generation.load(ordering: .sequentiallyConsistent) == startGeneration {
+                state.entries[key] = result
+            }
+        }
+        return result
+    }
+}
@@ -21,13 +21,114 @@
 #ifndef TemporaryImplementations_Cpp_hpp
 #define TemporaryImplementations_Cpp_hpp
 
-#include <vector>
+#include <cstddef>
+#include <cstdint>
 #include "pxr/base/gf/half.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/usd/stage.h"
 
 #warning non-empty temporary implementations
 
 namespace Overlay {
-    typedef std::vector<pxr::GfHalf> GfHalf_Vector;
+    // Buffer of GfHalf for reading back framebuffers.
+    // - Storage is aligned to `Alignment` bytes, so conversion kernels can use aligned vector loads
+    // - Resizing never shrinks storage and doesn't zero-fill, so one buffer can be reused
+    //   for every frame of a batch render without reallocating
+    class GfHalf_Vector {
+    public:
+        static constexpr size_t Alignment = 64;
+        
+        GfHalf_Vector() = default;
+        GfHalf_Vector(const GfHalf_Vector& other);
+        GfHalf_Vector(GfHalf_Vector&& other) noexcept;
+        GfHalf_Vector& operator=(const GfHalf_Vector& other);
+        GfHalf_Vector& operator=(GfHalf_Vector&& other) noexcept;
+        ~GfHalf_Vector();
+        
+        size_t size() const { return _size; }
+        size_t capacity() const { return _capacity; }
+        size_t byteSize() const { return _size * sizeof(pxr::GfHalf); }
+        
+        // New elements are uninitialized
+        void resize(size_t count);
+        // Resizes to hold at least `byteCount` bytes
+        void resizeBytes(size_t byteCount);
+        
+        const pxr::GfHalf* data() const { return _data; }
+        pxr::GfHalf* data() { return _data; }
+        
+    private:
+        pxr::GfHalf* _data = nullptr;
+        size_t _size = 0;
+        size_t _capacity = 0;
+    };
+    
+    // Conversion kernels between GfHalf and float. These use F16C on x86_64 and
+    // NEON on arm64 when available, and split large buffers across threads with WorkParallelForN.
+    // Conversion to half rounds to nearest even, like GfHalf(float)
+    void ConvertHalfToFloat(const pxr::GfHalf* src, float* dst, size_t count);
+    void ConvertFloatToHalf(const float* src, pxr::GfHalf* dst, size_t count);
+    
+    // Mean of the squared differences between `count` halves of `lhs` and `rhs`
+    double MeanSquaredDifference(const pxr::GfHalf* lhs, const pxr::GfHalf* rhs, size_t count);
+    
+    struct ImageDiffTolerance {
+        uint8_t r;
+        uint8_t g;
+        uint8_t b;
+        uint8_t a;
+    };
+    
+    struct ImageDiffResult {
+        // Pixels where any channel differs by more than its tolerance
+        size_t badPixelCount;
+        // First bad pixel in row-major order, or (-1, -1) if there are none
+        int firstBadX;
+        int firstBadY;
+        // Largest per-channel difference over all bad pixels, in RGBA order
+        uint8_t maxBadDifference[4];
+    };
+    
+    // Compares two 8-bit RGBA images of the same size, splitting rows across threads
+    ImageDiffResult DiffImagesRGBA8(const uint8_t* lhs, size_t lhsRowBytes,
+                                    const uint8_t* rhs, size_t rhsRowBytes,
+                                    int width, int height, ImageDiffTolerance tolerance);
+    
+    // Checks a difference image, drawn with the difference blend mode, the way the golden-image
+    // tests always have: a pixel is bad if its fourth byte isn't 0 or 255, or any of its first
+    // three bytes is 8 or more. `maxBadDifference` holds the largest of each byte over all bad pixels.
+    //
+    // Sample (x, y) is read at `y * rowBytes + x * pixelStride`. The golden-image tests pass
+    // four times the bytes per pixel, which is the stride they were validated with, so samples can run
+    // past the end of a row into the rows below it. Samples that would read past `byteCount` are skipped
+    ImageDiffResult CheckDifferenceImage(const uint8_t* difference, size_t byteCount, size_t rowBytes,
+                                         size_t pixelStride, int width, int height);
+    
+    // Receives exported usda text in order, in chunks of at most the export's buffer size.
+    // Returning false stops the export, which then returns false
+    typedef bool (^ExportSink)(const char* bytes, size_t count);
+    
+    // Same text as SdfLayer::ExportToString, written to `sink` instead of one std::string.
+    // Layer metadata comes out first, then each root prim as soon as it's written
+    bool ExportToSink(pxr::SdfLayer* layer, size_t bufferSize, ExportSink sink);
+    
+    // Same text as UsdStage::ExportToString, written to `sink` instead of one std::string.
+    // Instead of flattening the whole stage up front, each root prim is flattened on its own
+    // from a stage masked to it, and written before the next one is composed, so only one
+    // flattened root prim is in memory at a time. Streaming stops at root prims, so memory is
+    // only bounded when the scene is split across several of them. The usual single `/World`
+    // stage is still flattened all at once, after an extra masked open for the layer metadata,
+    // so it peaks at least as high as UsdStage::ExportToString. Stages with instancing are
+    // flattened all at once too, because flattening turns prototypes into extra root prims
+    bool ExportToSink(pxr::UsdStage* stage, bool addSourceFileComment, size_t bufferSize, ExportSink sink);
+    
+    // Like ExportToSink, writing to `fd`. The descriptor is left open
+    bool ExportToFileDescriptor(pxr::SdfLayer* layer, size_t bufferSize, int fd);
+    bool ExportToFileDescriptor(pxr::UsdStage* stage, bool addSourceFileComment, size_t bufferSize, int fd);
+    
+    // Sends ArNotice::ResolverChanged for every context, the way a resolver does
+    // when results it already returned may have changed
+    void SendResolverChanged();
 }
 
 #endif /* TemporaryImplementations_Cpp_hpp */
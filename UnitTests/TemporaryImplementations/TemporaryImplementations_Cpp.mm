@@ -20,3 +20,464 @@
 
 #include "TemporaryImplementations_Cpp.hpp"
 
+#include "pxr/base/work/loops.h"
+#include "pxr/usd/ar/notice.h"
+#include "pxr/usd/sdf/fileFormat.h"
+#include "pxr/usd/sdf/primSpec.h"
+#include "pxr/usd/sdf/schema.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <streambuf>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define OVERLAY_HALF_NEON 1
+#elif defined(__F16C__)
+#include <immintrin.h>
+#define OVERLAY_HALF_F16C 1
+#endif
+
+// MARK: GfHalf_Vector
+
+namespace {
+    pxr::GfHalf* _allocateHalves(size_t count) {
+        if (count == 0) {
+            return nullptr;
+        }
+        return static_cast<pxr::GfHalf*>(::operator new(count * sizeof(pxr::GfHalf), std::align_val_t(Overlay::GfHalf_Vector::Alignment)));
+    }
+    
+    void _deallocateHalves(pxr::GfHalf* p) {
+        if (p) {
+            ::operator delete(p, std::align_val_t(Overlay::GfHalf_Vector::Alignment));
+        }
+    }
+}
+
+Overlay::GfHalf_Vector::GfHalf_Vector(const GfHalf_Vector& other) {
+    _data = _allocateHalves(other._size);
+    _size = other._size;
+    _capacity = other._size;
+    if (_size > 0) {
+        memcpy(_data, other._data, other.byteSize());
+    }
+}
+
+Overlay::GfHalf_Vector::GfHalf_Vector(GfHalf_Vector&& other) noexcept
+    : _data(std::exchange(other._data, nullptr)),
+      _size(std::exchange(other._size, 0)),
+      _capacity(std::exchange(other._capacity, 0)) {}
+
+Overlay::GfHalf_Vector& Overlay::GfHalf_Vector::operator=(const GfHalf_Vector& other) {
+    if (this != &other) {
+        resize(other._size);
+        if (_size > 0) {
+            memcpy(_data, other._data, other.byteSize());
+        }
+    }
+    return *this;
+}
+
+Overlay::GfHalf_Vector& Overlay::GfHalf_Vector::operator=(GfHalf_Vector&& other) noexcept {
+    if (this != &other) {
+        _deallocateHalves(_data);
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+        _capacity = std::exchange(other._capacity, 0);
+    }
+    return *this;
+}
+
+Overlay::GfHalf_Vector::~GfHalf_Vector() {
+    _deallocateHalves(_data);
+}
+
+void Overlay::GfHalf_Vector::resize(size_t count) {
+    if (count > _capacity) {
+        // Callers overwrite the whole buffer (e.g. with a texture readback),
+        // so there's no need to copy the old contents over
+        _deallocateHalves(_data);
+        _data = _allocateHalves(count);
+        _capacity = count;
+    }
+    _size = count;
+}
+
+void Overlay::GfHalf_Vector::resizeBytes(size_t byteCount) {
+    resize((byteCount + sizeof(pxr::GfHalf) - 1) / sizeof(pxr::GfHalf));
+}
+
+// MARK: Half/float conversion
+
+namespace {
+    // Elements per WorkParallelForN task. Small buffers stay on the calling thread
+    constexpr size_t _conversionGrainSize = 1 << 16;
+    
+    void _convertHalfToFloatSerial(const pxr::GfHalf* src, float* dst, size_t count) {
+        size_t i = 0;
+#if OVERLAY_HALF_NEON
+        for (; i + 8 <= count; i += 8) {
+            float16x8_t h = vreinterpretq_f16_u16(vld1q_u16(reinterpret_cast<const uint16_t*>(src + i)));
+            vst1q_f32(dst + i, vcvt_f32_f16(vget_low_f16(h)));
+            vst1q_f32(dst + i + 4, vcvt_high_f32_f16(h));
+        }
+#elif OVERLAY_HALF_F16C
+        for (; i + 8 <= count; i += 8) {
+            __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+        }
+#endif
+        for (; i < count; i++) {
+            dst[i] = float(src[i]);
+        }
+    }
+    
+    void _convertFloatToHalfSerial(const float* src, pxr::GfHalf* dst, size_t count) {
+        size_t i = 0;
+#if OVERLAY_HALF_NEON
+        for (; i + 8 <= count; i += 8) {
+            float16x8_t h = vcvt_high_f16_f32(vcvt_f16_f32(vld1q_f32(src + i)), vld1q_f32(src + i + 4));
+            vst1q_u16(reinterpret_cast<uint16_t*>(dst + i), vreinterpretq_u16_f16(h));
+        }
+#elif OVERLAY_HALF_F16C
+        for (; i + 8 <= count; i += 8) {
+            __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+        }
+#endif
+        for (; i < count; i++) {
+            dst[i] = pxr::GfHalf(src[i]);
+        }
+    }
+    
+    template <typename Src, typename Dst, typename Kernel>
+    void _convertParallel(const Src* src, Dst* dst, size_t count, Kernel kernel) {
+        size_t chunkCount = (count + _conversionGrainSize - 1) / _conversionGrainSize;
+        if (chunkCount <= 1) {
+            kernel(src, dst, count);
+            return;
+        }
+        pxr::WorkParallelForN(chunkCount, [&](size_t begin, size_t end) {
+            for (size_t chunk = begin; chunk < end; chunk++) {
+                size_t offset = chunk * _conversionGrainSize;
+                kernel(src + offset, dst + offset, std::min(_conversionGrainSize, count - offset));
+            }
+        });
+    }
+}
+
+void Overlay::ConvertHalfToFloat(const pxr::GfHalf* src, float* dst, size_t count) {
+    _convertParallel(src, dst, count, _convertHalfToFloatSerial);
+}
+
+void Overlay::ConvertFloatToHalf(const float* src, pxr::GfHalf* dst, size_t count) {
+    _convertParallel(src, dst, count, _convertFloatToHalfSerial);
+}
+
+double Overlay::MeanSquaredDifference(const pxr::GfHalf* lhs, const pxr::GfHalf* rhs, size_t count) {
+    if (count == 0) {
+        return 0;
+    }
+    
+    std::mutex mutex;
+    double sum = 0;
+    size_t chunkCount = (count + _conversionGrainSize - 1) / _conversionGrainSize;
+    pxr::WorkParallelForN(chunkCount, [&](size_t begin, size_t end) {
+        float l[256];
+        float r[256];
+        double localSum = 0;
+        for (size_t i = begin * _conversionGrainSize; i < std::min(end * _conversionGrainSize, count); i += 256) {
+            size_t n = std::min<size_t>(256, count - i);
+            _convertHalfToFloatSerial(lhs + i, l, n);
+            _convertHalfToFloatSerial(rhs + i, r, n);
+            for (size_t j = 0; j < n; j++) {
+                double d = double(l[j]) - double(r[j]);
+                localSum += d * d;
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        sum += localSum;
+    });
+    return sum / double(count);
+}
+
+// MARK: Image diff
+
+namespace {
+    // Scans every pixel, splitting rows across threads. `classify(x, y, difference)` fills in
+    // the pixel's per-channel difference and returns whether the pixel is bad
+    template <typename Classify>
+    Overlay::ImageDiffResult _scanImageRGBA8(int width, int height, const Classify& classify) {
+        std::mutex mutex;
+        size_t badPixelCount = 0;
+        size_t firstBadIndex = std::numeric_limits<size_t>::max();
+        uint8_t maxBadDifference[4] = {0, 0, 0, 0};
+        
+        pxr::WorkParallelForN(height, [&](size_t begin, size_t end) {
+            size_t localBadPixelCount = 0;
+            size_t localFirstBadIndex = std::numeric_limits<size_t>::max();
+            uint8_t localMaxBadDifference[4] = {0, 0, 0, 0};
+            
+            for (size_t y = begin; y < end; y++) {
+                for (int x = 0; x < width; x++) {
+                    uint8_t difference[4];
+                    if (!classify(x, y, difference)) {
+                        continue;
+                    }
+                    localBadPixelCount += 1;
+                    localFirstBadIndex = std::min(localFirstBadIndex, y * width + x);
+                    for (int c = 0; c < 4; c++) {
+                        localMaxBadDifference[c] = std::max(localMaxBadDifference[c], difference[c]);
+                    }
+                }
+            }
+            
+            if (localBadPixelCount == 0) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            badPixelCount += localBadPixelCount;
+            firstBadIndex = std::min(firstBadIndex, localFirstBadIndex);
+            for (int c = 0; c < 4; c++) {
+                maxBadDifference[c] = std::max(maxBadDifference[c], localMaxBadDifference[c]);
+            }
+        }, 16);
+        
+        Overlay::ImageDiffResult result;
+        result.badPixelCount = badPixelCount;
+        result.firstBadX = badPixelCount > 0 ? int(firstBadIndex % width) : -1;
+        result.firstBadY = badPixelCount > 0 ? int(firstBadIndex / width) : -1;
+        memcpy(result.maxBadDifference, maxBadDifference, sizeof(maxBadDifference));
+        return result;
+    }
+}
+
+Overlay::ImageDiffResult Overlay::DiffImagesRGBA8(const uint8_t* lhs, size_t lhsRowBytes,
+                                                  const uint8_t* rhs, size_t rhsRowBytes,
+                                                  int width, int height, ImageDiffTolerance tolerance) {
+    const uint8_t tolerances[4] = {tolerance.r, tolerance.g, tolerance.b, tolerance.a};
+    return _scanImageRGBA8(width, height, [&](int x, size_t y, uint8_t* difference) {
+        const uint8_t* l = lhs + y * lhsRowBytes + 4 * x;
+        const uint8_t* r = rhs + y * rhsRowBytes + 4 * x;
+        bool isBad = false;
+        for (int c = 0; c < 4; c++) {
+            difference[c] = uint8_t(l[c] > r[c] ? l[c] - r[c] : r[c] - l[c]);
+            isBad |= difference[c] > tolerances[c];
+        }
+        return isBad;
+    });
+}
+
+Overlay::ImageDiffResult Overlay::CheckDifferenceImage(const uint8_t* difference, size_t byteCount, size_t rowBytes,
+                                                       size_t pixelStride, int width, int height) {
+    return _scanImageRGBA8(width, height, [&](int x, size_t y, uint8_t* channels) {
+        size_t offset = y * rowBytes + pixelStride * x;
+        if (offset + 4 > byteCount) {
+            memset(channels, 0, 4);
+            return false;
+        }
+        memcpy(channels, difference + offset, 4);
+        if (channels[3] != 255 && channels[3] != 0) {
+            return true;
+        }
+        return channels[0] >= 8 || channels[1] >= 8 || channels[2] >= 8;
+    });
+}
+
+// MARK: Streaming export
+
+namespace {
+    // Holds at most `bufferSize` bytes of exported text, and hands them to the sink when full
+    class _SinkBuffer : public std::streambuf {
+    public:
+        _SinkBuffer(Overlay::ExportSink sink, size_t bufferSize)
+            : _sink(sink), _buffer(std::max<size_t>(bufferSize, 1)) {
+            setp(_buffer.data(), _buffer.data() + _buffer.size());
+        }
+        
+    protected:
+        int_type overflow(int_type ch) override {
+            if (!_flush()) {
+                return traits_type::eof();
+            }
+            if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+                *pptr() = traits_type::to_char_type(ch);
+                pbump(1);
+            }
+            return traits_type::not_eof(ch);
+        }
+        
+        int sync() override {
+            return _flush() ? 0 : -1;
+        }
+        
+    private:
+        bool _flush() {
+            if (_stopped) {
+                return false;
+            }
+            size_t count = size_t(pptr() - pbase());
+            if (count > 0 && !_sink(pbase(), count)) {
+                _stopped = true;
+                return false;
+            }
+            setp(_buffer.data(), _buffer.data() + _buffer.size());
+            return true;
+        }
+        
+        Overlay::ExportSink _sink;
+        std::vector<char> _buffer;
+        bool _stopped = false;
+    };
+    
+    pxr::SdfFileFormatConstPtr _usdaFileFormat() {
+        return pxr::SdfFileFormat::FindById(pxr::TfToken("usda"));
+    }
+    
+    // Everything SdfLayer::ExportToString writes before the first root prim.
+    // Writing a copy of the layer metadata with no prims gives that, followed by the
+    // newline that ends the layer, which `_WriteLayer` writes itself after the root prims
+    bool _WriteLayerHeader(const pxr::SdfLayer& layer, std::ostream& out) {
+        const pxr::SdfPath& root = pxr::SdfPath::AbsoluteRootPath();
+        pxr::SdfLayerRefPtr header = pxr::SdfLayer::CreateAnonymous(".usda");
+        for (const pxr::TfToken& field : layer.ListFields(root)) {
+            if (field != pxr::SdfChildrenKeys->PrimChildren) {
+                header->SetField(root, field, layer.GetField(root, field));
+            }
+        }
+        
+        std::string text;
+        if (!header->ExportToString(&text) || text.empty() || text.back() != '\n') {
+            return false;
+        }
+        text.pop_back();
+        out << text;
+        // Metadata first, before anything else gets written
+        out.flush();
+        return bool(out);
+    }
+    
+    bool _WriteRootPrim(const pxr::SdfPrimSpecHandle& prim, std::ostream& out) {
+        out << "\n";
+        if (!_usdaFileFormat()->WriteToStream(prim, out, 0)) {
+            return false;
+        }
+        out.flush();
+        return bool(out);
+    }
+    
+    bool _WriteLayer(const pxr::SdfLayer& layer, std::ostream& out) {
+        if (!_WriteLayerHeader(layer, out)) {
+            return false;
+        }
+        for (const pxr::SdfPrimSpecHandle& prim : layer.GetRootPrims()) {
+            if (!_WriteRootPrim(prim, out)) {
+                return false;
+            }
+        }
+        out << "\n";
+        out.flush();
+        return bool(out);
+    }
+    
+    pxr::UsdStageRefPtr _OpenMasked(const pxr::UsdStage& stage, const pxr::UsdStagePopulationMask& mask) {
+        pxr::UsdStageRefPtr result = pxr::UsdStage::OpenMasked(stage.GetRootLayer(), stage.GetSessionLayer(),
+                                                               stage.GetPathResolverContext(), mask, pxr::UsdStage::LoadNone);
+        if (result) {
+            result->SetLoadRules(stage.GetLoadRules());
+            result->MuteAndUnmuteLayers(stage.GetMutedLayers(), {});
+        }
+        return result;
+    }
+    
+    bool _WriteStage(const pxr::UsdStage& stage, bool addSourceFileComment, std::ostream& out) {
+        if (!stage.GetPrototypes().empty()) {
+            pxr::SdfLayerRefPtr flattened = stage.Flatten(addSourceFileComment);
+            return flattened && _WriteLayer(*flattened, out);
+        }
+        
+        // Masked to nothing, the flattened stage only has the layer metadata
+        pxr::UsdStageRefPtr empty = _OpenMasked(stage, pxr::UsdStagePopulationMask());
+        pxr::SdfLayerRefPtr header = empty ? empty->Flatten(addSourceFileComment) : nullptr;
+        if (!header || !_WriteLayerHeader(*header, out)) {
+            return false;
+        }
+        empty = nullptr;
+        header = nullptr;
+        
+        // Same order as Flatten, which copies prims in traversal order. Each root's mask stays
+        // inside the stage's own mask, so a masked stage doesn't export prims it doesn't have
+        const pxr::UsdStagePopulationMask stageMask = stage.GetPopulationMask();
+        for (const pxr::UsdPrim& prim : stage.GetPseudoRoot().GetAllChildren()) {
+            pxr::UsdStagePopulationMask mask = pxr::UsdStagePopulationMask::Intersection(
+                stageMask, pxr::UsdStagePopulationMask().Add(prim.GetPath()));
+            pxr::UsdStageRefPtr masked = _OpenMasked(stage, mask);
+            pxr::SdfLayerRefPtr flattened = masked ? masked->Flatten(false) : nullptr;
+            pxr::SdfPrimSpecHandle spec = flattened ? flattened->GetPrimAtPath(prim.GetPath()) : pxr::SdfPrimSpecHandle();
+            if (!spec || !_WriteRootPrim(spec, out)) {
+                return false;
+            }
+        }
+        out << "\n";
+        out.flush();
+        return bool(out);
+    }
+    
+    Overlay::ExportSink _FileDescriptorSink(int fd) {
+        return ^bool(const char* bytes, size_t count) {
+            while (count > 0) {
+                ssize_t written = write(fd, bytes, count);
+                if (written < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    return false;
+                }
+                bytes += written;
+                count -= size_t(written);
+            }
+            return true;
+        };
+    }
+}
+
+bool Overlay::ExportToSink(pxr::SdfLayer* layer, size_t bufferSize, ExportSink sink) {
+    if (!layer || !sink) {
+        return false;
+    }
+    _SinkBuffer buffer(sink, bufferSize);
+    std::ostream out(&buffer);
+    return _WriteLayer(*layer, out);
+}
+
+bool Overlay::ExportToSink(pxr::UsdStage* stage, bool addSourceFileComment, size_t bufferSize, ExportSink sink) {
+    if (!stage || !sink) {
+        return false;
+    }
+    _SinkBuffer buffer(sink, bufferSize);
+    std::ostream out(&buffer);
+    return _WriteStage(*stage, addSourceFileComment, out);
+}
+
+bool Overlay::ExportToFileDescriptor(pxr::SdfLayer* layer, size_t bufferSize, int fd) {
+    return ExportToSink(layer, bufferSize, _FileDescriptorSink(fd));
+}
+
+bool Overlay::ExportToFileDescriptor(pxr::UsdStage* stage, bool addSourceFileComment, size_t bufferSize, int fd) {
+    return ExportToSink(stage, addSourceFileComment, bufferSize, _FileDescriptorSink(fd));
+}
+
+// MARK: Resolver notices
+
+void Overlay::SendResolverChanged() {
+    pxr::ArNotice::ResolverChanged().Send();
+}
@@ -0,0 +1,365 @@
+//===----------------------------------------------------------------------===//
+// This source file is part of github.com/apple/SwiftUsd-Tests
+//
+// Copyright © 2025 Apple Inc. and the SwiftUsd-Tests project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import OpenUSD
+import Synchronization
+
+#if canImport(SwiftUsd_PXR_ENABLE_USD_IMAGING_SUPPORT)
+
+// Records many frames of a stage to images, like calling UsdAppUtilsFrameRecorder::Record
+// once per time code, but without leaving the renderer idle while each image is written.
+//
+// UsdAppUtilsFrameRecorder renders and writes in a single call, so this is adapted from
+// pxr/usdImaging/usdAppUtils/frameRecorder.cpp instead of wrapping it. The camera, lights,
+// and render params are set up the same way, and images are written through HioImage
+// from the same readback, so each image matches what Record would have written.
+// - Frames are rendered on the calling thread. Once a frame converges, its color AOV is
+//   read back into a staging buffer and handed to a Work thread that encodes and writes it,
+//   while the calling thread moves on to the next frame
+// - There are `maximumFramesInFlight` staging buffers. When all of them are waiting to be
+//   written, rendering waits for one to free up, which caps memory at that many frames
+// - `timing` reports how long each stage took for each frame, and how long rendering stalled
+//
+// A recorder is reused across calls, so the engine stays warm. Call it from one thread at a time.
+final class PipelinedFrameRecorder {
+    struct FrameTiming {
+        var timeCode: pxr.UsdTimeCode
+        // Computing the camera, and setting up the engine's camera, lights, and render params
+        var setup: Duration = .zero
+        // Rendering until converged
+        var render: Duration = .zero
+        // Waiting for a staging buffer, because every buffer was still being written
+        var wait: Duration = .zero
+        // Reading back the color AOV into a staging buffer
+        var readback: Duration = .zero
+        // Encoding and writing the image, on a Work thread
+        var write: Duration = .zero
+    }
+
+    struct Timing {
+        var frames: [FrameTiming] = []
+        // Wall-clock time for the whole call, including waiting for the last writes
+        var total: Duration = .zero
+        var peakFramesInFlight = 0
+
+        func sum(_ keyPath: KeyPath<FrameTiming, Duration>) -> Duration {
+            frames.reduce(.zero) { $0 + $1[keyPath: keyPath] }
+        }
+
+        var description: String {
+            func ms(_ d: Duration) -> String {
+                String(format: "%.1f", milliseconds(d))
+            }
+            return "\(frames.count) frames in \(ms(total)) ms: setup \(ms(sum(\.setup))) ms, render \(ms(sum(\.render))) ms, " +
+                   "wait \(ms(sum(\.wait))) ms, readback \(ms(sum(\.readback))) ms, write \(ms(sum(\.write))) ms, " +
+                   "peak \(peakFramesInFlight) frames in flight"
+        }
+    }
+
+    // A frame that has been read back and is waiting to be written
+    private final class StagingBuffer: @unchecked Sendable {
+        var pixels: [UInt8] = []
+        var width: Int32 = 0
+        var height: Int32 = 0
+        var format: pxr.HioFormat = .HioFormatInvalid
+    }
+
+    private struct WriteState {
+        var freeBuffers: [StagingBuffer]
+        var framesInFlight = 0
+        var peakFramesInFlight = 0
+        var writeDurations: [Int: Duration] = [:]
+        var failedPaths: [URL] = []
+    }
+
+    // Shared between the rendering thread and the writes of one `record` call
+    private final class Writes: Sendable {
+        let state: Mutex<WriteState>
+        // Counts free staging buffers, so rendering can block until a write finishes
+        let freeBufferCount: DispatchSemaphore
+        let group = DispatchGroup()
+
+        init(bufferCount: Int) {
+            state = Mutex(WriteState(freeBuffers: (0..<bufferCount).map { _ in StagingBuffer() }))
+            freeBufferCount = DispatchSemaphore(value: bufferCount)
+        }
+
+        func finish(_ buffer: StagingBuffer, update: (inout WriteState) -> () = { _ in }) {
+            state.withLock { state in
+                state.framesInFlight -= 1
+                state.freeBuffers.append(buffer)
+                update(&state)
+            }
+            freeBufferCount.signal()
+        }
+    }
+
+    // Same defaults as UsdAppUtilsFrameRecorder
+    var imageWidth = 960
+    var complexity: Float = 1
+    var colorCorrectionMode: pxr.TfToken = .HdxColorCorrectionTokens.disabled
+    var includedPurposes: pxr.TfTokenVector = [.UsdGeomTokens.default_, .UsdGeomTokens.proxy]
+    var domeLightVisibility = false
+    let cameraLightEnabled: Bool
+    let maximumFramesInFlight: Int
+
+    private(set) var timing = Timing()
+
+    private var hgi: Overlay.HgiWrapper!
+    private var engine: Overlay.UsdImagingGLEngineWrapper!
+
+    // Like `Overlay.UsdAppUtilsFrameRecorderWrapper(rendererPluginId, true, cameraLightEnabled)`.
+    // With a `maximumFramesInFlight` of 1, the next frame still renders while the last one is
+    // written, but its readback waits for that write to finish
+    init(rendererPluginId: pxr.TfToken = pxr.TfToken(), cameraLightEnabled: Bool = true, maximumFramesInFlight: Int = 3) {
+        precondition(maximumFramesInFlight > 0, "Must allow at least one frame in flight")
+        self.cameraLightEnabled = cameraLightEnabled
+        self.maximumFramesInFlight = maximumFramesInFlight
+
+        hgi = Overlay.HgiWrapper.CreatePlatformDefaultHgi()
+        let driver = pxr.HdDriver(name: .HgiTokens.renderDriver, driver: hgi.VtValueWrappingHgiRawPtr())
+        engine = Overlay.UsdImagingGLEngineWrapper("/", [], [], "/", driver, rendererPluginId, true, false, false, true)
+        // Disable presentation to avoid the need to create an OpenGL context
+        engine.SetEnablePresentation(false)
+        engine.SetRendererAov(.HdAovTokens.color)
+    }
+
+    deinit {
+        // Important: UsdImagingGLEngine requires its Hgi to
+        // be alive for the engine's lifetime
+        engine = nil
+        hgi = nil
+    }
+
+    // MARK: Recording
+
+    // Renders `stage` through `camera` at every time code in `timeCodes`, in order, and writes
+    // each frame to `outputImagePath(timeCode)`. If `camera` is invalid, a camera that frames
+    // the whole stage is computed for every frame, like Record does.
+    // Returns once every image is written, and returns false if any of them failed
+    @discardableResult
+    func record(_ stage: pxr.UsdStage, camera: pxr.UsdGeomCamera, timeCodes: some Sequence<pxr.UsdTimeCode>,
+                outputImagePath: (pxr.UsdTimeCode) -> URL) -> Bool {
+        let clock = ContinuousClock()
+        let start = clock.now
+        let writes = Writes(bufferCount: maximumFramesInFlight)
+        var frames = [FrameTiming]()
+        var renderSucceeded = true
+
+        for (index, timeCode) in timeCodes.enumerated() {
+            var frame = FrameTiming(timeCode: timeCode)
+            let setupStart = clock.now
+            let renderParams = prepare(stage, camera: camera, timeCode: timeCode)
+
+            let renderStart = clock.now
+            repeat {
+                engine.Render(stage.GetPseudoRoot(), renderParams)
+            } while !engine.IsConverged()
+
+            let waitStart = clock.now
+            writes.freeBufferCount.wait()
+            let buffer = writes.state.withLock { state in
+                state.framesInFlight += 1
+                state.peakFramesInFlight = max(state.peakFramesInFlight, state.framesInFlight)
+                return state.freeBuffers.removeLast()
+            }
+
+            let readbackStart = clock.now
+            let didRead = readback(into: buffer)
+            let readbackEnd = clock.now
+            frame.setup = renderStart - setupStart
+            frame.render = waitStart - renderStart
+            frame.wait = readbackStart - waitStart
+            frame.readback = readbackEnd - readbackStart
+            frames.append(frame)
+
+            guard didRead else {
+                renderSucceeded = false
+                writes.finish(buffer)
+                continue
+            }
+
+            let dest = outputImagePath(timeCode)
+            writes.group.enter()
+            pxr.WorkRunDetachedTask {
+                let writeStart = ContinuousClock.now
+                let didWrite = Self.write(buffer, to: dest)
+                let writeDuration = ContinuousClock.now - writeStart
+                writes.finish(buffer) { state in
+                    state.writeDurations[index] = writeDuration
+                    if !didWrite {
+                        state.failedPaths.append(dest)
+                    }
+                }
+                writes.group.leave()
+            }
+        }
+        writes.group.wait()
+
+        let finished = writes.state.withLock { $0 }
+        for (index, duration) in finished.writeDurations {
+            frames[index].write = duration
+        }
+        for path in finished.failedPaths {
+            TF_RUNTIME_ERROR(std.string("Failed to write image to \(path)"))
+        }
+        timing = Timing(frames: frames, total: clock.now - start, peakFramesInFlight: finished.peakFramesInFlight)
+        return renderSucceeded && finished.failedPaths.isEmpty
+    }
+
+    // Records every time code from `start` through `end`, `stride` apart
+    @discardableResult
+    func record(_ stage: pxr.UsdStage, camera: pxr.UsdGeomCamera, from start: Double, through end: Double, by stride: Double = 1,
+                outputImagePath: (pxr.UsdTimeCode) -> URL) -> Bool {
+        record(stage, camera: camera, timeCodes: Swift.stride(from: start, through: end, by: stride).lazy.map { pxr.UsdTimeCode($0) },
+               outputImagePath: outputImagePath)
+    }
+
+    // MARK: Rendering
+
+    // Matches the setup at the start of UsdAppUtilsFrameRecorder::Record
+    private func prepare(_ stage: pxr.UsdStage, camera: pxr.UsdGeomCamera, timeCode: pxr.UsdTimeCode) -> pxr.UsdImagingGLRenderParams {
+        let gfCamera = camera.GetPrim().IsValid() ? camera.GetCamera(timeCode) : cameraToFrameStage(stage, timeCode)
+        var aspectRatio = gfCamera.GetAspectRatio()
+        if abs(aspectRatio) < 1e-4 {
+            aspectRatio = 1
+        }
+        let imageHeight = max(Int(Float(imageWidth) / aspectRatio), 1)
+        let renderResolution = pxr.GfVec2i(Int32(imageWidth), Int32(imageHeight))
+
+        let frustum = gfCamera.GetFrustum()
+        let cameraPos = frustum.GetPosition()
+
+        var framing = pxr.CameraUtilFraming()
+        framing.displayWindow = pxr.GfRange2f(pxr.GfVec2f(0), pxr.GfVec2f(renderResolution))
+        framing.dataWindow = pxr.GfRect2i(pxr.GfVec2i(0), renderResolution - pxr.GfVec2i(1))
+        framing.pixelAspectRatio = 1
+
+        engine.SetRenderBufferSize(renderResolution)
+        engine.SetFraming(framing)
+        engine.SetCameraState(frustum.ComputeViewMatrix(), frustum.ComputeProjectionMatrix())
+
+        let sceneAmbient = pxr.GfVec4f(0.01, 0.01, 0.01, 1)
+        var lights = pxr.GlfSimpleLightVector()
+        if cameraLightEnabled {
+            var cameraLight = pxr.GlfSimpleLight(pxr.GfVec4f(Float(cameraPos[0]), Float(cameraPos[1]), Float(cameraPos[2]), 1))
+            cameraLight.SetAmbient(sceneAmbient)
+            lights.push_back(cameraLight)
+        }
+        // Matches usdview's defaults
+        var material = pxr.GlfSimpleMaterial()
+        material.SetAmbient(pxr.GfVec4f(0.2, 0.2, 0.2, 1))
+        material.SetSpecular(pxr.GfVec4f(0.1, 0.1, 0.1, 1))
+        material.SetShininess(32)
+        engine.SetLightingState(lights, material, sceneAmbient)
+        engine.SetRendererSetting(.HdRenderSettingsTokens.domeLightCameraVisibility, pxr.VtValue(domeLightVisibility))
+
+        var renderParams = pxr.UsdImagingGLRenderParams()
+        renderParams.frame = timeCode
+        renderParams.complexity = complexity
+        renderParams.colorCorrectionMode = colorCorrectionMode
+        renderParams.clearColor = pxr.GfVec4f(0, 0, 0, 0)
+        renderParams.showProxy = includedPurposes.contains(.UsdGeomTokens.proxy)
+        renderParams.showRender = includedPurposes.contains(.UsdGeomTokens.render)
+        renderParams.showGuides = includedPurposes.contains(.UsdGeomTokens.guide)
+        for plane in gfCamera.GetClippingPlanes() {
+            renderParams.clipPlanes.push_back(pxr.GfVec4d(plane))
+        }
+        return renderParams
+    }
+
+    // Same as _ComputeCameraToFrameStage in frameRecorder.cpp: a default 50mm perspective
+    // camera, backed up along the stage's front axis until the stage's bounds fill the frame
+    private func cameraToFrameStage(_ stage: pxr.UsdStage, _ timeCode: pxr.UsdTimeCode) -> pxr.GfCamera {
+        var gfCamera = pxr.GfCamera()
+        var bboxCache = pxr.UsdGeomBBoxCache(timeCode, includedPurposes, true, false)
+        let bbox = bboxCache.ComputeWorldBound(stage.GetPseudoRoot())
+        let center = bbox.ComputeCentroid()
+        let dim = bbox.ComputeAlignedRange().GetSize()
+        let isYUp = pxr.UsdGeomGetStageUpAxis(Overlay.TfWeakPtr(stage)) == .UsdGeomTokens.y
+
+        // Find the corner of the bounds in the focal plane
+        let planeCorner = isYUp ? pxr.GfVec2d(dim[0] / 2, dim[1] / 2) : pxr.GfVec2d(dim[0] / 2, dim[2] / 2)
+        let planeRadius = Float(planeCorner.GetLength())
+
+        // Compute the distance to the focal plane, then back up to frame the front face of the bounds.
+        // Done in Float like the C++, so the camera ends up in exactly the same place
+        let halfFov = gfCamera.GetFieldOfView(.FOVHorizontal) / 2
+        var distance = Float(Double(planeRadius) / tan(pxr.GfDegreesToRadians(Double(halfFov))))
+        distance = Float(Double(distance) + (isYUp ? dim[2] : dim[1]) / 2)
+
+        var xf = pxr.GfMatrix4d(1.0)
+        if isYUp {
+            _ = xf.SetTranslate(center + pxr.GfVec3d(0, 0, Double(distance)))
+        } else {
+            _ = xf.SetRotate(pxr.GfRotation(pxr.GfVec3d(1, 0, 0), 90))
+            _ = xf.SetTranslateOnly(center + pxr.GfVec3d(0, -Double(distance), 0))
+        }
+        gfCamera.SetTransform(xf)
+        return gfCamera
+    }
+
+    // MARK: Writing
+
+    // Copies the color AOV into `buffer`. Adapted from TextureBufferWriter in frameRecorder.cpp
+    private func readback(into buffer: StagingBuffer) -> Bool {
+        let colorTextureHandle = engine.GetAovTexture(.HdAovTokens.color)
+        guard colorTextureHandle.__convertToBool() else {
+            TF_CODING_ERROR("No color texture to write out.")
+            return false
+        }
+        let descriptor = Overlay.GetDescriptor(colorTextureHandle)
+        buffer.width = descriptor.dimensions[0]
+        buffer.height = descriptor.dimensions[1]
+        buffer.format = pxr.HdxGetHioFormat(descriptor.format)
+
+        var size = 0
+        // Readback into an aligned buffer, then copy into the staging buffer,
+        // which is only reallocated when the frame size changes
+        let alignedBuffer = pxr.HdStTextureUtils.HgiTextureReadback(hgi.__getUnsafe(), colorTextureHandle, &size)
+        let dataByteSize = Int(buffer.width) * Int(buffer.height) * pxr.HioGetDataSizeOfFormat(buffer.format)
+        if buffer.pixels.count != dataByteSize {
+            buffer.pixels = [UInt8](repeating: 0, count: dataByteSize)
+        }
+        let copySrc = UnsafeRawPointer(alignedBuffer.__getUnsafe()!)
+        buffer.pixels.withUnsafeMutableBytes { copyDest in
+            copyDest.baseAddress!.copyMemory(from: copySrc, byteCount: dataByteSize)
+        }
+        return true
+    }
+
+    private static func write(_ buffer: StagingBuffer, to dest: URL) -> Bool {
+        var storage = Overlay.HioImageWrapper.StorageSpec()
+        storage.width = buffer.width
+        storage.height = buffer.height
+        storage.format = buffer.format
+        storage.flipped = true
+
+        var image = Overlay.HioImageWrapper.OpenForWriting(std.string(dest.absoluteURL.relativePath))
+        guard Bool(image) else { return false }
+        return buffer.pixels.withUnsafeMutableBytes { pixels in
+            storage.data = pixels.baseAddress
+            return image.Write(storage, .init())
+        }
+    }
+}
+
+#endif // #if canImport(SwiftUsd_PXR_ENABLE_USD_IMAGING_SUPPORT)
@@ -44,3 +44,113 @@ extension Overlay.String_Set: CxxSequence {}
 
 extension Overlay.UsdRelationship_Vector: CxxSequence {}
 extension Overlay.UsdProperty_Vector: CxxSequence {}
+
+
+// MARK: Contiguous VtArray storage
+// VtArray's Sequence conformance reads one element per C++ call, which dominates
+// loops over large points, normals, and primvar arrays. VtArray stores its elements
+// contiguously, so expose that storage directly, the way Swift.Array does.
+//
+// Reading never copies. Mutable access calls the non-const `data()` once,
+// which detaches the storage if it's shared with another VtArray (copy-on-write),
+// and then hands out a pointer that stays valid for the whole closure.
+//
+// Generic code that only knows about Sequence still goes through the framework's
+// conformance, so call these on concrete VtArray types.
+protocol VtArrayContiguousStorage: Sequence {
+    init()
+    func size() -> Int
+    func __cdataUnsafe() -> UnsafePointer<Element>!
+    mutating func __dataMutatingUnsafe() -> UnsafeMutablePointer<Element>!
+    mutating func resize(_ newSize: Int)
+}
+
+extension VtArrayContiguousStorage {
+    func withUnsafeBufferPointer<R>(_ body: (UnsafeBufferPointer<Element>) throws -> R) rethrows -> R {
+        let count = size()
+        // Empty arrays may not have storage
+        return try body(UnsafeBufferPointer(start: count == 0 ? nil : __cdataUnsafe(), count: count))
+    }
+
+    func withContiguousStorageIfAvailable<R>(_ body: (UnsafeBufferPointer<Element>) throws -> R) rethrows -> R? {
+        try withUnsafeBufferPointer(body)
+    }
+
+    mutating func withUnsafeMutableBufferPointer<R>(_ body: (inout UnsafeMutableBufferPointer<Element>) throws -> R) rethrows -> R {
+        let count = size()
+        var buffer = UnsafeMutableBufferPointer(start: count == 0 ? nil : __dataMutatingUnsafe(), count: count)
+        let start = buffer.baseAddress
+        defer { precondition(buffer.baseAddress == start && buffer.count == count, "VtArray buffer must not be replaced") }
+        return try body(&buffer)
+    }
+
+    mutating func withContiguousMutableStorageIfAvailable<R>(_ body: (inout UnsafeMutableBufferPointer<Element>) throws -> R) rethrows -> R? {
+        try withUnsafeMutableBufferPointer(body)
+    }
+
+    // Copies `buffer` with one bulk copy instead of appending one element at a time
+    init(_ buffer: UnsafeBufferPointer<Element>) {
+        self.init(count: buffer.count) {
+            _ = $0.update(fromContentsOf: buffer)
+        }
+    }
+
+    init<C: Collection>(contiguous elements: C) where C.Element == Element {
+        self = elements.withContiguousStorageIfAvailable { Self($0) }
+            ?? Array(elements).withUnsafeBufferPointer { Self($0) }
+    }
+
+    // Sizes the array to `count` elements and lets `body` update them in place.
+    // VtArray value-initializes the elements first, so `body` may leave some as they are
+    init(count: Int, updatingWith body: (inout UnsafeMutableBufferPointer<Element>) throws -> ()) rethrows {
+        self.init()
+        resize(count)
+        try withUnsafeMutableBufferPointer(body)
+    }
+}
+
+extension pxr.VtBoolArray: VtArrayContiguousStorage {}
+extension pxr.VtCharArray: VtArrayContiguousStorage {}
+extension pxr.VtUCharArray: VtArrayContiguousStorage {}
+extension pxr.VtShortArray: VtArrayContiguousStorage {}
+extension pxr.VtUShortArray: VtArrayContiguousStorage {}
+extension pxr.VtIntArray: VtArrayContiguousStorage {}
+extension pxr.VtUIntArray: VtArrayContiguousStorage {}
+extension pxr.VtInt64Array: VtArrayContiguousStorage {}
+extension pxr.VtUInt64Array: VtArrayContiguousStorage {}
+extension pxr.VtHalfArray: VtArrayContiguousStorage {}
+extension pxr.VtFloatArray: VtArrayContiguousStorage {}
+extension pxr.VtDoubleArray: VtArrayContiguousStorage {}
+extension pxr.VtStringArray: VtArrayContiguousStorage {}
+extension pxr.VtTokenArray: VtArrayContiguousStorage {}
+extension pxr.VtMatrix2dArray: VtArrayContiguousStorage {}
+extension pxr.VtMatrix2fArray: VtArrayContiguousStorage {}
+extension pxr.VtMatrix3dArray: VtArrayContiguousStorage {}
+extension pxr.VtMatrix3fArray: VtArrayContiguousStorage {}
+extension pxr.VtMatrix4dArray: VtArrayContiguousStorage {}
+extension pxr.VtMatrix4fArray: VtArrayContiguousStorage {}
+extension pxr.VtQuatdArray: VtArrayContiguousStorage {}
+extension pxr.VtQuatfArray: VtArrayContiguousStorage {}
+extension pxr.VtQuathArray: VtArrayContiguousStorage {}
+extension pxr.VtQuaternionArray: VtArrayContiguousStorage {}
+extension pxr.VtVec2dArray: VtArrayContiguousStorage {}
+extension pxr.VtVec2fArray: VtArrayContiguousStorage {}
+extension pxr.VtVec2hArray: VtArrayContiguousStorage {}
+extension pxr.VtVec2iArray: VtArrayContiguousStorage {}
+extension pxr.VtVec3dArray: VtArrayContiguousStorage {}
+extension pxr.VtVec3fArray: VtArrayContiguousStorage {}
+extension pxr.VtVec3hArray: VtArrayContiguousStorage {}
+extension pxr.VtVec3iArray: VtArrayContiguousStorage {}
+extension pxr.VtVec4dArray: VtArrayContiguousStorage {}
+extension pxr.VtVec4fArray: VtArrayContiguousStorage {}
+extension pxr.VtVec4hArray: VtArrayContiguousStorage {}
+extension pxr.VtVec4iArray: VtArrayContiguousStorage {}
+extension pxr.VtIntervalArray: VtArrayContiguousStorage {}
+extension pxr.VtRange1dArray: VtArrayContiguousStorage {}
+extension pxr.VtRange1fArray: VtArrayContiguousStorage {}
+extension pxr.VtRange2dArray: VtArrayContiguousStorage {}
+extension pxr.VtRange2fArray: VtArrayContiguousStorage {}
+extension pxr.VtRange3dArray: VtArrayContiguousStorage {}
+extension pxr.VtRange3fArray: VtArrayContiguousStorage {}
+extension pxr.VtRect2iArray: VtArrayContiguousStorage {}
+extension Overlay.SdfAssetPath_VtArray: VtArrayContiguousStorage {}
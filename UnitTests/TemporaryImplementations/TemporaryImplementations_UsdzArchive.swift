@@ -0,0 +1,273 @@
+//===----------------------------------------------------------------------===//
+// This source file is part of github.com/apple/SwiftUsd-Tests
+//
+// Copyright © 2025 Apple Inc. and the SwiftUsd-Tests project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import OpenUSD
+import Synchronization
+
+// Zero-copy access to the entries of a .usdz package.
+//
+// UsdZipFile reads the archive through ArAsset::GetBuffer, which memory-maps the file,
+// and usdz entries are always stored uncompressed, so every entry's bytes are already
+// sitting in the mapping. `UsdzArchive.Entry.bytes` is a read-only view of them:
+// enumerating, hashing, or handing an entry to a decoder never copies it to the heap.
+// Views stay valid as long as the Entry (or the archive it came from) is alive, and the
+// package isn't modified in place. Replacing the file, the way UsdZipFileWriter and atomic
+// writes do, leaves the mapping of the old file intact. Truncating or rewriting the same file
+// changes the bytes under existing views, and reading past a truncated end crashes.
+//
+// `map` and `extractAll(to:)` process entries in parallel on Work's threads, and
+// `UsdzArchiveCache` keeps archives mapped across stage opens, so repeatedly opening the
+// same package only costs a stat.
+final class UsdzArchive: @unchecked Sendable {
+    struct Entry: @unchecked Sendable {
+        let name: String
+        let info: pxr.UsdZipFile.FileInfo
+        // Points into the archive's mapping, which `archive` keeps alive. Only valid while
+        // the package isn't rewritten in place
+        let bytes: UnsafeRawBufferPointer
+        let archive: UsdzArchive
+    }
+
+    let path: String
+    // Holds the mapped buffer alive
+    private let zipFile: pxr.UsdZipFile
+    // Entries without the back reference to `self`, which would be a retain cycle
+    private let storage: [(name: String, info: pxr.UsdZipFile.FileInfo, bytes: UnsafeRawBufferPointer)]
+    private let entryIndices: [String: Int]
+
+    // Returns nil if the archive can't be opened, or if an entry is compressed or encrypted,
+    // which isn't allowed in a usdz package
+    init?(path: String) {
+        let zipFile = pxr.UsdZipFile.Open(std.string(path))
+        guard Bool(zipFile) else { return nil }
+
+        var storage = [(name: String, info: pxr.UsdZipFile.FileInfo, bytes: UnsafeRawBufferPointer)]()
+        for file in zipFile {
+            let info = file.GetFileInfo()
+            guard info.compressionMethod == 0, !info.encrypted, let start = file.GetFile() else { return nil }
+            storage.append((name: String(file.pointee), info: info, bytes: UnsafeRawBufferPointer(start: start, count: Int(info.size))))
+        }
+        self.path = path
+        self.zipFile = zipFile
+        self.storage = storage
+        self.entryIndices = Dictionary(storage.enumerated().map { ($1.name, $0) }, uniquingKeysWith: { first, _ in first })
+    }
+
+    var entries: [Entry] {
+        storage.indices.map(entry(at:))
+    }
+
+    subscript(name: String) -> Entry? {
+        entryIndices[name].map(entry(at:))
+    }
+
+    private func entry(at index: Int) -> Entry {
+        let (name, info, bytes) = storage[index]
+        return Entry(name: name, info: info, bytes: bytes, archive: self)
+    }
+
+    var totalByteCount: Int {
+        storage.reduce(0) { $0 + $1.bytes.count }
+    }
+
+    // MARK: Batch operations
+
+    // Calls `transform` on every entry concurrently, and returns the results in entry order
+    func map<T>(_ transform: @Sendable (Entry) -> T) -> [T] {
+        // Each slot is written by exactly one thread, and read after all of them finish
+        nonisolated(unsafe) let results = UnsafeMutableBufferPointer<T?>.allocate(capacity: storage.count)
+        results.initialize(repeating: nil)
+        defer {
+            results.deinitialize()
+            results.deallocate()
+        }
+        let entries = entries
+        withoutActuallyEscaping(transform) { transform in
+            pxr.WorkParallelForN(entries.count) { begin, end in
+                for i in Int(begin)..<Int(end) {
+                    results[i] = transform(entries[i])
+                }
+            }
+        }
+        return results.map { $0! }
+    }
+
+    // CRC-32 of every entry's bytes, in entry order, computed in parallel.
+    // These are the same checksums the zip format stores in `info.crc`
+    func checksums() -> [UInt32] {
+        map { UsdzArchive.crc32($0.bytes) }
+    }
+
+    // Where the entry named `name` is extracted to under `directory`, or nil if it would land
+    // outside of it: absolute names, names with `..` components, and anything else
+    // that doesn't stay under `directory` once standardized
+    static func extractionURL(for name: String, in directory: URL) -> URL? {
+        let components = name.split(separator: "/", omittingEmptySubsequences: false)
+        guard !name.isEmpty, !name.hasPrefix("/"), !components.contains("..") else { return nil }
+        
+        let root = directory.standardizedFileURL
+        let url = root.appending(path: name, directoryHint: .notDirectory).standardizedFileURL
+        var rootPath = root.path(percentEncoded: false)
+        if !rootPath.hasSuffix("/") {
+            rootPath += "/"
+        }
+        guard url.path(percentEncoded: false).hasPrefix(rootPath) else { return nil }
+        return url
+    }
+
+    // Writes every entry under `directory`, in parallel, straight from the mapping.
+    // Nothing is written if any entry's name would put it outside of `directory`.
+    // Otherwise, throws the first error any entry hit, after all of them have been tried
+    func extractAll(to directory: URL) throws {
+        let urls = try storage.map { entry in
+            guard let url = Self.extractionURL(for: entry.name, in: directory) else {
+                throw CocoaError(.fileWriteInvalidFileName, userInfo: [NSFilePathErrorKey: entry.name])
+            }
+            return url
+        }
+        
+        let errors = map { entry -> (any Error)? in
+            do {
+                let url = urls[entryIndices[entry.name]!]
+                try FileManager.default.createDirectory(at: url.deletingLastPathComponent(), withIntermediateDirectories: true)
+                guard let base = entry.bytes.baseAddress, !entry.bytes.isEmpty else {
+                    try Data().write(to: url)
+                    return nil
+                }
+                try Data(bytesNoCopy: UnsafeMutableRawPointer(mutating: base), count: entry.bytes.count, deallocator: .none).write(to: url)
+                return nil
+            } catch {
+                return error
+            }
+        }
+        if let error = errors.lazy.compactMap({ $0 }).first {
+            throw error
+        }
+    }
+
+    // MARK: CRC-32
+
+    private static let crcTable: [UInt32] = (0..<256).map { n in
+        var c = UInt32(n)
+        for _ in 0..<8 {
+            c = c & 1 != 0 ? 0xEDB8_8320 ^ (c >> 1) : c >> 1
+        }
+        return c
+    }
+
+    static func crc32(_ bytes: UnsafeRawBufferPointer) -> UInt32 {
+        crcTable.withUnsafeBufferPointer { table in
+            var crc: UInt32 = 0xFFFF_FFFF
+            for byte in bytes {
+                crc = table[Int((crc ^ UInt32(byte)) & 0xFF)] ^ (crc >> 8)
+            }
+            return crc ^ 0xFFFF_FFFF
+        }
+    }
+}
+
+// Process-wide cache of mapped usdz archives, keyed by path.
+//
+// A lookup stats the file and reopens the archive if its size or modification date changed,
+// so a package rewritten on disk isn't served from a stale mapping. Archives live until they're
+// replaced, evicted, or the cache is cleared, independently of any stage that opened the same
+// package. Once more than `maximumArchiveCount` archives are cached, the least recently used
+// ones are dropped; entries and archives already handed out keep their mappings alive.
+final class UsdzArchiveCache: Sendable {
+    static let shared = UsdzArchiveCache(maximumArchiveCount: 64)
+
+    struct Statistics {
+        var hits = 0
+        var misses = 0
+        var evictions = 0
+    }
+
+    private struct Cached {
+        let archive: UsdzArchive
+        let size: Int
+        let modificationDate: Date
+        var lastUse: Int
+    }
+
+    private struct State {
+        var archives: [String: Cached] = [:]
+        var useCounter = 0
+        var statistics = Statistics()
+    }
+
+    let maximumArchiveCount: Int
+    private let state = Mutex<State>(State())
+
+    init(maximumArchiveCount: Int) {
+        precondition(maximumArchiveCount > 0, "The cache must hold at least one archive")
+        self.maximumArchiveCount = maximumArchiveCount
+    }
+
+    func archive(at path: String) -> UsdzArchive? {
+        let path = URL(filePath: path).standardizedFileURL.path(percentEncoded: false)
+        guard let attributes = try? FileManager.default.attributesOfItem(atPath: path),
+              let size = attributes[.size] as? Int,
+              let modificationDate = attributes[.modificationDate] as? Date else { return nil }
+
+        let cached = state.withLock { state -> UsdzArchive? in
+            guard var cached = state.archives[path], cached.size == size, cached.modificationDate == modificationDate else {
+                state.statistics.misses += 1
+                return nil
+            }
+            state.useCounter += 1
+            cached.lastUse = state.useCounter
+            state.archives[path] = cached
+            state.statistics.hits += 1
+            return cached.archive
+        }
+        if let cached { return cached }
+
+        // Opened outside the lock, so a slow open doesn't block lookups of other archives.
+        // If two threads race to open the same path, the last one wins, which is harmless
+        guard let archive = UsdzArchive(path: path) else { return nil }
+        state.withLock { state in
+            state.useCounter += 1
+            state.archives[path] = Cached(archive: archive, size: size, modificationDate: modificationDate, lastUse: state.useCounter)
+            evict(&state)
+        }
+        return archive
+    }
+
+    private func evict(_ state: inout State) {
+        while state.archives.count > maximumArchiveCount {
+            guard let victim = state.archives.min(by: { $0.value.lastUse < $1.value.lastUse }) else { return }
+            state.archives[victim.key] = nil
+            state.statistics.evictions += 1
+        }
+    }
+
+    var count: Int {
+        state.withLock { $0.archives.count }
+    }
+
+    var statistics: Statistics {
+        state.withLock { $0.statistics }
+    }
+
+    func removeAll() {
+        state.withLock { $0 = State() }
+    }
+}
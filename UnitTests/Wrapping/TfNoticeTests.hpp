@@ -24,6 +24,7 @@
 #include <stdio.h>
 #include "swiftUsd/swiftUsd.h"
 #include "pxr/base/tf/notice.h"
+#include <memory>
 #include <utility>
 
 namespace _xLanguage_TfNotice {
@@ -35,6 +36,130 @@ namespace _xLanguage_TfNotice {
     
     bool test_promoteCppKeyInCpp();
     std::pair<pxr::TfNotice::Key, int (^)()> test_promoteCppKeyInSwift();
+    
+    
+    class CoalescingListener;
+    
+    // Coalescing listeners defer their callback while a coalescing change block
+    // is open on the current thread, then fire once when the outermost block closes,
+    // with the number of notices that were merged into that callback.
+    // Outside of a block, every notice fires the callback with a count of 1.
+    //
+    // A registration owns its listener. Copies share it, and the listener is revoked
+    // and destroyed by Revoke(), or when the last copy is destroyed. Callbacks already
+    // queued for a closing scope are dropped, so none start after Revoke() returns.
+    // Scopes open on different threads at the same time are counted and flushed separately.
+    class CoalescingRegistration {
+    public:
+        CoalescingRegistration() = default;
+        
+        // Returns false if the listener was already revoked
+        bool Revoke();
+        bool IsValid() const;
+        
+    private:
+        friend CoalescingRegistration RegisterCoalescing(pxr::UsdStage*, void (^)(int));
+        std::shared_ptr<CoalescingListener> _listener;
+    };
+    
+    CoalescingRegistration RegisterCoalescing(pxr::UsdStage* stage, void (^callback)(int noticeCount));
+    
+    // Opens an SdfChangeBlock and a coalescing scope around `body`.
+    // Nested calls only flush coalesced callbacks when the outermost call returns.
+    void WithCoalescedChanges(void (^body)());
+    
+    // For coalescing listeners registered from Swift: whether a coalescing scope is open
+    // on the current thread, an identifier for the outermost one (unique for the process,
+    // 0 if none is open), and a way to run `flush` when it closes.
+    // `flush` runs immediately if no scope is open
+    bool IsCoalescing();
+    uint64_t CurrentCoalescingScope();
+    void FlushWhenCoalescingEnds(void (^flush)());
+    
+    // Sends UsdNotice::StageContentsChanged for `stage` without authoring anything,
+    // which Sdf doesn't batch the way it batches layer edits
+    void SendStageContentsChanged(pxr::UsdStage* stage);
+    
+    bool test_coalescingMergesChangeBlock();
+    bool test_coalescingNestedChangeBlocks();
+    
+    
+    // Tracks one batch handed to RevokeConcurrently. Copies share the same batch
+    class RevocationTicket {
+    public:
+        RevocationTicket() = default;
+        
+        // Blocks until every key in the batch is revoked
+        void Wait() const;
+        bool IsDone() const;
+        // From the RevokeConcurrently call until the batch was revoked. Waits for the batch
+        double LatencyMicroseconds() const;
+        
+        // Defined with the reclaimer that completes it
+        struct State;
+        
+    private:
+        friend RevocationTicket RevokeConcurrently(pxr::TfNotice::SwiftKeys*);
+        std::shared_ptr<State> _state;
+    };
+    
+    // Queues `keys` to be revoked on a Work thread, without making the calling thread wait.
+    // Queueing is a lock-free push, so callers on many threads don't wait on each other
+    // or on the notice registry. Revoking itself is not parallel: TfNotice::Revoke takes
+    // the registry's lock, so a single reclaimer revokes everything queued since its last
+    // pass in one call, and many small batches share one trip through the lock.
+    // `keys` is always empty on return. Listeners keep receiving notices until the ticket
+    // is done, so wait on it before destroying listeners that must not receive any more.
+    // Revoking no keys returns a ticket that's already done
+    RevocationTicket RevokeConcurrently(pxr::TfNotice::SwiftKeys* keys);
+    
+    // How many times RevokeConcurrently's reclaimer has called TfNotice::Revoke, for benchmarks
+    long long RevokeConcurrentlyRegistryCalls();
+    
+    bool test_revokeConcurrently();
+}
+
+namespace _xLanguage_TfNoticeBenchmarks {
+    struct DispatchResult {
+        int listenerCount;
+        int editCount;
+        bool coalesced;
+        long long callbackCount;
+        double seconds;
+        double noticesPerSecond;
+        double nsPerNoticeDelivery;
+        double nsPerCallback;
+    };
+    
+    // Registers `listenerCount` C++ listeners for UsdNotice::StageContentsChanged
+    // on one stage, either plain or coalescing, then times `editCount` edits inside one
+    // coalescing change block. Each edit calls SetStartTimeCode, which Sdf batches,
+    // and sends a StageContentsChanged directly, which it doesn't. Plain listeners get
+    // `editCount + 1` callbacks each, and coalescing listeners get one. Each callback
+    // traverses the stage's ten prims, the way a listener that refreshes a view would
+    DispatchResult stageContentsChangedDispatch(int listenerCount, int editCount, bool coalesced);
+    
+    struct RevocationResult {
+        int threadCount;
+        int keysPerThread;
+        bool concurrent;
+        bool allRevoked;
+        long long noticesDelivered;
+        // TfNotice::Revoke calls, each of which holds the registry's lock
+        long long registryRevokeCalls;
+        double seconds;
+        double revokesPerSecond;
+        double p50Microseconds;
+        double p99Microseconds;
+        double maxMicroseconds;
+    };
+    
+    // Each of `threadCount` threads registers `keysPerThread` listeners on one stage,
+    // then revokes them in small batches while another thread keeps authoring to that stage.
+    // Revocation uses either RevokeConcurrently or TfNotice::Revoke. Latencies are per batch,
+    // from handing the batch off until its keys are revoked. Both end up serialized on the
+    // registry's lock, so throughput shows what batching saves, not parallel revocation
+    RevocationResult revokeWhileNotifying(int threadCount, int keysPerThread, bool concurrent);
 }
 
 #endif /* TfNoticeTests_hpp */
@@ -24,6 +24,19 @@
 #include "pxr/base/tf/refPtr.h"
 #include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usd/notice.h"
+#include "pxr/usd/sdf/changeBlock.h"
+#include "pxr/base/work/detachedTask.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 bool _xLanguage_TfNotice::test_revokeOneCppKeyViaSwiftUsd() {
     bool testPasses = true;
@@ -232,3 +245,650 @@ std::pair<pxr::TfNotice::Key, int (^)()> _xLanguage_TfNotice::test_promoteCppKey
     
     return {l->key, ^int(){ return l->callbackCount; }};
 }
+
+
+// MARK: Coalescing
+
+namespace {
+    // Notices are delivered on the thread that sends them, so coalescing
+    // scopes only need to be tracked per thread
+    thread_local int t_coalescingDepth = 0;
+    thread_local std::vector<std::function<void()>> t_pendingFlushes;
+    // Identifies the outermost scope open on this thread, so notices from scopes on
+    // other threads are counted separately. 0 outside of any scope
+    thread_local uint64_t t_coalescingScope = 0;
+    std::atomic<uint64_t> g_nextCoalescingScope{1};
+}
+
+class _xLanguage_TfNotice::CoalescingListener: public pxr::TfWeakBase {
+public:
+    CoalescingListener(std::function<void(int)> callback) : _callback(std::move(callback)) {}
+    
+    ~CoalescingListener() {
+        Revoke();
+    }
+    
+    pxr::TfNotice::Key Register(const pxr::UsdStageWeakPtr& stage) {
+        _key = pxr::TfNotice::Register(pxr::TfCreateWeakPtr(this), &CoalescingListener::HandleCallback, stage);
+        return _key;
+    }
+    
+    // Flushes that are already queued for a closing scope are dropped too
+    bool Revoke() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isRevoked = true;
+            _pendingCounts.clear();
+        }
+        return _key.IsValid() && pxr::TfNotice::Revoke(_key);
+    }
+    
+    void HandleCallback(const pxr::UsdNotice::StageContentsChanged&) {
+        if (t_coalescingDepth == 0) {
+            _callback(1);
+            return;
+        }
+        // Scopes on different threads can be open at once, and each one flushes its own count
+        uint64_t scope = t_coalescingScope;
+        bool isFirst;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            isFirst = _pendingCounts[scope]++ == 0;
+        }
+        if (isFirst) {
+            // The listener may be destroyed before the scope closes
+            t_pendingFlushes.push_back([listener = pxr::TfCreateWeakPtr(this), scope]() {
+                if (listener) {
+                    listener->Flush(scope);
+                }
+            });
+        }
+    }
+    
+    void Flush(uint64_t scope) {
+        int count = 0;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _pendingCounts.find(scope);
+            if (_isRevoked || it == _pendingCounts.end()) {
+                return;
+            }
+            count = it->second;
+            _pendingCounts.erase(it);
+        }
+        if (count > 0) {
+            _callback(count);
+        }
+    }
+    
+private:
+    std::function<void(int)> _callback;
+    pxr::TfNotice::Key _key;
+    std::mutex _mutex;
+    std::unordered_map<uint64_t, int> _pendingCounts;
+    bool _isRevoked = false;
+};
+
+namespace {
+    using _xLanguage_TfNotice::CoalescingListener;
+    
+    class CoalescingScope {
+    public:
+        CoalescingScope() {
+            if (t_coalescingDepth == 0) {
+                t_coalescingScope = g_nextCoalescingScope.fetch_add(1, std::memory_order_relaxed);
+            }
+            t_coalescingDepth += 1;
+            _changeBlock.emplace();
+        }
+        
+        ~CoalescingScope() {
+            // Closing the change block is what sends the batched notices,
+            // so it has to happen while we're still coalescing
+            _changeBlock.reset();
+            t_coalescingDepth -= 1;
+            if (t_coalescingDepth > 0) {
+                return;
+            }
+            t_coalescingScope = 0;
+            // Callbacks may author more changes, so don't iterate the live vector
+            std::vector<std::function<void()>> pending;
+            pending.swap(t_pendingFlushes);
+            for (const auto& flush : pending) {
+                flush();
+            }
+        }
+        
+        CoalescingScope(const CoalescingScope&) = delete;
+        CoalescingScope& operator=(const CoalescingScope&) = delete;
+        
+    private:
+        std::optional<pxr::SdfChangeBlock> _changeBlock;
+    };
+}
+
+bool _xLanguage_TfNotice::CoalescingRegistration::Revoke() {
+    if (!_listener) {
+        return false;
+    }
+    bool result = _listener->Revoke();
+    _listener.reset();
+    return result;
+}
+
+bool _xLanguage_TfNotice::CoalescingRegistration::IsValid() const {
+    return _listener != nullptr;
+}
+
+_xLanguage_TfNotice::CoalescingRegistration _xLanguage_TfNotice::RegisterCoalescing(pxr::UsdStage* _stage, void (^callback)(int noticeCount)) {
+    auto stage = SwiftUsd::TakeFunctionParameterFromSwift<pxr::UsdStageRefPtr>(_stage);
+    
+    CoalescingRegistration result;
+    result._listener = std::make_shared<CoalescingListener>([callback](int noticeCount) { callback(noticeCount); });
+    result._listener->Register(stage);
+    return result;
+}
+
+void _xLanguage_TfNotice::WithCoalescedChanges(void (^body)()) {
+    CoalescingScope scope;
+    body();
+}
+
+bool _xLanguage_TfNotice::IsCoalescing() {
+    return t_coalescingDepth > 0;
+}
+
+uint64_t _xLanguage_TfNotice::CurrentCoalescingScope() {
+    return t_coalescingScope;
+}
+
+void _xLanguage_TfNotice::FlushWhenCoalescingEnds(void (^flush)()) {
+    if (t_coalescingDepth == 0) {
+        flush();
+        return;
+    }
+    t_pendingFlushes.push_back([flush]() { flush(); });
+}
+
+void _xLanguage_TfNotice::SendStageContentsChanged(pxr::UsdStage* _stage) {
+    auto stage = SwiftUsd::TakeFunctionParameterFromSwift<pxr::UsdStageRefPtr>(_stage);
+    pxr::UsdNotice::StageContentsChanged(stage).Send(pxr::UsdStageWeakPtr(stage));
+}
+
+bool _xLanguage_TfNotice::test_coalescingMergesChangeBlock() {
+    bool testPasses = true;
+    
+    auto stage = pxr::UsdStage::CreateInMemory();
+    int callbackCount = 0;
+    int noticeCount = 0;
+    CoalescingListener l([&](int n) {
+        callbackCount += 1;
+        noticeCount += n;
+    });
+    pxr::TfNotice::Key key = l.Register(stage);
+    
+    // Outside of a block, every notice is its own callback
+    stage->SetStartTimeCode(1);
+    testPasses &= callbackCount == 1;
+    testPasses &= noticeCount == 1;
+    stage->SetStartTimeCode(2);
+    testPasses &= callbackCount == 2;
+    testPasses &= noticeCount == 2;
+    
+    // Sdf batches authoring inside the block into one StageContentsChanged
+    {
+        CoalescingScope scope;
+        for (int i = 3; i < 100; i++) {
+            stage->SetStartTimeCode(i);
+        }
+        testPasses &= callbackCount == 2;
+    }
+    testPasses &= callbackCount == 3;
+    testPasses &= noticeCount == 3;
+    
+    // Notices sent directly aren't batched by Sdf, so the listener merges them
+    {
+        CoalescingScope scope;
+        for (int i = 0; i < 5; i++) {
+            pxr::UsdNotice::StageContentsChanged(stage).Send(pxr::UsdStageWeakPtr(stage));
+        }
+        testPasses &= callbackCount == 3;
+    }
+    testPasses &= callbackCount == 4;
+    testPasses &= noticeCount == 8;
+    
+    pxr::TfNotice::Revoke(key);
+    {
+        CoalescingScope scope;
+        stage->SetStartTimeCode(100);
+    }
+    testPasses &= callbackCount == 4;
+    testPasses &= noticeCount == 8;
+    
+    return testPasses;
+}
+
+bool _xLanguage_TfNotice::test_coalescingNestedChangeBlocks() {
+    bool testPasses = true;
+    
+    auto stage = pxr::UsdStage::CreateInMemory();
+    int callbackCount = 0;
+    int noticeCount = 0;
+    CoalescingListener l([&](int n) {
+        callbackCount += 1;
+        noticeCount += n;
+    });
+    pxr::TfNotice::Key key = l.Register(stage);
+    
+    {
+        CoalescingScope outer;
+        pxr::UsdNotice::StageContentsChanged(stage).Send(pxr::UsdStageWeakPtr(stage));
+        {
+            CoalescingScope inner;
+            pxr::UsdNotice::StageContentsChanged(stage).Send(pxr::UsdStageWeakPtr(stage));
+            stage->SetStartTimeCode(5);
+        }
+        // Closing the inner block doesn't flush
+        testPasses &= callbackCount == 0;
+        pxr::UsdNotice::StageContentsChanged(stage).Send(pxr::UsdStageWeakPtr(stage));
+        stage->SetStartTimeCode(6);
+    }
+    // Three sent notices, plus one for the batched Sdf changes
+    testPasses &= callbackCount == 1;
+    testPasses &= noticeCount == 4;
+    
+    pxr::TfNotice::Revoke(key);
+    return testPasses;
+}
+
+// MARK: Concurrent revocation
+
+struct _xLanguage_TfNotice::RevocationTicket::State {
+    // Written under g_revocationMutex before `isDone` is set
+    std::chrono::steady_clock::time_point enqueued;
+    std::chrono::steady_clock::time_point completed;
+    std::atomic<bool> isDone{false};
+};
+
+namespace {
+    using _xLanguage_TfNotice::RevocationTicket;
+    
+    struct PendingRevocation {
+        pxr::TfNotice::SwiftKeys keys;
+        std::shared_ptr<RevocationTicket::State> state;
+        PendingRevocation* next = nullptr;
+    };
+    
+    // Batches waiting for the reclaimer, newest first. Pushing is one compare-and-swap,
+    // so callers never wait on each other or on the notice registry
+    std::atomic<PendingRevocation*> g_pendingRevocations{nullptr};
+    std::atomic<bool> g_reclaimerScheduled{false};
+    std::atomic<long long> g_reclaimerRevokeCalls{0};
+    // Only for waking up tickets
+    std::mutex g_revocationMutex;
+    std::condition_variable g_revocationCondition;
+    
+    // TfNotice::Revoke serializes on the registry's lock no matter who calls it, so one
+    // reclaimer takes everything queued since its last pass and revokes it in a single call
+    void _ReclaimPendingRevocations() {
+        while (true) {
+            PendingRevocation* batch = g_pendingRevocations.exchange(nullptr, std::memory_order_acquire);
+            if (!batch) {
+                g_reclaimerScheduled.store(false, std::memory_order_seq_cst);
+                // A batch pushed after the exchange may have seen the reclaimer still scheduled
+                if (g_pendingRevocations.load(std::memory_order_seq_cst) == nullptr ||
+                    g_reclaimerScheduled.exchange(true, std::memory_order_seq_cst)) {
+                    return;
+                }
+                continue;
+            }
+            
+            std::vector<std::unique_ptr<PendingRevocation>> batches;
+            pxr::TfNotice::SwiftKeys keys;
+            for (; batch; batch = batch->next) {
+                batches.emplace_back(batch);
+                keys.insert(keys.end(), batch->keys.begin(), batch->keys.end());
+            }
+            pxr::TfNotice::Revoke(&keys);
+            g_reclaimerRevokeCalls.fetch_add(1, std::memory_order_relaxed);
+            
+            auto now = std::chrono::steady_clock::now();
+            {
+                std::lock_guard<std::mutex> lock(g_revocationMutex);
+                for (const auto& done : batches) {
+                    done->state->completed = now;
+                    done->state->isDone.store(true, std::memory_order_release);
+                }
+            }
+            g_revocationCondition.notify_all();
+        }
+    }
+}
+
+void _xLanguage_TfNotice::RevocationTicket::Wait() const {
+    if (!_state) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(g_revocationMutex);
+    g_revocationCondition.wait(lock, [this]() { return _state->isDone.load(std::memory_order_acquire); });
+}
+
+bool _xLanguage_TfNotice::RevocationTicket::IsDone() const {
+    return !_state || _state->isDone.load(std::memory_order_acquire);
+}
+
+double _xLanguage_TfNotice::RevocationTicket::LatencyMicroseconds() const {
+    Wait();
+    if (!_state) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(g_revocationMutex);
+    return std::chrono::duration<double, std::micro>(_state->completed - _state->enqueued).count();
+}
+
+_xLanguage_TfNotice::RevocationTicket _xLanguage_TfNotice::RevokeConcurrently(pxr::TfNotice::SwiftKeys* keys) {
+    RevocationTicket ticket;
+    if (keys->empty()) {
+        return ticket;
+    }
+    
+    auto state = std::make_shared<RevocationTicket::State>();
+    state->enqueued = std::chrono::steady_clock::now();
+    ticket._state = state;
+    
+    auto batch = new PendingRevocation{std::move(*keys), state};
+    keys->clear();
+    batch->next = g_pendingRevocations.load(std::memory_order_relaxed);
+    while (!g_pendingRevocations.compare_exchange_weak(batch->next, batch, std::memory_order_release, std::memory_order_relaxed)) {}
+    
+    if (!g_reclaimerScheduled.exchange(true, std::memory_order_seq_cst)) {
+        pxr::WorkRunDetachedTask(_ReclaimPendingRevocations);
+    }
+    return ticket;
+}
+
+long long _xLanguage_TfNotice::RevokeConcurrentlyRegistryCalls() {
+    return g_reclaimerRevokeCalls.load(std::memory_order_relaxed);
+}
+
+namespace {
+    struct AtomicCountingListener: public pxr::TfWeakBase {
+        AtomicCountingListener(const pxr::UsdStageWeakPtr& stage, std::atomic<long long>* counter) : counter(counter) {
+            cppKey = pxr::TfNotice::Register(pxr::TfCreateWeakPtr(this), &AtomicCountingListener::HandleCallback, stage);
+            key = cppKey;
+        }
+        
+        void HandleCallback(const pxr::UsdNotice::StageContentsChanged&) {
+            counter->fetch_add(1, std::memory_order_relaxed);
+        }
+        
+        pxr::TfNotice::SwiftKey key;
+        // Shares its registration with `key`, and stops being valid once `key` is revoked
+        pxr::TfNotice::Key cppKey;
+        std::atomic<long long>* counter;
+    };
+}
+
+bool _xLanguage_TfNotice::test_revokeConcurrently() {
+    bool testPasses = true;
+    
+    auto stage = pxr::UsdStage::CreateInMemory();
+    std::atomic<long long> callbackCount{0};
+    
+    // One thread
+    {
+        AtomicCountingListener l1(stage, &callbackCount);
+        AtomicCountingListener l2(stage, &callbackCount);
+        stage->SetStartTimeCode(1);
+        testPasses &= callbackCount == 2;
+        
+        pxr::TfNotice::SwiftKeys keys = {l1.key, l2.key};
+        RevocationTicket ticket = RevokeConcurrently(&keys);
+        testPasses &= keys.empty();
+        ticket.Wait();
+        testPasses &= ticket.IsDone();
+        
+        stage->SetStartTimeCode(2);
+        testPasses &= callbackCount == 2;
+    }
+    
+    // Many threads, each revoking their own listeners
+    {
+        callbackCount = 0;
+        const int threadCount = 8;
+        const int keysPerThread = 64;
+        std::vector<std::unique_ptr<AtomicCountingListener>> listeners;
+        for (int i = 0; i < threadCount * keysPerThread; i++) {
+            listeners.push_back(std::make_unique<AtomicCountingListener>(stage, &callbackCount));
+        }
+        stage->SetStartTimeCode(3);
+        testPasses &= callbackCount == threadCount * keysPerThread;
+        
+        // Each thread waits on its own tickets only, and checks that its own
+        // listeners are revoked once they're done, while other threads are still revoking
+        std::vector<std::thread> threads;
+        std::atomic<bool> allEmptied{true};
+        std::atomic<bool> allRevoked{true};
+        for (int t = 0; t < threadCount; t++) {
+            threads.emplace_back([&, t]() {
+                std::vector<RevocationTicket> tickets;
+                for (int i = 0; i < keysPerThread; i++) {
+                    pxr::TfNotice::SwiftKeys keys = {listeners[t * keysPerThread + i]->key};
+                    tickets.push_back(RevokeConcurrently(&keys));
+                    if (!keys.empty()) {
+                        allEmptied = false;
+                    }
+                }
+                for (int i = 0; i < keysPerThread; i++) {
+                    tickets[i].Wait();
+                    if (listeners[t * keysPerThread + i]->cppKey.IsValid()) {
+                        allRevoked = false;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        testPasses &= allEmptied;
+        testPasses &= allRevoked;
+        
+        stage->SetStartTimeCode(4);
+        testPasses &= callbackCount == threadCount * keysPerThread;
+    }
+    
+    // Revoking nothing is fine
+    {
+        pxr::TfNotice::SwiftKeys keys;
+        RevocationTicket ticket = RevokeConcurrently(&keys);
+        testPasses &= ticket.IsDone();
+        ticket.Wait();
+        testPasses &= keys.empty();
+    }
+    
+    return testPasses;
+}
+
+// MARK: Benchmarks
+
+namespace {
+    struct CountingListener: public pxr::TfWeakBase {
+        CountingListener(const pxr::UsdStageWeakPtr& stage, std::function<void()> callback) : callback(std::move(callback)) {
+            key = pxr::TfNotice::Register(pxr::TfCreateWeakPtr(this), &CountingListener::HandleCallback, stage);
+        }
+        
+        ~CountingListener() {
+            pxr::TfNotice::Revoke(key);
+        }
+        
+        void HandleCallback(const pxr::UsdNotice::StageContentsChanged&) {
+            callback();
+        }
+        
+        pxr::TfNotice::Key key;
+        std::function<void()> callback;
+    };
+}
+
+_xLanguage_TfNoticeBenchmarks::DispatchResult
+_xLanguage_TfNoticeBenchmarks::stageContentsChangedDispatch(int listenerCount, int editCount, bool coalesced) {
+    auto stage = pxr::UsdStage::CreateInMemory();
+    for (int i = 0; i < 10; i++) {
+        stage->DefinePrim(pxr::SdfPath("/Prim" + std::to_string(i)), pxr::TfToken("Xform"));
+    }
+    long long callbackCount = 0;
+    long long primsVisited = 0;
+    // Like a typical listener, each callback re-reads the stage it was told about
+    auto callback = [&]() {
+        callbackCount += 1;
+        for (const pxr::UsdPrim& prim : stage->Traverse()) {
+            primsVisited += prim.IsActive();
+        }
+    };
+    
+    std::vector<std::unique_ptr<CountingListener>> listeners;
+    std::vector<std::unique_ptr<CoalescingListener>> coalescingListeners;
+    for (int i = 0; i < listenerCount; i++) {
+        if (coalesced) {
+            coalescingListeners.push_back(std::make_unique<CoalescingListener>([&](int) { callback(); }));
+            coalescingListeners.back()->Register(stage);
+        } else {
+            listeners.push_back(std::make_unique<CountingListener>(stage, callback));
+        }
+    }
+    
+    // Both sides run inside the same scope, which opens an SdfChangeBlock. Direct listeners
+    // ignore the coalescing part, so the only difference measured is coalescing itself
+    auto start = std::chrono::steady_clock::now();
+    {
+        CoalescingScope scope;
+        for (int i = 0; i < editCount; i++) {
+            stage->SetStartTimeCode(i + 1);
+            pxr::UsdNotice::StageContentsChanged(stage).Send(pxr::UsdStageWeakPtr(stage));
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    DispatchResult result;
+    result.listenerCount = listenerCount;
+    result.editCount = editCount;
+    result.coalesced = coalesced;
+    result.callbackCount = callbackCount;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.noticesPerSecond = editCount / result.seconds;
+    // Tf delivers every notice to every listener either way: the sent ones, plus one for the
+    // batched Sdf changes. Coalescing only changes how many of those deliveries call back
+    result.nsPerNoticeDelivery = result.seconds * 1e9 / (double(editCount + 1) * double(listenerCount));
+    result.nsPerCallback = result.seconds * 1e9 / double(std::max(1LL, callbackCount));
+    return result;
+}
+
+_xLanguage_TfNoticeBenchmarks::RevocationResult
+_xLanguage_TfNoticeBenchmarks::revokeWhileNotifying(int threadCount, int keysPerThread, bool concurrent) {
+    const int batchSize = 16;
+    
+    auto stage = pxr::UsdStage::CreateInMemory();
+    std::atomic<long long> callbackCount{0};
+    
+    // Listeners are registered from the worker threads, and have to outlive
+    // the notifier thread so that in-flight notices never see a dead listener
+    std::vector<std::vector<std::unique_ptr<AtomicCountingListener>>> listeners(threadCount);
+    std::vector<std::vector<double>> latencies(threadCount);
+    std::atomic<int> readyCount{0};
+    std::atomic<bool> go{false};
+    std::atomic<bool> notifying{true};
+    std::atomic<long long> directRevokeCalls{0};
+    
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t]() {
+            for (int i = 0; i < keysPerThread; i++) {
+                listeners[t].push_back(std::make_unique<AtomicCountingListener>(stage, &callbackCount));
+            }
+            readyCount += 1;
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            
+            // Latency is from handing a batch off until its keys are revoked. Concurrent
+            // batches complete on Work threads, so their tickets are read after every
+            // batch is handed off, which doesn't change when they completed
+            std::vector<_xLanguage_TfNotice::RevocationTicket> tickets;
+            for (int i = 0; i < keysPerThread; i += batchSize) {
+                pxr::TfNotice::SwiftKeys keys;
+                for (int j = i; j < std::min(i + batchSize, keysPerThread); j++) {
+                    keys.push_back(listeners[t][j]->key);
+                }
+                
+                if (concurrent) {
+                    tickets.push_back(_xLanguage_TfNotice::RevokeConcurrently(&keys));
+                } else {
+                    auto start = std::chrono::steady_clock::now();
+                    pxr::TfNotice::Revoke(&keys);
+                    auto end = std::chrono::steady_clock::now();
+                    directRevokeCalls += 1;
+                    latencies[t].push_back(std::chrono::duration<double, std::micro>(end - start).count());
+                }
+            }
+            for (const auto& ticket : tickets) {
+                latencies[t].push_back(ticket.LatencyMicroseconds());
+            }
+        });
+    }
+    
+    while (readyCount.load() < threadCount) {
+        std::this_thread::yield();
+    }
+    // Started once every listener is registered, so only notices sent while
+    // keys are being revoked are counted
+    std::thread notifier([&]() {
+        double t = 0;
+        while (notifying.load(std::memory_order_relaxed)) {
+            stage->SetStartTimeCode(t);
+            t += 1;
+        }
+    });
+    long long reclaimerCallsBefore = _xLanguage_TfNotice::RevokeConcurrentlyRegistryCalls();
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    // Workers only return once all of their own tickets are done
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    long long registryRevokeCalls = concurrent
+        ? _xLanguage_TfNotice::RevokeConcurrentlyRegistryCalls() - reclaimerCallsBefore
+        : directRevokeCalls.load();
+    
+    notifying = false;
+    notifier.join();
+    
+    // Every key is revoked, so one more edit must not reach any listener
+    long long noticesDelivered = callbackCount.load();
+    stage->SetStartTimeCode(-1);
+    
+    std::vector<double> allLatencies;
+    for (const auto& threadLatencies : latencies) {
+        allLatencies.insert(allLatencies.end(), threadLatencies.begin(), threadLatencies.end());
+    }
+    std::sort(allLatencies.begin(), allLatencies.end());
+    auto percentile = [&](double p) {
+        if (allLatencies.empty()) { return 0.0; }
+        size_t i = std::min(allLatencies.size() - 1, size_t(p * (allLatencies.size() - 1) + 0.5));
+        return allLatencies[i];
+    };
+    
+    RevocationResult result;
+    result.threadCount = threadCount;
+    result.keysPerThread = keysPerThread;
+    result.concurrent = concurrent;
+    result.allRevoked = callbackCount.load() == noticesDelivered;
+    result.noticesDelivered = noticesDelivered;
+    result.registryRevokeCalls = registryRevokeCalls;
+    result.seconds = std::chrono::duration<double>(end - start).count();
+    result.revokesPerSecond = double(threadCount) * double(keysPerThread) / result.seconds;
+    result.p50Microseconds = percentile(0.5);
+    result.p99Microseconds = percentile(0.99);
+    result.maxMicroseconds = allLatencies.empty() ? 0.0 : allLatencies.back();
+    return result;
+}
@@ -33,6 +33,7 @@ import XLangTestingUtil
     - Revoking one key
     - Revoking many keys
     - Revoking no keys
+    - Revoking keys concurrently from many threads
     - Non-concurrency of callbacks
     - Type inference for each Register function
     - That Register functions support the protocol
@@ -41,6 +42,7 @@ import XLangTestingUtil
     - Promoting C++ keys in C++ and Swift
     - Casting and copying gets the underlying notification data, like objects changed
     - Lifetime of casting and you can't escape the notice caster
+    - Coalescing listeners merge notices raised inside change blocks
  */
 
 
@@ -74,6 +76,66 @@ fileprivate func XCTAssertFalse(_ x: borrowing SendableFlag, file: StaticString
 #warning("TfNoticeTests disabled on Linux because they rely on Objc blocks")
 // rdar://146138311 (Swift closure wrapped in ObjC block wrapped in std::function crashes at runtime on Linux)
 #else
+// Swift counterpart to _xLanguage_TfNotice.RegisterCoalescing, for listeners written in Swift.
+// Outside of a coalescing scope, `callback` runs for every notice with a count of 1. Inside one,
+// notices only bump a count for that scope, and `callback` runs once with that count when the
+// outermost scope closes. Scopes open on different threads at once are counted separately.
+// Revoke through the returned key, not pxr.TfNotice.Revoke, so flushes already queued for a
+// closing scope are dropped as well
+extension pxr.TfNotice {
+    private final class PendingNotices: Sendable {
+        struct State {
+            // By coalescing scope
+            var counts: [UInt64: Int] = [:]
+            var isRevoked = false
+        }
+        let state = Mutex<State>(State())
+    }
+    
+    struct CoalescingKey {
+        fileprivate let key: pxr.TfNotice.SwiftKey
+        fileprivate let pending: PendingNotices
+        
+        // Returns false if the key was already revoked
+        @discardableResult
+        func Revoke() -> Bool {
+            let wasRevoked = pending.state.withLock { state in
+                defer {
+                    state.isRevoked = true
+                    state.counts = [:]
+                }
+                return state.isRevoked
+            }
+            return !wasRevoked && pxr.TfNotice.Revoke(key)
+        }
+    }
+    
+    static func RegisterCoalescing(_ stage: pxr.UsdStage, _ type: pxr.UsdNotice.StageContentsChanged.Type,
+                                   _ callback: @escaping @Sendable (Int) -> ()) -> CoalescingKey {
+        let pending = PendingNotices()
+        let key = pxr.TfNotice.Register(stage, type) { _ in
+            let scope = _xLanguage_TfNotice.CurrentCoalescingScope()
+            guard scope != 0 else {
+                callback(1)
+                return
+            }
+            let isFirst = pending.state.withLock { state in
+                state.counts[scope, default: 0] += 1
+                return state.counts[scope] == 1
+            }
+            if isFirst {
+                _xLanguage_TfNotice.FlushWhenCoalescingEnds {
+                    let count = pending.state.withLock { $0.isRevoked ? nil : $0.counts.removeValue(forKey: scope) }
+                    if let count {
+                        callback(count)
+                    }
+                }
+            }
+        }
+        return CoalescingKey(key: key, pending: pending)
+    }
+}
+
 final class TfNoticeTests: TemporaryDirectoryHelper {
     func test_RegisterA() {
         let gotNotice = SendableCounter(0)
@@ -690,6 +752,248 @@ final class TfNoticeTests: TemporaryDirectoryHelper {
         }
     }
     
+    func test_coalescing() {
+        XCTAssertTrue(_xLanguage_TfNotice.test_coalescingMergesChangeBlock())
+        XCTAssertTrue(_xLanguage_TfNotice.test_coalescingNestedChangeBlocks())
+        
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory())
+        let callbackCount = SendableCounter(0)
+        let noticeCount = SendableCounter(0)
+        var registration = _xLanguage_TfNotice.RegisterCoalescing(stage) { n in
+            callbackCount += 1
+            noticeCount += Int(n)
+        }
+        XCTAssertTrue(registration.IsValid())
+        
+        stage.SetStartTimeCode(1)
+        XCTAssertEqual(callbackCount, 1)
+        XCTAssertEqual(noticeCount, 1)
+        
+        _xLanguage_TfNotice.WithCoalescedChanges {
+            for i in 2..<100 {
+                stage.SetStartTimeCode(Double(i))
+            }
+        }
+        XCTAssertEqual(callbackCount, 2)
+        XCTAssertEqual(noticeCount, 2)
+        
+        XCTAssertTrue(registration.Revoke())
+        XCTAssertFalse(registration.IsValid())
+        XCTAssertFalse(registration.Revoke())
+        _xLanguage_TfNotice.WithCoalescedChanges {
+            stage.SetStartTimeCode(100)
+        }
+        XCTAssertEqual(callbackCount, 2)
+        XCTAssertEqual(noticeCount, 2)
+        
+        // Dropping the last copy of a registration revokes and frees its listener
+        do {
+            let registration = _xLanguage_TfNotice.RegisterCoalescing(stage) { _ in
+                callbackCount += 1
+            }
+            let copy = registration
+            stage.SetStartTimeCode(101)
+            XCTAssertEqual(callbackCount, 3)
+            withExtendedLifetime((registration, copy)) {}
+        }
+        stage.SetStartTimeCode(102)
+        XCTAssertEqual(callbackCount, 3)
+    }
+    
+    func test_coalescing_swiftListener() {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory())
+        let callbackCount = SendableCounter(0)
+        let noticeCount = SendableCounter(0)
+        let key = pxr.TfNotice.RegisterCoalescing(stage, pxr.UsdNotice.StageContentsChanged.self) { n in
+            callbackCount += 1
+            noticeCount += n
+        }
+        
+        stage.SetStartTimeCode(1)
+        XCTAssertEqual(callbackCount, 1)
+        XCTAssertEqual(noticeCount, 1)
+        
+        _xLanguage_TfNotice.WithCoalescedChanges {
+            for i in 2..<10 {
+                stage.SetStartTimeCode(Double(i))
+                _xLanguage_TfNotice.SendStageContentsChanged(stage)
+            }
+            _xLanguage_TfNotice.WithCoalescedChanges {
+                _xLanguage_TfNotice.SendStageContentsChanged(stage)
+            }
+            // Closing the inner scope doesn't flush
+            XCTAssertEqual(callbackCount, 1)
+        }
+        // Nine sent notices, plus one for the batched Sdf changes, merged into one callback
+        XCTAssertEqual(callbackCount, 2)
+        XCTAssertEqual(noticeCount, 1 + 10)
+        
+        XCTAssertTrue(key.Revoke())
+        XCTAssertFalse(key.Revoke())
+        _xLanguage_TfNotice.WithCoalescedChanges {
+            _xLanguage_TfNotice.SendStageContentsChanged(stage)
+        }
+        XCTAssertEqual(callbackCount, 2)
+        
+        // Revoking while a flush is queued drops it
+        let lateCount = SendableCounter(0)
+        let late = pxr.TfNotice.RegisterCoalescing(stage, pxr.UsdNotice.StageContentsChanged.self) { _ in
+            lateCount += 1
+        }
+        var registration = _xLanguage_TfNotice.RegisterCoalescing(stage) { _ in
+            lateCount += 1
+        }
+        _xLanguage_TfNotice.WithCoalescedChanges {
+            _xLanguage_TfNotice.SendStageContentsChanged(stage)
+            XCTAssertTrue(late.Revoke())
+            XCTAssertTrue(registration.Revoke())
+        }
+        XCTAssertEqual(lateCount, 0)
+    }
+    
+    func test_coalescing_scopesOnManyThreads() {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory())
+        let swiftCounts = Mutex<[Int]>([])
+        let cppCounts = Mutex<[Int]>([])
+        let key = pxr.TfNotice.RegisterCoalescing(stage, pxr.UsdNotice.StageContentsChanged.self) { n in
+            swiftCounts.withLock { $0.append(n) }
+        }
+        var registration = _xLanguage_TfNotice.RegisterCoalescing(stage) { n in
+            cppCounts.withLock { $0.append(Int(n)) }
+        }
+        
+        // Each thread's scope flushes only the notices it sent itself
+        nonisolated(unsafe) let unsafeStage = stage
+        DispatchQueue.concurrentPerform(iterations: 8) { thread in
+            _xLanguage_TfNotice.WithCoalescedChanges {
+                for _ in 0..<(thread + 1) * 10 {
+                    _xLanguage_TfNotice.SendStageContentsChanged(unsafeStage)
+                }
+            }
+        }
+        let expected = (1...8).map { $0 * 10 }
+        XCTAssertEqual(swiftCounts.withLock { $0.sorted() }, expected)
+        XCTAssertEqual(cppCounts.withLock { $0.sorted() }, expected)
+        
+        XCTAssertTrue(key.Revoke())
+        XCTAssertTrue(registration.Revoke())
+    }
+    
+    func test_benchmark_StageContentsChangedDispatch() {
+        func format(_ x: Double) -> String {
+            String(format: "%.1f", x)
+        }
+        
+        // Every run does the same edits inside the same coalescing scope, so direct and
+        // coalesced only differ by coalescing. Timings are reported, not asserted
+        let editCount = 100
+        for listenerCount in [1, 10, 100, 1_000, 10_000] {
+            let direct = _xLanguage_TfNoticeBenchmarks.stageContentsChangedDispatch(Int32(listenerCount), Int32(editCount), false)
+            let coalesced = _xLanguage_TfNoticeBenchmarks.stageContentsChangedDispatch(Int32(listenerCount), Int32(editCount), true)
+            
+            XCTAssertEqual(direct.callbackCount, Int64(listenerCount * (editCount + 1)))
+            XCTAssertEqual(coalesced.callbackCount, Int64(listenerCount))
+            // Every callback traverses the stage, so once there are enough listeners for callbacks
+            // to outweigh the edits themselves, running 101 times fewer of them wins by a wide margin
+            if listenerCount >= 100 {
+                XCTAssertLessThan(coalesced.seconds * 2, direct.seconds, "listeners=\(listenerCount)")
+            }
+            
+            print("StageContentsChanged.cpp(listeners=\(listenerCount), edits=\(editCount)): " +
+                  "direct \(format(direct.seconds * 1e3)) ms, \(format(direct.nsPerNoticeDelivery)) ns/delivery, \(format(direct.nsPerCallback)) ns/callback; " +
+                  "coalesced \(format(coalesced.seconds * 1e3)) ms, \(format(coalesced.nsPerNoticeDelivery)) ns/delivery, \(format(coalesced.nsPerCallback)) ns/callback")
+            
+            // Swift listeners pay for bridging the notice into Swift on every callback
+            for isCoalesced in [false, true] {
+                let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory())
+                let callbackCount = SendableCounter(0)
+                var keys = pxr.TfNotice.SwiftKeys()
+                var coalescingKeys = [pxr.TfNotice.CoalescingKey]()
+                for _ in 0..<listenerCount {
+                    if isCoalesced {
+                        coalescingKeys.append(pxr.TfNotice.RegisterCoalescing(stage, pxr.UsdNotice.StageContentsChanged.self) { _ in
+                            callbackCount += 1
+                        })
+                    } else {
+                        keys.push_back(pxr.TfNotice.Register(stage, pxr.UsdNotice.StageContentsChanged.self) { _ in
+                            callbackCount += 1
+                        })
+                    }
+                }
+                let elapsed = ContinuousClock().measure {
+                    _xLanguage_TfNotice.WithCoalescedChanges {
+                        for i in 0..<editCount {
+                            stage.SetStartTimeCode(Double(i + 1))
+                            _xLanguage_TfNotice.SendStageContentsChanged(stage)
+                        }
+                    }
+                }
+                pxr.TfNotice.Revoke(&keys)
+                for key in coalescingKeys {
+                    key.Revoke()
+                }
+                
+                // Every notice still reaches every Swift closure, coalesced or not
+                let callbacks = isCoalesced ? listenerCount : listenerCount * (editCount + 1)
+                XCTAssertEqual(callbackCount, callbacks)
+                print("StageContentsChanged.swift(listeners=\(listenerCount), edits=\(editCount)): " +
+                      "\(isCoalesced ? "coalesced" : "direct") \(format(milliseconds(elapsed))) ms, " +
+                      "\(format(milliseconds(elapsed) * 1e6 / Double(listenerCount * (editCount + 1)))) ns/delivery, " +
+                      "\(format(milliseconds(elapsed) * 1e6 / Double(callbacks))) ns/callback")
+            }
+        }
+    }
+    
+    func test_RevokeConcurrently() {
+        XCTAssertTrue(_xLanguage_TfNotice.test_revokeConcurrently())
+        
+        let aCtr = SendableCounter(0)
+        let bCtr = SendableCounter(0)
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory())
+        
+        var keys = pxr.TfNotice.SwiftKeys()
+        keys.push_back(pxr.TfNotice.Register(stage, pxr.UsdNotice.StageContentsChanged.self) { _ in
+            aCtr += 1
+        })
+        keys.push_back(pxr.TfNotice.Register(stage, pxr.UsdNotice.StageContentsChanged.self) { _ in
+            bCtr += 1
+        })
+        
+        stage.SetStartTimeCode(5)
+        XCTAssertEqual(aCtr, 1)
+        XCTAssertEqual(bCtr, 1)
+        
+        let ticket = _xLanguage_TfNotice.RevokeConcurrently(&keys)
+        XCTAssertTrue(keys.empty())
+        ticket.Wait()
+        XCTAssertTrue(ticket.IsDone())
+        XCTAssertGreaterThanOrEqual(ticket.LatencyMicroseconds(), 0)
+        
+        stage.SetStartTimeCode(6)
+        XCTAssertEqual(aCtr, 1)
+        XCTAssertEqual(bCtr, 1)
+    }
+    
+    func test_benchmark_RevokeWhileNotifying() {
+        func format(_ x: Double) -> String {
+            String(format: "%.1f", x)
+        }
+        
+        // Every revocation is serialized on the notice registry's lock either way.
+        // RevokeConcurrently only changes who waits for it, and how many batches share a trip through it
+        let keysPerThread = 2_000
+        for threadCount in [1, 2, 4, 8, 16] {
+            for concurrent in [false, true] {
+                let result = _xLanguage_TfNoticeBenchmarks.revokeWhileNotifying(Int32(threadCount), Int32(keysPerThread), concurrent)
+                XCTAssertTrue(result.allRevoked, "threads=\(threadCount), concurrent=\(concurrent)")
+                print("RevokeWhileNotifying(threads=\(threadCount), keys/thread=\(keysPerThread), \(concurrent ? "RevokeConcurrently" : "TfNotice::Revoke")): " +
+                      "\(format(result.revokesPerSecond)) revokes/s through \(result.registryRevokeCalls) TfNotice::Revoke calls, " +
+                      "p50 \(format(result.p50Microseconds))us, p99 \(format(result.p99Microseconds))us, max \(format(result.maxMicroseconds))us, " +
+                      "\(result.noticesDelivered) notices delivered")
+            }
+        }
+    }
+    
     func test_casting_UsdNotice_StageNotice() {
         nonisolated(unsafe) let stage1 = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
         nonisolated(unsafe) let stage2 = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
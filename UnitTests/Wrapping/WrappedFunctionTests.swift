@@ -254,6 +254,242 @@ final class WrappedFunctionTests: TemporaryDirectoryHelper {
         XCTAssertEqual(s!, try contentsOfResource(subPath: "Wrapping/Function/UsdStage_ExportToString_default.txt"))
     }
 
+    // MARK: ExportToSink
+    
+    // Collects everything written to the sink, and the size of each chunk
+    private func exportedText(_ export: (@escaping Overlay.ExportSink) -> Bool) throws -> (String, [Int]) {
+        var data = Data()
+        var chunkSizes = [Int]()
+        XCTAssertTrue(export { bytes, count in
+            data.append(contentsOf: UnsafeRawBufferPointer(start: bytes, count: count))
+            chunkSizes.append(count)
+            return true
+        })
+        return (try XCTUnwrap(String(data: data, encoding: .utf8)), chunkSizes)
+    }
+    
+    func test_SdfLayer_ExportToSink() throws {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        stage.DefinePrim("/foo", "Cube")
+        let layer = Overlay.Dereference(stage.GetRootLayer())
+        let (s, chunkSizes) = try exportedText { Overlay.ExportToSink(layer, 8, $0) }
+        XCTAssertEqual(s, try contentsOfResource(subPath: "Wrapping/Function/SdfLayer_ExportToString.txt"))
+        XCTAssertGreaterThan(chunkSizes.count, 1)
+        XCTAssertLessThanOrEqual(chunkSizes.max()!, 8)
+    }
+    
+    func test_UsdStage_ExportToSink_true() throws {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        stage.DefinePrim("/foo", "Cube")
+        let (s, _) = try exportedText { Overlay.ExportToSink(stage, true, 8, $0) }
+        XCTAssertEqual(s, try contentsOfResource(subPath: "Wrapping/Function/UsdStage_ExportToString_true.txt"))
+    }
+    
+    func test_UsdStage_ExportToSink_false() throws {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        stage.DefinePrim("/foo", "Cube")
+        let (s, _) = try exportedText { Overlay.ExportToSink(stage, false, 8, $0) }
+        XCTAssertEqual(s, try contentsOfResource(subPath: "Wrapping/Function/UsdStage_ExportToString_false.txt"))
+    }
+    
+    private func makeComposedStage() -> pxr.UsdStage {
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        XCTAssertTrue(Overlay.Dereference(stage.GetRootLayer()).ImportFromString(#"""
+            #usda 1.0
+            (
+                defaultPrim = "World"
+                metersPerUnit = 0.01
+                startTimeCode = 1
+                endTimeCode = 24
+                upAxis = "Z"
+            )
+            
+            class "_Base"
+            {
+                double radius = 2
+            }
+            
+            def Sphere "Template" (
+                inherits = </_Base>
+            )
+            {
+                float3[] extent.timeSamples = {
+                    1: [(-2, -2, -2), (2, 2, 2)],
+                    24: [(-3, -3, -3), (3, 3, 3)],
+                }
+            }
+            
+            def Xform "World" (
+                variants = {
+                    string size = "big"
+                }
+                prepend variantSets = "size"
+            )
+            {
+                def "a" (
+                    prepend references = </Template>
+                )
+                {
+                }
+            
+                over "b"
+                {
+                    token visibility = "invisible"
+                }
+            
+                variantSet "size" = {
+                    "big" {
+                        double3 xformOp:scale = (10, 10, 10)
+                        uniform token[] xformOpOrder = ["xformOp:scale"]
+                    }
+                    "small" {
+                        double3 xformOp:scale = (0.1, 0.1, 0.1)
+                        uniform token[] xformOpOrder = ["xformOp:scale"]
+                    }
+                }
+            }
+            
+            def Scope "Empty"
+            {
+            }
+            """#))
+        return stage
+    }
+    
+    func test_UsdStage_ExportToSink_matchesExportToString() throws {
+        let stage = makeComposedStage()
+        for addSourceFileComment in [true, false] {
+            let expected: String? = stage.ExportToString(addSourceFileComment: addSourceFileComment)
+            let (s, _) = try exportedText { Overlay.ExportToSink(stage, addSourceFileComment, 100, $0) }
+            XCTAssertEqual(s, expected)
+        }
+        
+        let layer = Overlay.Dereference(stage.GetRootLayer())
+        let expected: String? = layer.ExportToString()
+        let (s, _) = try exportedText { Overlay.ExportToSink(layer, 100, $0) }
+        XCTAssertEqual(s, expected)
+    }
+    
+    func test_UsdStage_ExportToSink_instancing() throws {
+        // Instancing falls back to flattening the whole stage at once
+        let stage = makeComposedStage()
+        XCTAssertTrue(Overlay.Dereference(stage.GetSessionLayer()).ImportFromString(#"""
+            #usda 1.0
+            
+            over "World"
+            {
+                over "a" (
+                    instanceable = true
+                )
+                {
+                }
+            
+                def "c" (
+                    instanceable = true
+                    prepend references = </Template>
+                )
+                {
+                }
+            }
+            """#))
+        XCTAssertFalse(stage.GetPrototypes().empty())
+        
+        let expected: String? = stage.ExportToString(addSourceFileComment: false)
+        let (s, _) = try exportedText { Overlay.ExportToSink(stage, false, 100, $0) }
+        XCTAssertEqual(s, expected)
+    }
+    
+    func test_UsdStage_ExportToFileDescriptor() throws {
+        let stage = makeComposedStage()
+        let url = urlForStage(named: "exported.usda")
+        XCTAssertTrue(FileManager.default.createFile(atPath: url.path(percentEncoded: false), contents: nil))
+        let handle = try FileHandle(forWritingTo: url)
+        XCTAssertTrue(Overlay.ExportToFileDescriptor(stage, true, 64, handle.fileDescriptor))
+        try handle.close()
+        
+        let expected: String? = stage.ExportToString(addSourceFileComment: true)
+        XCTAssertEqual(try contentsOfFile(at: url), expected)
+    }
+    
+    func test_UsdStage_ExportToSink_stops() {
+        let stage = makeComposedStage()
+        var chunkCount = 0
+        XCTAssertFalse(Overlay.ExportToSink(stage, false, 16) { _, _ in
+            chunkCount += 1
+            return chunkCount < 3
+        })
+        XCTAssertEqual(chunkCount, 3)
+    }
+    
+    func test_UsdStage_ExportToSink_masked() throws {
+        let source = Overlay.Dereference(pxr.UsdStage.CreateNew(pathForStage(named: "masked.usda"), .LoadAll))
+        for path in ["/A/B/Deep", "/A/C", "/D"] {
+            source.DefinePrim(pxr.SdfPath(std.string(path)), "Xform")
+        }
+        source.Save()
+        
+        let stage = try XCTUnwrap(Overlay.DereferenceOrNil(pxr.UsdStage.OpenMasked(pathForStage(named: "masked.usda"), pxr.UsdStagePopulationMask(["/A/B"]), .LoadAll)))
+        let expected: String? = stage.ExportToString(addSourceFileComment: false)
+        let (s, _) = try exportedText { Overlay.ExportToSink(stage, false, 100, $0) }
+        XCTAssertEqual(s, expected)
+        XCTAssertTrue(s.contains(#"def Xform "Deep""#))
+        XCTAssertFalse(s.contains(#"def Xform "C""#))
+        XCTAssertFalse(s.contains(#"def Xform "D""#))
+    }
+    
+    func test_benchmark_UsdStage_ExportToSink() throws {
+        // The same prims under many roots, and under one root, which ExportToSink
+        // has to flatten all at once
+        #if DEBUG
+        let layouts = [(rootCount: 16, childCount: 50), (rootCount: 1, childCount: 800)]
+        #else
+        let layouts = [(rootCount: 64, childCount: 200), (rootCount: 1, childCount: 12_800)]
+        #endif
+        let values = pxr.VtFloatArray(count: 1_000) {
+            for i in $0.indices { $0[i] = Float(i) * 0.25 }
+        }
+        
+        for (rootCount, childCount) in layouts {
+            let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+            for root in 0..<rootCount {
+                for child in 0..<childCount {
+                    let prim = stage.DefinePrim(pxr.SdfPath(std.string("/Root\(root)/Child\(child)")), "Xform")
+                    prim.CreateAttribute("values", .FloatArray, true, .SdfVariabilityVarying).Set(values, .Default())
+                }
+            }
+            
+            let url = urlForStage(named: "benchmark_\(rootCount).usda")
+            XCTAssertTrue(FileManager.default.createFile(atPath: url.path(percentEncoded: false), contents: nil))
+            let handle = try FileHandle(forWritingTo: url)
+            defer { try? handle.close() }
+            
+            // ExportToString has nothing to hand out until the whole string is built
+            let start = ContinuousClock.now
+            let (string, stringPeak) = peakFootprintIncrease { () -> String? in stage.ExportToString(addSourceFileComment: false) }
+            let stringDuration = ContinuousClock.now - start
+            let byteCount = string?.utf8.count ?? 0
+            
+            var firstByte: ContinuousClock.Instant?
+            var sinkByteCount = 0
+            let sinkStart = ContinuousClock.now
+            let (succeeded, sinkPeak) = peakFootprintIncrease {
+                Overlay.ExportToSink(stage, false, 1 << 16) { bytes, count in
+                    if firstByte == nil { firstByte = .now }
+                    sinkByteCount += count
+                    return (try? handle.write(contentsOf: UnsafeRawBufferPointer(start: bytes, count: count))) != nil
+                }
+            }
+            let sinkDuration = ContinuousClock.now - sinkStart
+            XCTAssertTrue(succeeded)
+            XCTAssertEqual(sinkByteCount, byteCount)
+            
+            print(String(format: "ExportToString(roots=%d, prims=%d, size=%.1f MB): %.1f ms to first byte, %.1f ms total, %.1f MB peak footprint increase",
+                         rootCount, rootCount * childCount, Double(byteCount) / 1e6, milliseconds(stringDuration), milliseconds(stringDuration), Double(stringPeak) / 1e6))
+            print(String(format: "ExportToSink(roots=%d, prims=%d, size=%.1f MB): %.1f ms to first byte, %.1f ms total, %.1f MB peak footprint increase",
+                         rootCount, rootCount * childCount, Double(sinkByteCount) / 1e6, milliseconds(firstByte.map { $0 - sinkStart } ?? .zero), milliseconds(sinkDuration), Double(sinkPeak) / 1e6))
+        }
+    }
+
     func test_UsdGeomXformOp_GetOpType() {
         let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
         let xformable = pxr.UsdGeomXformable(stage.DefinePrim("/foo", "Cube"))
@@ -20,6 +20,7 @@
 
 import XCTest
 import OpenUSD
+import Synchronization
 
 final class WrappedTypeTests: HydraHelper {
     // MARK: UsdPrimTypeInfoWrapper
@@ -763,6 +764,164 @@ final class WrappedTypeTests: HydraHelper {
         XCTAssertFalse(resolvedPath.IsEmpty())
     }
     
+    func test_CachingArResolver() throws {
+        let resolver: Overlay.ArResolverWrapper = Overlay.ArGetResolver()
+        let cache = CachingArResolver()
+        let copyDestination = String(try copyResourceToWorkingDirectory(subPath: "Wrapping/ArResolverWrapper", destName: "ArResolverWrapper"))
+        let input = URL(filePath: copyDestination).appending(path: "input.usda").path(percentEncoded: false)
+        let missing = URL(filePath: copyDestination).appending(path: "missing.usda").path(percentEncoded: false)
+        
+        for _ in 0..<2 {
+            XCTAssertEqual(cache.Resolve(input), resolver.Resolve(std.string(input)))
+            XCTAssertFalse(cache.Resolve(input).IsEmpty())
+            XCTAssertTrue(cache.Resolve(missing).IsEmpty())
+            
+            let anchor = cache.Resolve(input)
+            XCTAssertEqual(cache.CreateIdentifier("./other.usda", anchor), String(resolver.CreateIdentifier("./other.usda", anchor)))
+        }
+        XCTAssertEqual(cache.statistics.misses, 3)
+        XCTAssertEqual(cache.statistics.hits, 9)
+        XCTAssertEqual(cache.count, 3)
+    }
+    
+    #if !os(Linux)
+    func test_CachingArResolver_invalidation() throws {
+        let resolver: Overlay.ArResolverWrapper = Overlay.ArGetResolver()
+        let path = tempDirectory.appending(path: "late.usda").path(percentEncoded: false)
+        
+        try CachingArResolver.withScopedCache { cache in
+            XCTAssertTrue(cache.Resolve(path).IsEmpty())
+            try "#usda 1.0\n".write(toFile: path, atomically: true, encoding: .utf8)
+            XCTAssertFalse(resolver.Resolve(std.string(path)).IsEmpty())
+            // Still cached until the resolver says otherwise
+            XCTAssertTrue(cache.Resolve(path).IsEmpty())
+            
+            Overlay.SendResolverChanged()
+            XCTAssertEqual(cache.statistics.invalidations, 1)
+            XCTAssertEqual(cache.count, 0)
+            XCTAssertFalse(cache.Resolve(path).IsEmpty())
+            
+            try FileManager.default.removeItem(atPath: path)
+            Overlay.SendResolverChanged()
+            XCTAssertTrue(cache.Resolve(path).IsEmpty())
+        }
+    }
+    
+    func test_CachingArResolver_concurrentInvalidation() throws {
+        let resolver: Overlay.ArResolverWrapper = Overlay.ArGetResolver()
+        let cache = CachingArResolver()
+        let paths = (0..<32).map { tempDirectory.appending(path: "file_\($0).usda").path(percentEncoded: false) }
+        
+        // Files appear and disappear while other threads resolve them, with a notice after each change
+        let isDone = Atomic<Bool>(false)
+        let finished = DispatchSemaphore(value: 0)
+        Thread.detachNewThread {
+            for round in 0..<200 {
+                let path = paths[round % paths.count]
+                if FileManager.default.fileExists(atPath: path) {
+                    try? FileManager.default.removeItem(atPath: path)
+                } else {
+                    FileManager.default.createFile(atPath: path, contents: Data("#usda 1.0\n".utf8))
+                }
+                Overlay.SendResolverChanged()
+            }
+            isDone.store(true, ordering: .releasing)
+            finished.signal()
+        }
+        while !isDone.load(ordering: .acquiring) {
+            pxr.WorkParallelForN(paths.count * 16) { begin, end in
+                for i in Int(begin)..<Int(end) {
+                    _ = cache.Resolve(paths[i % paths.count])
+                }
+            }
+        }
+        finished.wait()
+        
+        // Anything cached after the last notice reflects the final state of the files
+        XCTAssertEqual(cache.statistics.invalidations, 200)
+        for path in paths {
+            XCTAssertEqual(cache.Resolve(path), resolver.Resolve(std.string(path)), path)
+        }
+    }
+    #endif // #if !os(Linux)
+    
+    func test_benchmark_CachingArResolver() throws {
+        #if DEBUG
+        let (depth, assetCount, rounds) = (16, 32, 8)
+        #else
+        let (depth, assetCount, rounds) = (64, 128, 32)
+        #endif
+        
+        // A chain of layers that each reference the next one, and all reference the same assets
+        let assets = tempDirectory.appending(path: "assets", directoryHint: .isDirectory)
+        try FileManager.default.createDirectory(at: assets, withIntermediateDirectories: true)
+        for j in 0..<assetCount {
+            try "#usda 1.0\n(\n    defaultPrim = \"A\"\n)\n\ndef \"A\"\n{\n}\n"
+                .write(to: assets.appending(path: "asset_\(j).usda"), atomically: true, encoding: .utf8)
+        }
+        var workItems = [(assetPath: String, anchor: pxr.ArResolvedPath)]()
+        for i in 0..<depth {
+            var assetPaths = (0..<assetCount).map { "./assets/asset_\($0).usda" }
+            if i + 1 < depth { assetPaths.append("./layer_\(i + 1).usda") }
+            
+            var text = "#usda 1.0\n(\n    defaultPrim = \"Root\"\n)\n\ndef \"Root\" (\n"
+            if i + 1 < depth { text += "    prepend references = @./layer_\(i + 1).usda@\n" }
+            text += ")\n{\n"
+            for j in 0..<assetCount {
+                text += "    def \"Asset_\(j)\" (\n        prepend references = @./assets/asset_\(j).usda@\n    )\n    {\n    }\n"
+            }
+            text += "}\n"
+            let layerUrl = urlForStage(named: "layer_\(i).usda")
+            try text.write(to: layerUrl, atomically: true, encoding: .utf8)
+            
+            let anchor = pxr.ArResolvedPath(std.string(layerUrl.path(percentEncoded: false)))
+            workItems.append(contentsOf: assetPaths.map { (assetPath: $0, anchor: anchor) })
+        }
+        
+        let stage = try XCTUnwrap(Overlay.DereferenceOrNil(pxr.UsdStage.Open(pathForStage(named: "layer_0.usda"), .LoadAll)))
+        XCTAssertTrue(stage.GetPrimAtPath("/Root/Asset_0").IsValid())
+        
+        nonisolated(unsafe) let resolver: Overlay.ArResolverWrapper = Overlay.ArGetResolver()
+        nonisolated(unsafe) let work = workItems
+        let cache = CachingArResolver()
+        // Powers of two up to the number of physical cores, and the number of physical cores itself
+        let physical = Int(pxr.WorkGetPhysicalConcurrencyLimit())
+        var limits = Array(sequence(first: 1) { $0 * 2 <= physical ? $0 * 2 : nil })
+        if limits.last != physical { limits.append(physical) }
+        let previous = pxr.WorkGetConcurrencyLimit()
+        defer { pxr.WorkSetConcurrencyLimit(previous) }
+        
+        func resolvesPerSecond(_ resolve: @Sendable (String, pxr.ArResolvedPath) -> Bool) -> Double {
+            let total = work.count * rounds
+            let unresolved = Atomic<Int>(0)
+            let start = ContinuousClock.now
+            pxr.WorkParallelForN(total) { begin, end in
+                for i in Int(begin)..<Int(end) {
+                    let item = work[i % work.count]
+                    if !resolve(item.assetPath, item.anchor) { unresolved.add(1, ordering: .relaxed) }
+                }
+            }
+            let duration = ContinuousClock.now - start
+            XCTAssertEqual(unresolved.load(ordering: .relaxed), 0)
+            let seconds = milliseconds(duration) / 1e3
+            return Double(total) / seconds
+        }
+        
+        print("CachingArResolver(layers=\(depth), assets=\(assetCount), resolves per round=\(work.count), rounds=\(rounds))")
+        for limit in limits {
+            pxr.WorkSetConcurrencyLimit(UInt32(limit))
+            let direct = resolvesPerSecond { assetPath, anchor in
+                !resolver.Resolve(resolver.CreateIdentifier(std.string(assetPath), anchor)).IsEmpty()
+            }
+            cache.invalidateAll()
+            let cached = resolvesPerSecond { assetPath, anchor in
+                !cache.Resolve(cache.CreateIdentifier(assetPath, anchor)).IsEmpty()
+            }
+            print(String(format: "    threads=%d: %.0f resolves/s direct, %.0f resolves/s cached (%.1fx)",
+                         limit, direct, cached, cached / direct))
+        }
+    }
+    
     // MARK: UsdZipFileIteratorWrapper
     
     func test_UsdZipFileIteratorWrapper() {
@@ -803,6 +962,199 @@ final class WrappedTypeTests: HydraHelper {
         XCTAssertNil(zipFile.Find("doesntexist").GetFile())
     }
     
+    func test_UsdzArchive() throws {
+        let path = try copyResourceToWorkingDirectory(subPath: "Wrapping/usdzipfileiteratorwrapper.usdz", destName: "input.usdz")
+        let archive = try XCTUnwrap(UsdzArchive(path: String(path)))
+        XCTAssertEqual(archive.entries.map(\.name), ["src/a.txt", "src/b.png"])
+        XCTAssertEqual(archive.totalByteCount, 82 + 7228)
+        XCTAssertNil(archive["doesntexist"])
+        
+        let a = try XCTUnwrap(archive["src/a.txt"])
+        XCTAssertEqual(a.info.dataOffset, 64)
+        XCTAssertEqual(a.bytes.count, 82)
+        let s = "This is a file named a.txt. It is used for a test.\n\nIt has multiple lines in it.\n\n"
+        XCTAssertEqual(Data(a.bytes), s.data(using: .utf8))
+        
+        XCTAssertEqual(archive.checksums(), [3011207731, 384784137])
+        
+        let extracted = tempDirectory.appending(path: "extracted", directoryHint: .isDirectory)
+        try archive.extractAll(to: extracted)
+        for entry in archive.entries {
+            XCTAssertEqual(try dataContentsOfFile(at: extracted.appending(path: entry.name)), Data(entry.bytes))
+        }
+        
+        XCTAssertNil(UsdzArchive(path: "/this/path/doesnt/exist.usdz"))
+    }
+    
+    func test_UsdzArchive_extractAllRejectsEscapingNames() throws {
+        let path = tempDirectory.appending(path: "malicious.usdz").path(percentEncoded: false)
+        let txtPath = tempDirectory.appending(path: "payload.txt")
+        try "payload".write(to: txtPath, atomically: true, encoding: .utf8)
+        var writer = pxr.UsdZipFileWriter.CreateNew(std.string(path))
+        writer.AddFile(std.string(txtPath.path(percentEncoded: false)), "fine.txt")
+        writer.AddFile(std.string(txtPath.path(percentEncoded: false)), "nested/../../escaped.txt")
+        writer.Save()
+        
+        let archive = try XCTUnwrap(UsdzArchive(path: path))
+        // UsdZipFileWriter may normalize the name to "../escaped.txt", which escapes just the same
+        XCTAssertEqual(archive.entries.count, 2)
+        XCTAssertTrue(archive.entries[1].name.hasSuffix("../escaped.txt"))
+        let extracted = tempDirectory.appending(path: "extracted", directoryHint: .isDirectory)
+        XCTAssertThrowsError(try archive.extractAll(to: extracted))
+        // Nothing is written, not even the entries with safe names
+        XCTAssertFalse(FileManager.default.fileExists(atPath: tempDirectory.appending(path: "escaped.txt").path(percentEncoded: false)))
+        XCTAssertFalse(FileManager.default.fileExists(atPath: extracted.appending(path: "fine.txt").path(percentEncoded: false)))
+        
+        XCTAssertNil(UsdzArchive.extractionURL(for: "/etc/passwd", in: extracted))
+        XCTAssertNil(UsdzArchive.extractionURL(for: "../sibling.txt", in: extracted))
+        XCTAssertNil(UsdzArchive.extractionURL(for: "a/../../sibling.txt", in: extracted))
+        XCTAssertNil(UsdzArchive.extractionURL(for: "..", in: extracted))
+        XCTAssertNil(UsdzArchive.extractionURL(for: "", in: extracted))
+        XCTAssertEqual(UsdzArchive.extractionURL(for: "src/./a.txt", in: extracted),
+                       extracted.appending(path: "src/a.txt").standardizedFileURL)
+        XCTAssertEqual(UsdzArchive.extractionURL(for: "..a/b..", in: extracted),
+                       extracted.appending(path: "..a/b..").standardizedFileURL)
+    }
+    
+    func test_UsdzArchive_renderingPackages() throws {
+        // Entries outlive the archive object they came from
+        var entries = [UsdzArchive.Entry]()
+        for name in ["spinning_top", "mxmetallic", "smoke"] {
+            let url = urlForResource(subPath: "Rendering/\(name).usdz")
+            let archive = try XCTUnwrap(UsdzArchive(path: url.path(percentEncoded: false)))
+            XCTAssertFalse(archive.entries.isEmpty)
+            XCTAssertEqual(archive.checksums(), archive.entries.map { UInt32($0.info.crc) }, name)
+            entries.append(contentsOf: archive.entries)
+        }
+        for entry in entries {
+            XCTAssertEqual(UsdzArchive.crc32(entry.bytes), UInt32(entry.info.crc), entry.name)
+        }
+    }
+    
+    func test_UsdzArchiveCache() throws {
+        let path = String(try copyResourceToWorkingDirectory(subPath: "Wrapping/usdzipfileiteratorwrapper.usdz", destName: "input.usdz"))
+        let cache = UsdzArchiveCache(maximumArchiveCount: 8)
+        
+        let first = try XCTUnwrap(cache.archive(at: path))
+        // Opening a stage from another package doesn't affect the cached mapping
+        let stageUrl = urlForResource(subPath: "Rendering/spinning_top.usdz")
+        XCTAssertNotNil(Overlay.DereferenceOrNil(pxr.UsdStage.Open(std.string(stageUrl.path(percentEncoded: false)), .LoadAll)))
+        let second = try XCTUnwrap(cache.archive(at: path))
+        XCTAssertTrue(first === second)
+        XCTAssertEqual(cache.statistics.hits, 1)
+        XCTAssertEqual(cache.statistics.misses, 1)
+        
+        // Rewriting the package invalidates it
+        var writer = pxr.UsdZipFileWriter.CreateNew(std.string(path))
+        let txtPath = tempDirectory.appending(path: "only.txt")
+        try "only".write(to: txtPath, atomically: true, encoding: .utf8)
+        writer.AddFile(std.string(txtPath.path(percentEncoded: false)), "only.txt")
+        writer.Save()
+        
+        let third = try XCTUnwrap(cache.archive(at: path))
+        XCTAssertFalse(first === third)
+        XCTAssertEqual(third.entries.map(\.name), ["only.txt"])
+        XCTAssertEqual(cache.statistics.misses, 2)
+        // The old archive's views are still valid, because UsdZipFileWriter replaces the file
+        // instead of rewriting it in place
+        XCTAssertEqual(first.checksums(), [3011207731, 384784137])
+        
+        cache.removeAll()
+        XCTAssertEqual(cache.statistics.hits, 0)
+        XCTAssertNil(cache.archive(at: "/this/path/doesnt/exist.usdz"))
+    }
+    
+    func test_UsdzArchiveCache_evictsLeastRecentlyUsed() throws {
+        let paths = ["spinning_top", "mxmetallic", "smoke"].map {
+            urlForResource(subPath: "Rendering/\($0).usdz").path(percentEncoded: false)
+        }
+        let cache = UsdzArchiveCache(maximumArchiveCount: 2)
+        let top = try XCTUnwrap(cache.archive(at: paths[0]))
+        _ = try XCTUnwrap(cache.archive(at: paths[1]))
+        // Using spinning_top again leaves mxmetallic as the least recently used
+        XCTAssertTrue(try XCTUnwrap(cache.archive(at: paths[0])) === top)
+        _ = try XCTUnwrap(cache.archive(at: paths[2]))
+        XCTAssertEqual(cache.count, 2)
+        XCTAssertEqual(cache.statistics.evictions, 1)
+        
+        XCTAssertTrue(try XCTUnwrap(cache.archive(at: paths[0])) === top)
+        XCTAssertEqual(cache.statistics.misses, 3)
+        _ = try XCTUnwrap(cache.archive(at: paths[1]))
+        XCTAssertEqual(cache.statistics.misses, 4)
+        XCTAssertEqual(cache.statistics.evictions, 2)
+        XCTAssertEqual(cache.count, 2)
+        // Evicted archives handed out earlier are still usable
+        XCTAssertEqual(top.checksums(), top.entries.map { UInt32($0.info.crc) })
+    }
+    
+    func test_benchmark_UsdzArchive() throws {
+        #if DEBUG
+        let iterations = 20
+        #else
+        let iterations = 200
+        #endif
+        let paths = ["spinning_top", "mxmetallic", "smoke"].map {
+            urlForResource(subPath: "Rendering/\($0).usdz").path(percentEncoded: false)
+        }
+        
+        // Old path: open every time, and copy each entry out before using it
+        var copiedBytes = 0
+        var copiedChecksums = [UInt32]()
+        let copyStart = ContinuousClock.now
+        for _ in 0..<iterations {
+            copiedChecksums = []
+            for path in paths {
+                let zipFile = pxr.UsdZipFile.Open(std.string(path))
+                for file in zipFile {
+                    let data = Data(bytes: file.GetFile()!, count: file.GetFileInfo().size)
+                    copiedBytes += data.count
+                    copiedChecksums.append(data.withUnsafeBytes { UsdzArchive.crc32($0) })
+                }
+            }
+        }
+        let copyDuration = ContinuousClock.now - copyStart
+        
+        // New path: mapped archives from the cache, hashed in place and in parallel
+        let cache = UsdzArchiveCache(maximumArchiveCount: 8)
+        var mappedChecksums = [UInt32]()
+        var hashedBytes = 0
+        let mappedStart = ContinuousClock.now
+        for _ in 0..<iterations {
+            mappedChecksums = []
+            for path in paths {
+                let archive = try XCTUnwrap(cache.archive(at: path))
+                mappedChecksums.append(contentsOf: archive.checksums())
+                hashedBytes += archive.totalByteCount
+            }
+        }
+        let mappedDuration = ContinuousClock.now - mappedStart
+        XCTAssertEqual(mappedChecksums, copiedChecksums)
+        
+        // Opening alone, without hashing
+        let uncachedOpenStart = ContinuousClock.now
+        for _ in 0..<iterations {
+            for path in paths {
+                _ = try XCTUnwrap(UsdzArchive(path: path)).entries.count
+            }
+        }
+        let uncachedOpenDuration = ContinuousClock.now - uncachedOpenStart
+        let cachedOpenStart = ContinuousClock.now
+        for _ in 0..<iterations {
+            for path in paths {
+                _ = try XCTUnwrap(cache.archive(at: path)).entries.count
+            }
+        }
+        let cachedOpenDuration = ContinuousClock.now - cachedOpenStart
+        
+        let opens = Double(iterations * paths.count)
+        print(String(format: "UsdZipFile + copy: %.3f ms per package to open, enumerate and hash, %.1f MB copied",
+                     milliseconds(copyDuration) / opens, Double(copiedBytes) / 1e6))
+        print(String(format: "UsdzArchive (cached, mapped): %.3f ms per package to open, enumerate and hash, %.1f MB hashed in place",
+                     milliseconds(mappedDuration) / opens, Double(hashedBytes) / 1e6))
+        print(String(format: "UsdzArchive open and enumerate: %.3f ms uncached, %.3f ms cached per package",
+                     milliseconds(uncachedOpenDuration) / opens, milliseconds(cachedOpenDuration) / opens))
+    }
+    
     // MARK: UsdAppUtilsFrameRecorderWrapper
     
     func test_UsdAppUtilsFrameRecorderWrapper() {
@@ -819,5 +1171,145 @@ final class WrappedTypeTests: HydraHelper {
                         .Default(), renderPath)
         assertImagesEqual(urlForResource(subPath: "Wrapping/UsdAppUtilsFrameRecorderWrapper/expected-out.png"), renderUrl, file: #file, line: #line)
     }
+    
+    // MARK: PipelinedFrameRecorder
+    
+    private func makeFrameRecorderStage(animated: Bool) -> pxr.UsdStage {
+        let modelUrl = urlForResource(subPath: "Wrapping/UsdAppUtilsFrameRecorderWrapper/test.usda")
+        let stage = Overlay.Dereference(pxr.UsdStage.Open(std.string(modelUrl.path(percentEncoded: false))))
+        if animated {
+            // Authored on the session layer, so test.usda's layer stays untouched for other tests
+            stage.SetEditTarget(pxr.UsdEditTarget(stage.GetSessionLayer(), pxr.SdfLayerOffset(0, 1)))
+            let rotateZOp = pxr.UsdGeomXformable(stage.GetPrimAtPath("/TestMesh")).AddRotateZOp(.PrecisionFloat, "", false)
+            for frame in 0...48 {
+                rotateZOp.GetAttr().Set(Float(frame) * 7.5, pxr.UsdTimeCode(Double(frame)))
+            }
+        }
+        return stage
+    }
+    
+    private func makePipelinedFrameRecorder(maximumFramesInFlight: Int) -> PipelinedFrameRecorder {
+        let recorder = PipelinedFrameRecorder(cameraLightEnabled: true, maximumFramesInFlight: maximumFramesInFlight)
+        recorder.domeLightVisibility = true
+        recorder.colorCorrectionMode = "sRGB"
+        return recorder
+    }
+    
+    func test_PipelinedFrameRecorder_matchesExpectedOutput() throws {
+        let stage = makeFrameRecorderStage(animated: false)
+        let recorder = makePipelinedFrameRecorder(maximumFramesInFlight: 2)
+        let renderUrl = tempDirectory.appending(path: UUID().uuidString + ".png")
+        
+        XCTAssertTrue(recorder.record(stage, camera: pxr.UsdGeomCamera(pxr.UsdPrim()), timeCodes: [pxr.UsdTimeCode.Default()]) { _ in renderUrl })
+        assertImagesEqual(urlForResource(subPath: "Wrapping/UsdAppUtilsFrameRecorderWrapper/expected-out.png"), renderUrl, file: #file, line: #line)
+        
+        // Besides matching expected-out.png with the golden-image tolerance, pipelining only changes
+        // when frames are read back and written, so its pixels have to be exactly what
+        // UsdAppUtilsFrameRecorder renders here
+        let expectedUrl = tempDirectory.appending(path: UUID().uuidString + ".png")
+        var frameRecorder = Overlay.UsdAppUtilsFrameRecorderWrapper("", true, true)
+        frameRecorder.SetDomeLightVisibility(true)
+        frameRecorder.SetColorCorrectionMode("sRGB")
+        frameRecorder.Record(Overlay.TfWeakPtr(stage), pxr.UsdGeomCamera(pxr.UsdPrim()),
+                             .Default(), std.string(expectedUrl.path(percentEncoded: false)))
+        let expected = try XCTUnwrap(rgba8Pixels(contentsOf: expectedUrl))
+        let actual = try XCTUnwrap(rgba8Pixels(contentsOf: renderUrl))
+        XCTAssertEqual(actual.width, expected.width)
+        XCTAssertEqual(actual.height, expected.height)
+        XCTAssertTrue(actual.pixels == expected.pixels, "Pipelined render differs from UsdAppUtilsFrameRecorder")
+        XCTAssertEqual(recorder.timing.frames.count, 1)
+        XCTAssertEqual(recorder.timing.peakFramesInFlight, 1)
+    }
+    
+    func test_PipelinedFrameRecorder_matchesRecordPerFrame() throws {
+        let stage = makeFrameRecorderStage(animated: true)
+        let recorder = makePipelinedFrameRecorder(maximumFramesInFlight: 3)
+        let directory = tempDirectory.appending(path: UUID().uuidString, directoryHint: .isDirectory)
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        func url(_ frame: Int, _ prefix: String) -> URL {
+            directory.appending(path: "\(prefix).\(frame).png")
+        }
+        
+        XCTAssertTrue(recorder.record(stage, camera: pxr.UsdGeomCamera(pxr.UsdPrim()), from: 0, through: 6) {
+            url(Int($0.GetValue()), "pipelined")
+        })
+        XCTAssertEqual(recorder.timing.frames.map { $0.timeCode.GetValue() }, [0, 1, 2, 3, 4, 5, 6])
+        XCTAssertLessThanOrEqual(recorder.timing.peakFramesInFlight, 3)
+        XCTAssertTrue(recorder.timing.frames.allSatisfy { $0.write > .zero })
+        print(recorder.timing.description)
+        
+        var frameRecorder = Overlay.UsdAppUtilsFrameRecorderWrapper("", true, true)
+        frameRecorder.SetDomeLightVisibility(true)
+        frameRecorder.SetColorCorrectionMode("sRGB")
+        for frame in 0...6 {
+            frameRecorder.Record(Overlay.TfWeakPtr(stage), pxr.UsdGeomCamera(pxr.UsdPrim()),
+                                 pxr.UsdTimeCode(Double(frame)), std.string(url(frame, "record").path(percentEncoded: false)))
+            let expected = try XCTUnwrap(rgba8Pixels(contentsOf: url(frame, "record")))
+            let actual = try XCTUnwrap(rgba8Pixels(contentsOf: url(frame, "pipelined")))
+            XCTAssertTrue(actual.pixels == expected.pixels && actual.width == expected.width && actual.height == expected.height,
+                          "Frame \(frame) differs from UsdAppUtilsFrameRecorder")
+        }
+        // The mesh is animated, so the frames should actually differ
+        XCTAssertNotEqual(rgba8Pixels(contentsOf: url(0, "pipelined"))?.pixels, rgba8Pixels(contentsOf: url(3, "pipelined"))?.pixels)
+    }
+    
+    func test_PipelinedFrameRecorder_failedWrite() {
+        let stage = makeFrameRecorderStage(animated: false)
+        let recorder = makePipelinedFrameRecorder(maximumFramesInFlight: 2)
+        let missingDirectory = tempDirectory.appending(path: "this/directory/doesnt/exist")
+        
+        XCTAssertFalse(recorder.record(stage, camera: pxr.UsdGeomCamera(pxr.UsdPrim()), from: 0, through: 2) {
+            missingDirectory.appending(path: "\(Int($0.GetValue())).png")
+        })
+        // Every frame is still rendered, and every staging buffer comes back for the next call
+        XCTAssertEqual(recorder.timing.frames.count, 3)
+        let renderUrl = tempDirectory.appending(path: UUID().uuidString + ".png")
+        XCTAssertTrue(recorder.record(stage, camera: pxr.UsdGeomCamera(pxr.UsdPrim()), timeCodes: [pxr.UsdTimeCode.Default()]) { _ in renderUrl })
+    }
+    
+    func test_benchmark_PipelinedFrameRecorder() throws {
+        #if DEBUG
+        let frameCount = 8
+        #else
+        let frameCount = 48
+        #endif
+        let stage = makeFrameRecorderStage(animated: true)
+        let directory = tempDirectory.appending(path: UUID().uuidString, directoryHint: .isDirectory)
+        try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+        func path(_ name: String) -> std.string {
+            std.string(directory.appending(path: name).path(percentEncoded: false))
+        }
+        
+        // Old path: one Record call per frame, which renders and then writes
+        var frameRecorder = Overlay.UsdAppUtilsFrameRecorderWrapper("", true, true)
+        frameRecorder.SetDomeLightVisibility(true)
+        frameRecorder.SetColorCorrectionMode("sRGB")
+        // Warm up, so populating Hydra isn't counted
+        frameRecorder.Record(Overlay.TfWeakPtr(stage), pxr.UsdGeomCamera(pxr.UsdPrim()), pxr.UsdTimeCode(0), path("warmup.png"))
+        let serialStart = ContinuousClock.now
+        for frame in 0..<frameCount {
+            frameRecorder.Record(Overlay.TfWeakPtr(stage), pxr.UsdGeomCamera(pxr.UsdPrim()), pxr.UsdTimeCode(Double(frame)), path("record.\(frame).png"))
+        }
+        let serialDuration = ContinuousClock.now - serialStart
+        print(String(format: "UsdAppUtilsFrameRecorder::Record: %.1f ms per frame", milliseconds(serialDuration) / Double(frameCount)))
+        
+        for maximumFramesInFlight in [1, 2, 4] {
+            let recorder = makePipelinedFrameRecorder(maximumFramesInFlight: maximumFramesInFlight)
+            recorder.record(stage, camera: pxr.UsdGeomCamera(pxr.UsdPrim()), timeCodes: [pxr.UsdTimeCode(0)]) { _ in
+                directory.appending(path: "warmup.png")
+            }
+            XCTAssertTrue(recorder.record(stage, camera: pxr.UsdGeomCamera(pxr.UsdPrim()), from: 0, through: Double(frameCount - 1)) {
+                directory.appending(path: "pipelined.\(maximumFramesInFlight).\(Int($0.GetValue())).png")
+            })
+            let timing = recorder.timing
+            let frames = Double(timing.frames.count)
+            print(String(format: "PipelinedFrameRecorder, %d in flight: %.1f ms per frame (%.2fx), per frame setup %.1f, " +
+                         "render %.1f, wait %.1f, readback %.1f, write %.1f ms, peak %d in flight",
+                         maximumFramesInFlight, milliseconds(timing.total) / frames, milliseconds(serialDuration) / milliseconds(timing.total),
+                         milliseconds(timing.sum(\.setup)) / frames, milliseconds(timing.sum(\.render)) / frames,
+                         milliseconds(timing.sum(\.wait)) / frames, milliseconds(timing.sum(\.readback)) / frames,
+                         milliseconds(timing.sum(\.write)) / frames, timing.peakFramesInFlight))
+        }
+    }
 }
 
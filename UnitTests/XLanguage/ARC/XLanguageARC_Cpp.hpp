@@ -105,6 +105,43 @@ namespace _xLanguageARC_functions_cpp {
     
 }
 
+// Crossings for the XLanguageARC benchmarks. Every function records the
+// reference count of the object at its deepest point, so the benchmark can tell how many
+// extra references C++ took during a crossing. Retains and releases made by Swift
+// aren't visible from there, so this isn't the total number of atomic operations.
+//
+// The functions use the same idioms as _xLanguageARC_functions_cpp. Borrowing a raw
+// pointer without retaining it is what the rawStage/rawLayer *_passWeak and *_returnWeak
+// crossings already do, so there's no separate fast path to measure.
+namespace _xLanguageARC_benchmarks {
+    void setUp();
+    void tearDown();
+    
+    pxr::UsdStageRefPtr stage();
+    pxr::SdfLayerRefPtr layer();
+    int stageCount();
+    int layerCount();
+    int observedCount();
+    
+    void smartStage_passStrong(const pxr::UsdStageRefPtr& p);
+    void smartStage_passWeak(const pxr::UsdStageWeakPtr& p);
+    pxr::UsdStageRefPtr smartStage_returnStrong();
+    pxr::UsdStageWeakPtr smartStage_returnWeak();
+    void rawStage_passStrong(pxr::UsdStage*_Nonnull p);
+    void rawStage_passWeak(pxr::UsdStage*_Nonnull p);
+    pxr::UsdStage*_Nonnull rawStage_returnStrong() SWIFT_RETURNS_RETAINED;
+    pxr::UsdStage*_Nonnull rawStage_returnWeak() SWIFT_RETURNS_UNRETAINED;
+    
+    void smartLayer_passStrong(const pxr::SdfLayerRefPtr& p);
+    void smartLayer_passWeak(const pxr::SdfLayerHandle& p);
+    pxr::SdfLayerRefPtr smartLayer_returnStrong();
+    pxr::SdfLayerHandle smartLayer_returnWeak();
+    void rawLayer_passStrong(pxr::SdfLayer*_Nonnull p);
+    void rawLayer_passWeak(pxr::SdfLayer*_Nonnull p);
+    pxr::SdfLayer*_Nonnull rawLayer_returnStrong() SWIFT_RETURNS_RETAINED;
+    pxr::SdfLayer*_Nonnull rawLayer_returnWeak() SWIFT_RETURNS_UNRETAINED;
+}
+
 namespace _xLanguageARC_tests {
     // MARK: SmartStage
     void smartStage_swiftReturn_holdTemporary_swiftPass_strong_cppEntry(const std::string& path);
@@ -582,3 +582,103 @@ void xltest::rawLayerFromStage_cppReturn_noTemporary_cppPass_cppEntry(const std:
     auto temp = SwiftUsd::TakeReturnValueFromSwift<pxr::TfRefPtr<pxr::SdfLayer>>(xlarcf_cpp::rawLayerFromStage_return(path));
     xlarcf_cpp::rawLayerFromStage_cppPass(SwiftUsd::PassToSwiftAsFunctionParameter(temp));
 }
+
+
+// MARK: Benchmarks
+namespace xlarcbm = _xLanguageARC_benchmarks;
+
+namespace {
+    pxr::UsdStageRefPtr s_benchmarkStage;
+    pxr::SdfLayerRefPtr s_benchmarkLayer;
+    int s_observedCount = 0;
+}
+
+void xlarcbm::setUp() {
+    s_benchmarkStage = pxr::UsdStage::CreateInMemory();
+    s_benchmarkLayer = pxr::SdfLayer::CreateAnonymous();
+    s_observedCount = 0;
+}
+void xlarcbm::tearDown() {
+    s_benchmarkStage = nullptr;
+    s_benchmarkLayer = nullptr;
+}
+
+pxr::UsdStageRefPtr xlarcbm::stage() { return s_benchmarkStage; }
+pxr::SdfLayerRefPtr xlarcbm::layer() { return s_benchmarkLayer; }
+int xlarcbm::stageCount() { return s_benchmarkStage->GetCurrentCount(); }
+int xlarcbm::layerCount() { return s_benchmarkLayer->GetCurrentCount(); }
+int xlarcbm::observedCount() { return s_observedCount; }
+
+// MARK: Stage
+void xlarcbm::smartStage_passStrong(const pxr::UsdStageRefPtr& p) {
+    s_observedCount = p->GetCurrentCount();
+}
+void xlarcbm::smartStage_passWeak(const pxr::UsdStageWeakPtr& p) {
+    s_observedCount = p->GetCurrentCount();
+}
+pxr::UsdStageRefPtr xlarcbm::smartStage_returnStrong() {
+    pxr::UsdStageRefPtr result = s_benchmarkStage;
+    s_observedCount = result->GetCurrentCount();
+    return result;
+}
+pxr::UsdStageWeakPtr xlarcbm::smartStage_returnWeak() {
+    pxr::UsdStageWeakPtr result = s_benchmarkStage;
+    s_observedCount = result->GetCurrentCount();
+    return result;
+}
+void xlarcbm::rawStage_passStrong(pxr::UsdStage* _Nonnull raw) {
+    pxr::UsdStageRefPtr stage = SwiftUsd::TakeFunctionParameterFromSwift<pxr::UsdStageRefPtr>(raw);
+    s_observedCount = stage->GetCurrentCount();
+}
+void xlarcbm::rawStage_passWeak(pxr::UsdStage* _Nonnull raw) {
+    pxr::UsdStageWeakPtr stage = SwiftUsd::TakeFunctionParameterFromSwift<pxr::UsdStageWeakPtr>(raw);
+    s_observedCount = stage->GetCurrentCount();
+}
+pxr::UsdStage* xlarcbm::rawStage_returnStrong() {
+    pxr::UsdStageRefPtr temp = s_benchmarkStage;
+    pxr::UsdStage* rawStage = SwiftUsd::PassToSwiftAsReturnValue(temp);
+    s_observedCount = rawStage->GetCurrentCount();
+    return rawStage;
+}
+pxr::UsdStage* xlarcbm::rawStage_returnWeak() {
+    pxr::UsdStage* rawStage = pxr::get_pointer(s_benchmarkStage);
+    s_observedCount = rawStage->GetCurrentCount();
+    return rawStage;
+}
+
+// MARK: Layer
+void xlarcbm::smartLayer_passStrong(const pxr::SdfLayerRefPtr& p) {
+    s_observedCount = p->GetCurrentCount();
+}
+void xlarcbm::smartLayer_passWeak(const pxr::SdfLayerHandle& p) {
+    s_observedCount = p->GetCurrentCount();
+}
+pxr::SdfLayerRefPtr xlarcbm::smartLayer_returnStrong() {
+    pxr::SdfLayerRefPtr result = s_benchmarkLayer;
+    s_observedCount = result->GetCurrentCount();
+    return result;
+}
+pxr::SdfLayerHandle xlarcbm::smartLayer_returnWeak() {
+    pxr::SdfLayerHandle result = s_benchmarkLayer;
+    s_observedCount = result->GetCurrentCount();
+    return result;
+}
+void xlarcbm::rawLayer_passStrong(pxr::SdfLayer* _Nonnull raw) {
+    pxr::SdfLayerRefPtr layer = SwiftUsd::TakeFunctionParameterFromSwift<pxr::SdfLayerRefPtr>(raw);
+    s_observedCount = layer->GetCurrentCount();
+}
+void xlarcbm::rawLayer_passWeak(pxr::SdfLayer* _Nonnull raw) {
+    pxr::SdfLayerHandle layer = SwiftUsd::TakeFunctionParameterFromSwift<pxr::SdfLayerHandle>(raw);
+    s_observedCount = layer->GetCurrentCount();
+}
+pxr::SdfLayer* xlarcbm::rawLayer_returnStrong() {
+    pxr::SdfLayerRefPtr temp = s_benchmarkLayer;
+    pxr::SdfLayer* rawLayer = SwiftUsd::PassToSwiftAsReturnValue(temp);
+    s_observedCount = rawLayer->GetCurrentCount();
+    return rawLayer;
+}
+pxr::SdfLayer* xlarcbm::rawLayer_returnWeak() {
+    pxr::SdfLayer* rawLayer = pxr::get_pointer(s_benchmarkLayer);
+    s_observedCount = rawLayer->GetCurrentCount();
+    return rawLayer;
+}
@@ -1253,6 +1253,84 @@ final class UsdStage_XLanguageARCTests: TemporaryDirectoryHelper {
 
 }
 
+// Measures the cost of a single Swift -> C++ crossing for each way of passing or returning
+// a stage or layer, using the SwiftUsd helpers or plain smart pointers.
+// Alongside the time, each row reports how many extra references C++ held at the deepest
+// point of the crossing. Retains and releases done by Swift don't show up in that count.
+final class XLanguageARC_BenchmarkTests: XCTestCase {
+    fileprivate typealias bm = _xLanguageARC_benchmarks
+    
+    private let iterations = 100_000
+    
+    private struct Result {
+        var nsPerCrossing: Double
+        var cppReferencesPerCrossing: Int
+    }
+    
+    override func setUp() {
+        super.setUp()
+        bm.setUp()
+    }
+    
+    override func tearDown() {
+        bm.tearDown()
+        super.tearDown()
+    }
+    
+    private func measure(_ name: String, count: () -> Int32, _ crossing: () -> ()) -> Result {
+        let baseline = count()
+        crossing()
+        let cppReferences = Int(bm.observedCount() - baseline)
+        XCTAssertEqual(count(), baseline, "\(name) leaked a reference")
+        
+        let elapsed = ContinuousClock().measure {
+            for _ in 0..<iterations {
+                crossing()
+            }
+        }
+        let seconds = milliseconds(elapsed) / 1e3
+        let result = Result(nsPerCrossing: seconds * 1e9 / Double(iterations), cppReferencesPerCrossing: cppReferences)
+        print("XLanguageARC.\(name): \(String(format: "%.1f", result.nsPerCrossing)) ns/crossing, \(result.cppReferencesPerCrossing) C++ references/crossing")
+        return result
+    }
+    
+    func test_benchmark_stage() {
+        let smart = bm.stage()
+        let weak = Overlay.TfWeakPtr(smart)
+        let raw = Overlay.Dereference(smart)
+        
+        _ = measure("smartStage_passStrong", count: bm.stageCount) { bm.smartStage_passStrong(smart) }
+        _ = measure("smartStage_passWeak", count: bm.stageCount) { bm.smartStage_passWeak(weak) }
+        _ = measure("smartStage_returnStrong", count: bm.stageCount) { _ = bm.smartStage_returnStrong() }
+        _ = measure("smartStage_returnWeak", count: bm.stageCount) { _ = bm.smartStage_returnWeak() }
+        let passStrong = measure("rawStage_passStrong", count: bm.stageCount) { bm.rawStage_passStrong(raw) }
+        let passWeak = measure("rawStage_passWeak", count: bm.stageCount) { bm.rawStage_passWeak(raw) }
+        let returnStrong = measure("rawStage_returnStrong", count: bm.stageCount) { _ = bm.rawStage_returnStrong() }
+        let returnWeak = measure("rawStage_returnWeak", count: bm.stageCount) { _ = bm.rawStage_returnWeak() }
+        
+        XCTAssertLessThan(passWeak.cppReferencesPerCrossing, passStrong.cppReferencesPerCrossing)
+        XCTAssertLessThan(returnWeak.cppReferencesPerCrossing, returnStrong.cppReferencesPerCrossing)
+    }
+    
+    func test_benchmark_layer() {
+        let smart = bm.layer()
+        let weak = Overlay.TfWeakPtr(smart)
+        let raw = Overlay.Dereference(smart)
+        
+        _ = measure("smartLayer_passStrong", count: bm.layerCount) { bm.smartLayer_passStrong(smart) }
+        _ = measure("smartLayer_passWeak", count: bm.layerCount) { bm.smartLayer_passWeak(weak) }
+        _ = measure("smartLayer_returnStrong", count: bm.layerCount) { _ = bm.smartLayer_returnStrong() }
+        _ = measure("smartLayer_returnWeak", count: bm.layerCount) { _ = bm.smartLayer_returnWeak() }
+        let passStrong = measure("rawLayer_passStrong", count: bm.layerCount) { bm.rawLayer_passStrong(raw) }
+        let passWeak = measure("rawLayer_passWeak", count: bm.layerCount) { bm.rawLayer_passWeak(raw) }
+        let returnStrong = measure("rawLayer_returnStrong", count: bm.layerCount) { _ = bm.rawLayer_returnStrong() }
+        let returnWeak = measure("rawLayer_returnWeak", count: bm.layerCount) { _ = bm.rawLayer_returnWeak() }
+        
+        XCTAssertLessThan(passWeak.cppReferencesPerCrossing, passStrong.cppReferencesPerCrossing)
+        XCTAssertLessThan(returnWeak.cppReferencesPerCrossing, returnStrong.cppReferencesPerCrossing)
+    }
+}
+
 
 
 #if canImport(XLangTestingUtil)
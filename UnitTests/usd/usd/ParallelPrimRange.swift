@@ -0,0 +1,202 @@
+//===----------------------------------------------------------------------===//
+// This source file is part of github.com/apple/SwiftUsd-Tests
+//
+// Copyright © 2025 Apple Inc. and the SwiftUsd-Tests project authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//  https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+//===----------------------------------------------------------------------===//
+
+import Foundation
+import OpenUSD
+
+// Parallel counterpart to UsdPrimRange.
+//
+// Visits the same prims as the serial range with the same start prim, predicate,
+// and pre/post-visit mode, and honors pruning the same way, but splits the prim tree
+// into subtrees that are traversed concurrently on the Work library's threads:
+// - The top of the tree is expanded serially, level by level, until there are enough
+//   subtrees to keep every Work thread busy (or the tree runs out of levels to split)
+// - Each subtree is traversed depth-first on one thread, with the same visit order
+//   UsdPrimRange would use inside it, and the subtrees are chunked with WorkParallelForN
+// - Post-visits of prims above the split are made after all their descendants are visited,
+//   so post-visits always come after the subtree they close, like in the serial range
+//
+// The visit callback runs concurrently, so it must be safe to call from several threads.
+// `forEach` makes no promise about the order of calls. `compactMap` returns its results
+// in exactly the order the serial range would visit the prims, regardless of thread timing.
+struct ParallelPrimRange {
+    // What the visit callback gets, in place of a UsdPrimRange iterator
+    struct Visit {
+        let prim: pxr.UsdPrim
+        let isPostVisit: Bool
+        fileprivate(set) var isPruned = false
+
+        // Same as UsdPrimRange.iterator.PruneChildren: skips the prim's descendants,
+        // but not its post-visit. Only allowed on pre-visits
+        mutating func pruneChildren() {
+            precondition(!isPostVisit, "Can't prune children during a post-visit")
+            isPruned = true
+        }
+    }
+
+    let start: pxr.UsdPrim
+    let predicate: pxr.Usd_PrimFlagsPredicate
+    let preAndPostVisit: Bool
+    // UsdPrimRange.Stage starts at the pseudo-root and skips it
+    let includesStart: Bool
+
+    // Number of subtrees to split into per Work thread, so uneven subtrees still balance out
+    var subtreesPerThread = 8
+    // Limits how many levels are expanded serially looking for enough subtrees
+    var maximumSplitDepth = 16
+
+    // Like `pxr.UsdPrimRange(start, predicate)`, or
+    // `pxr.UsdPrimRange.PreAndPostVisit(start, predicate)` if `preAndPostVisit` is true
+    init(_ start: pxr.UsdPrim, predicate: pxr.Usd_PrimFlagsPredicate = Overlay.UsdPrimDefaultPredicate, preAndPostVisit: Bool = false) {
+        self.init(start, predicate: predicate, preAndPostVisit: preAndPostVisit, includesStart: true)
+    }
+
+    private init(_ start: pxr.UsdPrim, predicate: pxr.Usd_PrimFlagsPredicate, preAndPostVisit: Bool, includesStart: Bool) {
+        self.start = start
+        self.predicate = predicate
+        self.preAndPostVisit = preAndPostVisit
+        self.includesStart = includesStart
+    }
+
+    // Like `pxr.UsdPrimRange.Stage(stage, predicate)`
+    static func stage(_ stage: pxr.UsdStage, predicate: pxr.Usd_PrimFlagsPredicate = Overlay.UsdPrimDefaultPredicate) -> ParallelPrimRange {
+        ParallelPrimRange(stage.GetPseudoRoot(), predicate: predicate, preAndPostVisit: false, includesStart: false)
+    }
+
+    // MARK: Traversal
+
+    // Calls `body` on every visit, concurrently and in no particular order
+    func forEach(_ body: @Sendable (inout Visit) -> ()) {
+        // Never has no values, so this doesn't allocate any results
+        let _: [Never] = compactMap { body(&$0); return nil }
+    }
+
+    // Calls `body` on every visit, concurrently, and returns the non-nil results
+    // in the order the serial UsdPrimRange would visit their prims
+    func compactMap<T>(_ body: @Sendable (inout Visit) -> T?) -> [T] {
+        var steps: [Step<T>] = initialSteps()
+        expand(&steps, body)
+
+        let subtrees: [pxr.UsdPrim] = steps.compactMap {
+            if case let .subtree(prim) = $0 { return prim } else { return nil }
+        }
+        // Each subtree's results are written by exactly one thread, and read after all of them finish
+        nonisolated(unsafe) let subtreeResults = UnsafeMutableBufferPointer<[T]>.allocate(capacity: subtrees.count)
+        subtreeResults.initialize(repeating: [])
+        defer {
+            subtreeResults.deinitialize()
+            subtreeResults.deallocate()
+        }
+        withoutActuallyEscaping(body) { body in
+            pxr.WorkParallelForN(subtrees.count) { begin, end in
+                for i in Int(begin)..<Int(end) {
+                    traverse(subtrees[i], body, into: &subtreeResults[i])
+                }
+            }
+        }
+
+        var result = [T]()
+        var nextSubtree = 0
+        for step in steps {
+            switch step {
+            case let .visited(value):
+                if let value { result.append(value) }
+            case .subtree:
+                result.append(contentsOf: subtreeResults[nextSubtree])
+                nextSubtree += 1
+            case let .postVisit(prim):
+                // Every subtree is done, and any post-visit below this one came earlier in `steps`
+                var visit = Visit(prim: prim, isPostVisit: true)
+                if let value = body(&visit) { result.append(value) }
+            }
+        }
+        return result
+    }
+
+    // Visits `prim` and its descendants depth-first, the way UsdPrimRange does
+    private func traverse<T>(_ prim: pxr.UsdPrim, _ body: (inout Visit) -> T?, into result: inout [T]) {
+        var stack = [(prim: prim, isPostVisit: false)]
+        while let next = stack.popLast() {
+            var visit = Visit(prim: next.prim, isPostVisit: next.isPostVisit)
+            if let value = body(&visit) { result.append(value) }
+            if next.isPostVisit { continue }
+
+            if preAndPostVisit {
+                stack.append((prim: next.prim, isPostVisit: true))
+            }
+            if !visit.isPruned {
+                // Pushed in reverse so the first child is popped first
+                stack.append(contentsOf: next.prim.GetFilteredChildren(predicate).reversed().map { (prim: $0, isPostVisit: false) })
+            }
+        }
+    }
+
+    // MARK: Splitting
+
+    // The serial visit order, with some subtrees not yet traversed
+    private enum Step<T> {
+        case visited(T?)
+        case subtree(pxr.UsdPrim)
+        case postVisit(pxr.UsdPrim)
+    }
+
+    private func initialSteps<T>() -> [Step<T>] {
+        if !includesStart {
+            return start.GetFilteredChildren(predicate).map { .subtree($0) }
+        }
+        // The serial range is empty if the start prim doesn't match the predicate
+        var iterator = pxr.UsdPrimRange(start, predicate).makeIterator()
+        guard iterator.next() == start else { return [] }
+        return [.subtree(start)]
+    }
+
+    // Replaces subtrees with the visits of their roots and their children's subtrees,
+    // a level at a time, until there are enough subtrees to go around
+    private func expand<T>(_ steps: inout [Step<T>], _ body: (inout Visit) -> T?) {
+        let targetSubtreeCount = max(1, Int(pxr.WorkGetConcurrencyLimit()) * subtreesPerThread)
+        var subtreeCount = steps.count
+
+        for _ in 0..<maximumSplitDepth {
+            guard subtreeCount > 0 && subtreeCount < targetSubtreeCount else { return }
+            var expanded = [Step<T>]()
+            expanded.reserveCapacity(steps.count)
+            subtreeCount = 0
+
+            for step in steps {
+                guard case let .subtree(prim) = step else {
+                    expanded.append(step)
+                    continue
+                }
+                var visit = Visit(prim: prim, isPostVisit: false)
+                expanded.append(.visited(body(&visit)))
+                if !visit.isPruned {
+                    for child in prim.GetFilteredChildren(predicate) {
+                        expanded.append(.subtree(child))
+                        subtreeCount += 1
+                    }
+                }
+                if preAndPostVisit {
+                    expanded.append(.postVisit(prim))
+                }
+            }
+            steps = expanded
+        }
+    }
+}
@@ -20,6 +20,7 @@
 
 import XCTest
 import OpenUSD
+import Synchronization
 
 final class UsdPrimRangeTests: XCTestCase {
     func testTraverse() throws {
@@ -323,4 +324,151 @@ final class UsdPrimRangeTests: XCTestCase {
         }
         XCTAssertEqual(i, expected.count)
     }
+    
+    // MARK: ParallelPrimRange
+    
+    // A full tree with `fanout` children per prim, where every 7th prim is inactive
+    // and every 11th prim is an over, so predicates have something to filter
+    private func makeStage(fanout: Int, depth: Int) -> pxr.UsdStage {
+        var text = "#usda 1.0\n"
+        var count = 0
+        func write(_ name: String, _ level: Int) {
+            count += 1
+            let specifier = count % 11 == 0 ? "over" : "def"
+            let metadata = count % 7 == 0 ? " (active = false)" : ""
+            text += "\(specifier) Scope \"\(name)\"\(metadata) {\n"
+            if level < depth {
+                for i in 0..<fanout { write("p\(i)", level + 1) }
+            }
+            text += "}\n"
+        }
+        for i in 0..<fanout { write("p\(i)", 1) }
+        
+        let stage = Overlay.Dereference(pxr.UsdStage.CreateInMemory(.LoadAll))
+        XCTAssertTrue(Overlay.Dereference(stage.GetRootLayer()).ImportFromString(std.string(text)))
+        return stage
+    }
+    
+    private static func describe(_ prim: pxr.UsdPrim, _ isPostVisit: Bool) -> String {
+        "\(prim.GetPath().GetAsString())\(isPostVisit ? " (post)" : "")"
+    }
+    
+    private static func shouldPrune(_ prim: pxr.UsdPrim) -> Bool {
+        String(prim.GetName()).hasSuffix("2")
+    }
+    
+    private func serialVisits(_ range: pxr.UsdPrimRange, pruning: Bool) -> [String] {
+        var result = [String]()
+        for (iter, prim) in range.withIterator() {
+            result.append(Self.describe(prim, iter.IsPostVisit()))
+            if pruning && !iter.IsPostVisit() && Self.shouldPrune(prim) {
+                iter.PruneChildren()
+            }
+        }
+        return result
+    }
+    
+    private func parallelVisits(_ range: ParallelPrimRange, pruning: Bool) -> [String] {
+        range.compactMap { visit in
+            if pruning && !visit.isPostVisit && Self.shouldPrune(visit.prim) {
+                visit.pruneChildren()
+            }
+            return Self.describe(visit.prim, visit.isPostVisit)
+        }
+    }
+    
+    func testParallelMatchesSerial() throws {
+        let stage = makeStage(fanout: 5, depth: 5)
+        let root = stage.GetPseudoRoot()
+        let p1 = stage.GetPrimAtPath("/p1")
+        let inactive = stage.GetPrimAtPath("/p0/p0/p0/p0/p2")
+        XCTAssertFalse(inactive.IsActive())
+        
+        let ranges: [(String, pxr.UsdPrimRange, ParallelPrimRange)] = [
+            ("Stage", pxr.UsdPrimRange.Stage(Overlay.TfWeakPtr(stage), Overlay.UsdPrimDefaultPredicate), .stage(stage)),
+            ("Stage all prims", pxr.UsdPrimRange.Stage(Overlay.TfWeakPtr(stage), pxr.UsdPrimAllPrimsPredicate), .stage(stage, predicate: pxr.UsdPrimAllPrimsPredicate)),
+            ("Subtree", pxr.UsdPrimRange(p1, Overlay.UsdPrimDefaultPredicate), ParallelPrimRange(p1)),
+            ("Inactive start", pxr.UsdPrimRange(inactive, Overlay.UsdPrimDefaultPredicate), ParallelPrimRange(inactive)),
+            ("AllPrims", pxr.UsdPrimRange.AllPrims(root), ParallelPrimRange(root, predicate: pxr.UsdPrimAllPrimsPredicate)),
+            ("PreAndPostVisit", pxr.UsdPrimRange.PreAndPostVisit(root), ParallelPrimRange(root, preAndPostVisit: true)),
+            ("AllPrimsPreAndPostVisit", pxr.UsdPrimRange.AllPrimsPreAndPostVisit(root), ParallelPrimRange(root, predicate: pxr.UsdPrimAllPrimsPredicate, preAndPostVisit: true)),
+        ]
+        
+        for (name, serialRange, parallelRange) in ranges {
+            for pruning in [false, true] {
+                let expected = serialVisits(serialRange, pruning: pruning)
+                // No splitting, the default splitting, and splitting down to the leaves
+                for subtreesPerThread in [0, 8, 1_000_000] {
+                    var parallelRange = parallelRange
+                    parallelRange.subtreesPerThread = subtreesPerThread
+                    XCTAssertEqual(parallelVisits(parallelRange, pruning: pruning), expected,
+                                   "\(name), pruning: \(pruning), subtreesPerThread: \(subtreesPerThread)")
+                }
+            }
+        }
+        XCTAssertEqual(serialVisits(pxr.UsdPrimRange(inactive, Overlay.UsdPrimDefaultPredicate), pruning: false), [])
+    }
+    
+    func testParallelForEach() throws {
+        let stage = makeStage(fanout: 5, depth: 5)
+        let expected = serialVisits(pxr.UsdPrimRange.PreAndPostVisit(stage.GetPseudoRoot()), pruning: true)
+        
+        let visits = Mutex<[String]>([])
+        ParallelPrimRange(stage.GetPseudoRoot(), preAndPostVisit: true).forEach { visit in
+            if !visit.isPostVisit && Self.shouldPrune(visit.prim) {
+                visit.pruneChildren()
+            }
+            let description = Self.describe(visit.prim, visit.isPostVisit)
+            visits.withLock { $0.append(description) }
+        }
+        XCTAssertEqual(visits.withLock { $0 }.sorted(), expected.sorted())
+    }
+    
+    func test_benchmark_parallelTraversal() throws {
+        func medianDuration(_ body: () -> ()) -> Duration {
+            body()
+            var samples = [Duration]()
+            for _ in 0..<5 {
+                let start = ContinuousClock.now
+                body()
+                samples.append(ContinuousClock.now - start)
+            }
+            return samples.sorted()[samples.count / 2]
+        }
+        
+        // 11,110, 111,110, and 1,111,110 prims. Traverse all of them, including the
+        // inactive prims and overs, so the prim count is the size of the stage
+        #if DEBUG
+        let depths = [4, 5]
+        #else
+        let depths = [4, 5, 6]
+        #endif
+        for depth in depths {
+            let stage = makeStage(fanout: 10, depth: depth)
+            let expected = Array(stage.TraverseAll()).map { $0.GetPath() }
+            XCTAssertEqual(expected.count, (1...depth).reduce(0) { total, _ in total * 10 + 10 })
+            
+            let serial = medianDuration {
+                var count = 0
+                for prim in stage.TraverseAll() where prim.GetTypeName() == "Scope" { count += 1 }
+                XCTAssertEqual(count, expected.count)
+            }
+            let forEach = medianDuration {
+                ParallelPrimRange.stage(stage, predicate: pxr.UsdPrimAllPrimsPredicate).forEach { visit in
+                    _ = visit.prim.GetTypeName() == "Scope"
+                }
+            }
+            let compactMap = medianDuration {
+                let paths = ParallelPrimRange.stage(stage, predicate: pxr.UsdPrimAllPrimsPredicate).compactMap { visit in
+                    visit.prim.GetTypeName() == "Scope" ? visit.prim.GetPath() : nil
+                }
+                XCTAssertEqual(paths, expected)
+            }
+            print(String(format: "ParallelPrimRange(prims=%d): serial %.1f ms, forEach %.1f ms (%.2fx), ordered compactMap %.1f ms (%.2fx)",
+                         expected.count,
+                         milliseconds(serial),
+                         milliseconds(forEach), milliseconds(serial) / milliseconds(forEach),
+                         milliseconds(compactMap), milliseconds(serial) / milliseconds(compactMap)))
+        }
+    }
 }
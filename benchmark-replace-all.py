@@ -0,0 +1,202 @@
+#===----------------------------------------------------------------------===#
+# This source file is part of github.com/apple/SwiftUsd-Tests
+#
+# Copyright © 2025 Apple Inc. and the SwiftUsd-Tests project authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#  https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# SPDX-License-Identifier: Apache-2.0
+#===----------------------------------------------------------------------===#
+
+# Compile-time benchmark for replace_all_t.
+#
+# Generates a translation unit with thousands of signatures that share sub-types,
+# the way the Overlay headers do, and instantiates replace_all_t on each of them.
+# For each implementation it reports front-end time (-fsyntax-only, median of several runs)
+# and the smallest -ftemplate-depth the translation unit compiles with.
+#
+# The swiftUsd implementation is read from swiftUsd/Util/TypeTraits.h under --swiftusd-include,
+# which defaults to the headers in a local SwiftUsd checkout symlinked next to this script.
+
+import pathlib
+import argparse
+import random
+import statistics
+import subprocess
+import tempfile
+import time
+
+SWIFTUSD_TYPE_TRAITS = pathlib.Path("swiftUsd") / "Util" / "TypeTraits.h"
+DEFAULT_SWIFTUSD_INCLUDE = pathlib.Path("SwiftUsd") / "swift-package" / "Sources" / "_OpenUSD_SwiftBindingHelpers" / "include"
+
+IMPLEMENTATIONS = {
+    "swiftUsd": ("#include \"swiftUsd/Util/TypeTraits.h\"", "_Overlay::replace_all_t"),
+    "flat": ("#include \"FlatTypeTraits.hpp\"", "_FlatTypeTraits::replace_all_t"),
+}
+
+PRELUDE = """
+#include <type_traits>
+{include}
+
+struct Pattern {{}};
+struct Replacement {{}};
+{unrelated}
+
+template <typename T> using ptr = T*;
+template <typename T> using cptr = const T*;
+template <typename T> using lref = T&;
+template <typename T> using clref = const T&;
+template <typename T> using rref = T&&;
+template <typename T> using arr4 = T[4];
+template <typename T, typename C> using mem = T C::*;
+template <typename R, typename... Args> using fn = R(*)(Args...);
+
+template <typename T> using replace = {replace_all_t}<T, Pattern, Replacement>;
+"""
+
+
+class SignatureGenerator:
+    def __init__(self, seed, unrelated_count, max_depth, max_params):
+        self.rng = random.Random(seed)
+        self.leaves = ["Pattern", "int", "float", "double"] + [f"Unrelated{i}" for i in range(unrelated_count)]
+        self.max_depth = max_depth
+        self.max_params = max_params
+        # Composite sub-types are emitted as aliases, so signatures can share them
+        # without the generated source growing exponentially
+        self.shared = []
+        self.aliases = []
+
+    # An object type, usable as a pointee, return type, or parameter type
+    def object_type(self, depth):
+        if depth >= self.max_depth or self.rng.random() < 0.2:
+            return self.rng.choice(self.leaves)
+        if self.shared and self.rng.random() < 0.4:
+            return self.rng.choice(self.shared)
+
+        kind = self.rng.choice(["ptr", "cptr", "ptr_arr", "mem", "fn"])
+        if kind == "ptr":
+            result = f"ptr<{self.object_type(depth + 1)}>"
+        elif kind == "cptr":
+            result = f"cptr<{self.object_type(depth + 1)}>"
+        elif kind == "ptr_arr":
+            result = f"ptr<arr4<{self.object_type(depth + 1)}>>"
+        elif kind == "mem":
+            result = f"mem<{self.object_type(depth + 1)}, {self.rng.choice(self.leaves[4:] + ['Pattern'])}>"
+        else:
+            result = self.function_pointer(depth + 1)
+
+        alias = f"sub{len(self.aliases)}"
+        self.aliases.append(f"using {alias} = {result};")
+        self.shared.append(alias)
+        return alias
+
+    def parameter_type(self, depth):
+        t = self.object_type(depth)
+        wrapper = self.rng.choice([None, None, "lref", "clref", "rref"])
+        return t if wrapper is None else f"{wrapper}<{t}>"
+
+    def function_pointer(self, depth):
+        params = [self.parameter_type(depth) for _ in range(self.rng.randint(0, self.max_params))]
+        return f"fn<{', '.join([self.object_type(depth)] + params)}>"
+
+    def signature(self):
+        return self.function_pointer(0)
+
+
+def make_source(implementation, aliases, signatures, unrelated_count):
+    include, replace_all_t = IMPLEMENTATIONS[implementation]
+    unrelated = "\n".join(f"struct Unrelated{i} {{}};" for i in range(unrelated_count))
+    lines = [PRELUDE.format(include=include, unrelated=unrelated, replace_all_t=replace_all_t)] + aliases
+    for i, signature in enumerate(signatures):
+        lines.append(f"using sig{i} = {signature};")
+        lines.append(f"using out{i} = replace<sig{i}>;")
+    lines.append(f"static_assert(sizeof(ptr<out{len(signatures) - 1}>) > 0);")
+    return "\n".join(lines) + "\n"
+
+
+def compile_command(args, include_dirs, source, template_depth=None):
+    command = [args.compiler, f"-std={args.std}", "-fsyntax-only"]
+    if template_depth is not None:
+        command.append(f"-ftemplate-depth={template_depth}")
+    for include_dir in include_dirs:
+        command += ["-I", str(include_dir)]
+    return command + [str(source)]
+
+
+def compiles(command):
+    return subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL).returncode == 0
+
+
+def front_end_seconds(args, include_dirs, source):
+    command = compile_command(args, include_dirs, source)
+    samples = []
+    for _ in range(args.repeat):
+        start = time.perf_counter()
+        result = subprocess.run(command, capture_output=True, text=True)
+        samples.append(time.perf_counter() - start)
+        if result.returncode != 0:
+            raise RuntimeError(f"Failed to compile {source}:\n{result.stderr}")
+    return statistics.median(samples)
+
+
+def minimum_template_depth(args, include_dirs, source):
+    lo, hi = 1, args.max_template_depth
+    if not compiles(compile_command(args, include_dirs, source, hi)):
+        return None
+    while lo < hi:
+        mid = (lo + hi) // 2
+        if compiles(compile_command(args, include_dirs, source, mid)):
+            hi = mid
+        else:
+            lo = mid + 1
+    return lo
+
+
+if __name__ == "__main__":
+    swiftUsdTests_repo = pathlib.Path(__file__).parent
+
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--compiler", type=str, default="clang++")
+    parser.add_argument("--std", type=str, default="gnu++17")
+    parser.add_argument("--swiftusd-include", type=pathlib.Path, default=swiftUsdTests_repo / DEFAULT_SWIFTUSD_INCLUDE, help="Directory containing swiftUsd/Util/TypeTraits.h")
+    parser.add_argument("--signatures", type=int, nargs="+", default=[1000, 5000], help="Signature counts to benchmark")
+    parser.add_argument("--max-depth", type=int, default=6, help="Maximum nesting depth of generated signatures")
+    parser.add_argument("--max-params", type=int, default=6, help="Maximum parameter count of generated function types")
+    parser.add_argument("--unrelated", type=int, default=16, help="Number of unrelated struct types to draw from")
+    parser.add_argument("--repeat", type=int, default=3, help="Number of timed front-end runs per configuration")
+    parser.add_argument("--max-template-depth", type=int, default=2048)
+    parser.add_argument("--seed", type=int, default=0)
+    args = parser.parse_args()
+
+    implementations = ["flat"]
+    if (args.swiftusd_include / SWIFTUSD_TYPE_TRAITS).is_file():
+        implementations.insert(0, "swiftUsd")
+    else:
+        print(f"Skipping swiftUsd: {args.swiftusd_include / SWIFTUSD_TYPE_TRAITS} not found. Pass --swiftusd-include")
+
+    include_dirs = [swiftUsdTests_repo / "UnitTests" / "Misc", args.swiftusd_include]
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        for count in args.signatures:
+            generator = SignatureGenerator(args.seed, args.unrelated, args.max_depth, args.max_params)
+            signatures = [generator.signature() for _ in range(count)]
+
+            for implementation in implementations:
+                source = pathlib.Path(temp_dir) / f"replace_all_{implementation}_{count}.cpp"
+                with open(source, "w") as f:
+                    f.write(make_source(implementation, generator.aliases, signatures, args.unrelated))
+
+                seconds = front_end_seconds(args, include_dirs, source)
+                depth = minimum_template_depth(args, include_dirs, source)
+                depth_description = f">{args.max_template_depth}" if depth is None else str(depth)
+                print(f"replace_all_t.{implementation}(signatures={count}): {seconds * 1000:.1f} ms front-end, template depth {depth_description}")